@@ -34,36 +34,50 @@
 
 #include "actions.h"
 
-DataMode dataMode = DataMode::FILTERED;
+DataMode      dataMode         = DataMode::FILTERED;
+unsigned long sampleIntervalUs = 0;
+
+void actionSetDataMode(DataMode mode) {
+    dataMode = mode;
+    Log::info("Data mode set to %s", dataMode == DataMode::RAW ? "RAW" : "FILTERED");
+    eventChannel.post(EVENT_MODE, (int32_t)dataMode);
+}
+
+void actionSetSampleRate(float hz) {
+    // NaN counts as 0, and a tiny rate would overflow the interval conversion
+    hz               = hz > 0.0f ? constrain(hz, SAMPLE_RATE_MIN_HZ, SAMPLE_RATE_MAX_HZ) : 0.0f;
+    sampleIntervalUs = hz > 0.0f ? (unsigned long)(1000000.0f / hz) : 0;
+    Log::info("Sample rate set to %.1f Hz%s", hz, hz > 0.0f ? "" : " (free running)");
+}
+
+void actionSetFilterGain(float gain) {
+    beta = constrain(gain, 0.0f, 1.0f);
+    Log::info("Filter gain set to %.3f", (float)beta);
+}
 
 void actionToggleDataMode() {
-    dataMode = dataMode == DataMode::RAW ? DataMode::FILTERED : DataMode::RAW;
-    Log::info("Data mode toggled to %s", dataMode == DataMode::RAW ? "RAW" : "FILTERED");
-    LedManager::setColor(0, 0, 1);
-    delay(DELAY_LED_FEEDBACK_MS);
-    LedManager::off();
+    actionSetDataMode(dataMode == DataMode::RAW ? DataMode::FILTERED : DataMode::RAW);
+    LedManager::signalDataMode();
 }
 
 void actionResetCalibration() {
-    Log::info("Resetting calibration...");
-    LedManager::setColor(1, 1, 0);
-    if (calibrateGyro(CALIB_SAMPLES, CALIB_DELAY_MS)) {
-        LedManager::signalSuccess();
-    } else {
-        LedManager::signalErrorGeneral();
-    }
+    // Runs on the regular samples like the boot calibration, the current bias stays in use until it ends
+    recalibrateGyro();
 }
 
 void actionResetWifiConfig() {
     Log::warning("Resetting WiFi configuration... This will reboot the device.");
     WiFiManager::instance().clearCredentials();
     LedManager::signalErrorGeneral();
+    LedManager::finish();
     delay(DELAY_BEFORE_RESTART_MS);
     ESP.restart();
 }
 
 void actionSleep() {
     Log::info("Entering deep sleep...");
+    settingsRegistry.flush();
+    discovery.end();
     LedManager::off();
     goToSleep();
 }
\ No newline at end of file
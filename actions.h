@@ -38,12 +38,35 @@
 #include <Arduino.h>
 
 #include "bmi160.h"
+#include "discovery.h"
+#include "event_channel.h"
 #include "led_manager.h"
+#include "madgwick.h"
 #include "logger.h"
+#include "settings_registry.h"
 #include "sleep_manager.h"
 #include "wifi_manager.h"
 
-extern DataMode dataMode; /**< Data mode */
+extern DataMode      dataMode;         /**< Data mode */
+extern unsigned long sampleIntervalUs; /**< Minimum time between samples, 0 = as fast as possible */
+
+/**
+ * Set the data mode and notify the receivers
+ * @param mode New data mode
+ */
+void actionSetDataMode(DataMode mode);
+
+/**
+ * Set the output rate
+ * @param hz Samples per second, 0 = as fast as the loop runs (clamped to SAMPLE_RATE_MIN_HZ..SAMPLE_RATE_MAX_HZ)
+ */
+void actionSetSampleRate(float hz);
+
+/**
+ * Set the Madgwick filter gain
+ * @param gain New beta, clamped to [0, 1]
+ */
+void actionSetFilterGain(float gain);
 
 /**
  * Toggle the data mode
@@ -52,6 +75,7 @@ void actionToggleDataMode();
 
 /**
  * Reset the calibration
+ * Starts a gyroscope calibration on the regular samples and returns at once, see recalibrateGyro().
  */
 void actionResetCalibration();
 
@@ -26,33 +26,91 @@
 
 #include "bmi160.h"
 
-float gyroBiasRaw[3] = {0.0f, 0.0f, 0.0f};
+// In RTC memory, so a wake from deep sleep streams with the last bias until the new calibration ends
+RTC_DATA_ATTR float gyroBiasRaw[3] = {0.0f, 0.0f, 0.0f};
+RTC_DATA_ATTR bool  gyroBiasValid  = false;
 
-void writeReg(uint8_t reg, uint8_t val)
+static uint32_t readErrors  = 0; /**< Failed reads since boot */
+static uint32_t pollRetries = 0; /**< Failed reads while polling a register, expected while the chip starts */
+
+/** Running gyroscope calibration */
+static struct
 {
-    Wire.beginTransmission(BMI160_ADDR);
-    Wire.write(reg);
-    Wire.write(val);
-    Wire.endTransmission();
-}
+    bool    active;
+    int     target;
+    int     count;
+    long    sum[3];
+    int16_t min[3];
+    int16_t max[3];
+} gyroCalib = {};
 
-bool readBytes(uint8_t reg, uint8_t *buf, uint8_t len)
+/**
+ * Read registers without counting a failure
+ * @return false if the chip did not answer
+ */
+static bool transfer(uint8_t reg, uint8_t *buf, uint8_t len)
 {
     Wire.beginTransmission(BMI160_ADDR);
     Wire.write(reg);
     if (Wire.endTransmission(false) != 0)
         return false;
+
     Wire.requestFrom((int)BMI160_ADDR, (int)len);
     for (uint8_t i = 0; i < len; ++i)
     {
-        if (Wire.available())
-            buf[i] = Wire.read();
-        else
+        if (!Wire.available())
             return false;
+        buf[i] = Wire.read();
     }
     return true;
 }
 
+/**
+ * Poll a register until the masked bits have the expected value
+ * A chip still in reset does not answer, so failed reads count as retries rather than read errors.
+ * @return false on timeout
+ */
+static bool waitForBits(uint8_t reg, uint8_t mask, uint8_t value, unsigned long timeoutMs)
+{
+    unsigned long start = millis();
+    uint8_t       current;
+    do
+    {
+        if (!transfer(reg, &current, 1))
+            pollRetries++;
+        else if ((current & mask) == value)
+            return true;
+        delay(1);
+    } while (millis() - start < timeoutMs);
+    return false;
+}
+
+void writeReg(uint8_t reg, uint8_t val)
+{
+    Wire.beginTransmission(BMI160_ADDR);
+    Wire.write(reg);
+    Wire.write(val);
+    Wire.endTransmission();
+}
+
+bool readBytes(uint8_t reg, uint8_t *buf, uint8_t len)
+{
+    if (transfer(reg, buf, len))
+        return true;
+    readErrors++;
+    return false;
+}
+
+uint32_t getBMI160ReadErrors()
+{
+    return readErrors;
+}
+
+uint32_t getBMI160PollRetries()
+{
+    return pollRetries;
+}
+
 int16_t toInt16(uint8_t lsb, uint8_t msb)
 {
     return (int16_t)((msb << 8) | lsb);
@@ -60,23 +118,27 @@ int16_t toInt16(uint8_t lsb, uint8_t msb)
 
 bool initBMI160Sensor()
 {
-    // Soft reset
+    // Soft reset, the chip answers again after about a millisecond
     writeReg(REG_CMD, 0xB6);
-    delay(100);
+    delay(1);
 
     // Check chip ID
     uint8_t id = 0;
-    if (!readBytes(REG_CHIP_ID, &id, 1))
-        return false;
-    if (id != BMI160_CHIP_ID)
+    if (!waitForBits(REG_CHIP_ID, 0xFF, BMI160_CHIP_ID, BMI160_STARTUP_TIMEOUT_MS))
     {
+        if (!readBytes(REG_CHIP_ID, &id, 1))
+            return false;
         Log::error("BMI160 chip id mismatch: 0x%02X", id);
     }
 
+    // The accelerometer starts within 4 ms and the gyroscope within 80 ms, the command register is busy until then
     writeReg(REG_CMD, REG_ACC_NORMAL_MODE);
-    delay(50);
+    delay(4);
     writeReg(REG_CMD, REG_GYR_NORMAL_MODE);
-    delay(50);
+    if (!waitForBits(REG_PMU_STATUS, PMU_NORMAL_MASK, PMU_NORMAL, BMI160_STARTUP_TIMEOUT_MS))
+    {
+        Log::warning("BMI160 power modes not confirmed");
+    }
 
     // Configure accelerometer: ODR and range
     // ACC_CONF: ODR=100Hz, normal BW
@@ -88,50 +150,100 @@ bool initBMI160Sensor()
     writeReg(REG_GYR_CONF, 0x28);
     writeReg(REG_GYR_RANGE, 0x00); // 0x00 => ±2000 dps
 
-    delay(50);
+    // First samples at the new settings, one output period later
+    if (!waitForBits(REG_STATUS, STATUS_DRDY_MASK, STATUS_DRDY_MASK, BMI160_STARTUP_TIMEOUT_MS))
+    {
+        Log::warning("BMI160 data not ready");
+    }
     return true;
 }
 
+float setBMI160DataRate(float hz)
+{
+    // ODR codes 0x06 (25 Hz) to 0x0C (1600 Hz), the highest the accelerometer supports
+    uint8_t odr  = 0x06;
+    float   rate = 25.0f;
+    while (rate < hz && odr < 0x0C)
+    {
+        odr++;
+        rate *= 2.0f;
+    }
+
+    // Normal bandwidth, same as initBMI160Sensor()
+    writeReg(REG_ACC_CONF, 0x20 | odr);
+    writeReg(REG_GYR_CONF, 0x20 | odr);
+    return rate;
+}
+
 void autoCalibrateAccelerometer()
 {
     Log::info("Starting accelerometer auto-calibration command (0x37)...");
     writeReg(REG_CMD, 0x37);
-    delay(100);
-    // Wait extra time to complete the calibration
-    delay(1000);
-    Log::info("Accelerometer auto-calibration command sent.");
+    delay(1);
+    // Done when foc_rdy is set, usually long before the timeout
+    if (waitForBits(REG_STATUS, STATUS_FOC_RDY, STATUS_FOC_RDY, BMI160_FOC_TIMEOUT_MS))
+        Log::info("Accelerometer auto-calibration done.");
+    else
+        Log::warning("Accelerometer auto-calibration did not report completion.");
+}
+
+void beginGyroCalibration(int samples)
+{
+    gyroCalib        = {};
+    gyroCalib.active = samples > 0;
+    gyroCalib.target = samples;
+}
+
+bool isGyroCalibrating()
+{
+    return gyroCalib.active;
+}
+
+GyroCalibration addGyroCalibrationSample(int16_t gx_raw, int16_t gy_raw, int16_t gz_raw)
+{
+    if (!gyroCalib.active)
+        return GyroCalibration::MOVED;
+
+    int16_t raw[3] = {gx_raw, gy_raw, gz_raw};
+    for (int i = 0; i < 3; ++i)
+    {
+        gyroCalib.sum[i] += raw[i];
+        if (gyroCalib.count == 0 || raw[i] < gyroCalib.min[i])
+            gyroCalib.min[i] = raw[i];
+        if (gyroCalib.count == 0 || raw[i] > gyroCalib.max[i])
+            gyroCalib.max[i] = raw[i];
+    }
+    if (++gyroCalib.count < gyroCalib.target)
+        return GyroCalibration::RUNNING;
+
+    gyroCalib.active = false;
+
+    // An average taken while the device turned would be the rotation, not the bias
+    for (int i = 0; i < 3; ++i)
+    {
+        if ((gyroCalib.max[i] - gyroCalib.min[i]) / GYR_LSB_PER_DPS > CALIB_MAX_SPREAD_DPS)
+            return GyroCalibration::MOVED;
+    }
+
+    // Convert to deg/s using scale factor and store in raw order
+    for (int i = 0; i < 3; ++i)
+        gyroBiasRaw[i] = (float)gyroCalib.sum[i] / (float)gyroCalib.count / GYR_LSB_PER_DPS;
+    gyroBiasValid = true;
+    return GyroCalibration::DONE;
 }
 
-bool calibrateGyro(int samples, int delayMs)
+bool estimateGyroBias(float bias[3])
 {
-    if (samples <= 0)
+    if (!gyroCalib.active || gyroCalib.count == 0)
         return false;
-    
-    long sumX = 0, sumY = 0, sumZ = 0;
-    uint8_t buf[6];
-    
-    for (int i = 0; i < samples; ++i)
+
+    for (int i = 0; i < 3; ++i)
     {
-        if (!readBytes(REG_GYR_DATA, buf, 6))
+        if ((gyroCalib.max[i] - gyroCalib.min[i]) / GYR_LSB_PER_DPS > CALIB_MAX_SPREAD_DPS)
             return false;
-        int16_t gx_raw = toInt16(buf[0], buf[1]);
-        int16_t gy_raw = toInt16(buf[2], buf[3]);
-        int16_t gz_raw = toInt16(buf[4], buf[5]);
-        sumX += gx_raw;
-        sumY += gy_raw;
-        sumZ += gz_raw;
-        delay(delayMs);
     }
-    
-    float avgX = (float)sumX / (float)samples;
-    float avgY = (float)sumY / (float)samples;
-    float avgZ = (float)sumZ / (float)samples;
-    
-    // Convert to deg/s using scale factor and store in raw order
-    gyroBiasRaw[0] = avgX / GYR_LSB_PER_DPS;
-    gyroBiasRaw[1] = avgY / GYR_LSB_PER_DPS;
-    gyroBiasRaw[2] = avgZ / GYR_LSB_PER_DPS;
-    
+    for (int i = 0; i < 3; ++i)
+        bias[i] = (float)gyroCalib.sum[i] / (float)gyroCalib.count / GYR_LSB_PER_DPS;
     return true;
 }
 
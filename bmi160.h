@@ -68,8 +68,10 @@
 #include "logger.h"
 
 const uint8_t REG_CHIP_ID         = 0x00;
+const uint8_t REG_PMU_STATUS      = 0x03;
 const uint8_t REG_GYR_DATA        = 0x0C;
 const uint8_t REG_ACC_DATA        = 0x12;
+const uint8_t REG_STATUS          = 0x1B;
 const uint8_t REG_CMD             = 0x7E;
 const uint8_t REG_ACC_CONF        = 0x40;
 const uint8_t REG_ACC_NORMAL_MODE = 0x11;
@@ -80,7 +82,21 @@ const uint8_t REG_GYR_RANGE       = 0x43;
 
 const uint8_t BMI160_CHIP_ID = 0xD1;
 
+const uint8_t PMU_NORMAL_MASK  = 0x3C; /**< Accelerometer and gyroscope bits of PMU_STATUS */
+const uint8_t PMU_NORMAL       = 0x14; /**< Both in normal mode */
+const uint8_t STATUS_DRDY_MASK = 0xC0; /**< Accelerometer and gyroscope data ready bits of STATUS */
+const uint8_t STATUS_FOC_RDY   = 0x08; /**< Fast offset compensation done */
+
+const unsigned long BMI160_STARTUP_TIMEOUT_MS = 100;  /**< Longest wait for reset, power modes and first data */
+const unsigned long BMI160_FOC_TIMEOUT_MS     = 1100; /**< Longest wait for the accelerometer offset compensation */
+
 extern float gyroBiasRaw[3];
+extern bool  gyroBiasValid; /**< Whether gyroBiasRaw holds a calibration, kept over deep sleep */
+
+/**
+ * Progress of a gyroscope calibration fed with samples
+ */
+enum class GyroCalibration { RUNNING, DONE, MOVED };
 
 /**
  * Write a value to a register of the BMI160
@@ -98,6 +114,19 @@ void writeReg(uint8_t reg, uint8_t val);
  */
 bool readBytes(uint8_t reg, uint8_t* buf, uint8_t len);
 
+/**
+ * Get the number of failed I2C reads since boot
+ * @return Failed reads
+ */
+uint32_t getBMI160ReadErrors();
+
+/**
+ * Get the number of failed reads while waiting for the chip to reset, start or finish a command
+ * They are expected during startup and not counted as read errors.
+ * @return Failed polls
+ */
+uint32_t getBMI160PollRetries();
+
 /**
  * Convert two bytes (LSB, MSB) to a 16-bit signed integer
  * @param lsb Least significant byte (LSB)
@@ -108,25 +137,55 @@ int16_t toInt16(uint8_t lsb, uint8_t msb);
 
 /**
  * Basic initialization of the BMI160
- * Configures operation modes, ODR and ranges
+ * Configures operation modes, ODR and ranges. Polls the chip for the end of each step instead of waiting for the
+ * worst case, so it returns as soon as the first data is ready.
  * @return true if the initialization was successful
  */
 bool initBMI160Sensor();
 
+/**
+ * Set the output data rate of the accelerometer and gyroscope
+ * Picks the slowest BMI160 rate (25 Hz to 1600 Hz, doubling) that is at least the requested one.
+ * @param hz Requested rate in Hz
+ * @return Rate that was set in Hz
+ */
+float setBMI160DataRate(float hz);
+
 /**
  * Trigger automatic calibration of the accelerometer
- * Send auto-calibration command and wait for completion
+ * Send auto-calibration command and wait for completion, at most BMI160_FOC_TIMEOUT_MS
  */
 void autoCalibrateAccelerometer();
 
 /**
- * Average gyroscope calibration
- * Collect N samples and calculate the average bias for each axis
- * @param samples Number of samples to collect
- * @param delayMs Delay between samples in milliseconds
- * @return true if the calibration was successful
+ * Start a gyroscope calibration fed by addGyroCalibrationSample(), so it can run on the regular samples
+ * @param samples Number of samples to average
+ */
+void beginGyroCalibration(int samples);
+
+/**
+ * Check whether a calibration started by beginGyroCalibration() is waiting for samples
+ * @return true while it runs
+ */
+bool isGyroCalibrating();
+
+/**
+ * Add a raw gyroscope sample to the running calibration
+ * Ends it once enough samples were added: the bias is stored if no axis moved more than CALIB_MAX_SPREAD_DPS.
+ * @param gx_raw X value
+ * @param gy_raw Y value
+ * @param gz_raw Z value
+ * @return RUNNING while more samples are needed, then DONE or MOVED (the bias is kept)
+ */
+GyroCalibration addGyroCalibrationSample(int16_t gx_raw, int16_t gy_raw, int16_t gz_raw);
+
+/**
+ * Estimate the bias from the samples the running calibration has taken so far
+ * @param bias Output, deg/s in raw axis order
+ * @return false if no calibration is running, it has no sample yet, or an axis already moved more than
+ *         CALIB_MAX_SPREAD_DPS
  */
-bool calibrateGyro(int samples, int delayMs);
+bool estimateGyroBias(float bias[3]);
 
 /**
  * I2C scanner for debugging
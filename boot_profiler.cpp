@@ -0,0 +1,145 @@
+/**
+ * @file        boot_profiler.cpp
+ * @brief       Boot-time profiler for the Wiicon Remote project
+ *
+ * @details     Implementation of the phase table, the critical path and the report.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "boot_profiler.h"
+
+#include <esp_timer.h>
+
+BootProfiler& bootProfiler = BootProfiler::instance();
+
+BootProfiler& BootProfiler::instance() {
+    static BootProfiler instance;
+    return instance;
+}
+
+BootProfiler::BootProfiler() : _phases{}, _count(0), _lastMarkUs(0), _streamingUs(0), _complete(false) {}
+
+uint32_t BootProfiler::now() {
+    // Counts from the start of the application, unlike micros() it includes the time before setup()
+    return (uint32_t)esp_timer_get_time();
+}
+
+void BootProfiler::begin() {
+    _count      = 0;
+    _complete   = false;
+    _lastMarkUs = 0;
+    mark("runtime start");  // from boot until setup() runs
+}
+
+BootProfiler::Phase* BootProfiler::add(const char* name, uint32_t startUs, bool background) {
+    if (_count == BOOT_MAX_PHASES) {
+        Log::debug("Boot profiler: phase %s not recorded, table full", name);
+        return nullptr;
+    }
+    Phase& phase = _phases[_count++];
+    phase        = {name, startUs, 0, background, false};
+    return &phase;
+}
+
+void BootProfiler::mark(const char* phase) {
+    if (_complete) return;
+
+    uint32_t t     = now();
+    Phase*   entry = add(phase, _lastMarkUs, false);
+    if (entry) entry->endUs = t;
+    _lastMarkUs = t;
+}
+
+void BootProfiler::start(const char* phase) {
+    if (_complete) return;
+    add(phase, now(), true);
+}
+
+void BootProfiler::finish(const char* phase) {
+    if (_complete) return;
+
+    for (size_t i = 0; i < _count; ++i) {
+        Phase& entry = _phases[i];
+        if (entry.background && entry.endUs == 0 && strcmp(entry.name, phase) == 0) {
+            entry.endUs = now();
+            return;
+        }
+    }
+}
+
+void BootProfiler::complete() {
+    _streamingUs = now();
+    _complete    = true;
+
+    // The first sample waited for whichever ended last: setup() or a background phase it needed
+    const Phase* gate = nullptr;
+    for (size_t i = 0; i < _count; ++i) {
+        const Phase& phase = _phases[i];
+        if (phase.background && phase.endUs != 0 && phase.endUs > _lastMarkUs && (!gate || phase.endUs > gate->endUs)) {
+            gate = &phase;
+        }
+    }
+
+    // Setup phases up to where the gating background phase started, then that phase
+    for (size_t i = 0; i < _count; ++i) {
+        Phase& phase   = _phases[i];
+        phase.critical = gate ? (&phase == gate || (!phase.background && phase.endUs <= gate->startUs))
+                              : !phase.background;
+    }
+
+    uint32_t gateUs = gate ? gate->endUs : _lastMarkUs;
+    Log::info("Boot: streaming %lu ms after boot, critical path ends with %s at %lu ms (setup %lu ms)",
+              (unsigned long)(_streamingUs / 1000), gate ? gate->name : "setup", (unsigned long)(gateUs / 1000),
+              (unsigned long)(_lastMarkUs / 1000));
+    for (size_t i = 0; i < _count; ++i) {
+        const Phase& phase = _phases[i];
+        uint32_t     endUs = phase.endUs != 0 ? phase.endUs : _streamingUs;
+        Log::debug("Boot: %c %-20s %6lu ms  +%lu ms%s", phase.critical ? '*' : ' ', phase.name,
+                   (unsigned long)(phase.startUs / 1000), (unsigned long)((endUs - phase.startUs) / 1000),
+                   phase.endUs != 0 ? "" : " (running)");
+    }
+}
+
+void BootProfiler::report(Print& out) const {
+    if (!_complete) {
+        out.printf("Boot not complete, %u phases so far\n", (unsigned)_count);
+    } else {
+        out.printf("Streaming %lu ms after boot\n", (unsigned long)(_streamingUs / 1000));
+    }
+
+    out.printf("  %-20s %9s %9s\n", "phase", "start", "time");
+    for (size_t i = 0; i < _count; ++i) {
+        const Phase& phase = _phases[i];
+        out.printf("%c %-20s %6lu ms %6lu ms%s%s\n", phase.critical ? '*' : ' ', phase.name,
+                   (unsigned long)(phase.startUs / 1000),
+                   (unsigned long)(((phase.endUs != 0 ? phase.endUs : now()) - phase.startUs) / 1000),
+                   phase.background ? "  background" : "", phase.endUs != 0 ? "" : ", running");
+    }
+}
@@ -0,0 +1,147 @@
+/**
+ * @file        boot_profiler.h
+ * @brief       Boot-time profiler for the Wiicon Remote project
+ *
+ * @details     Timestamps each startup phase from boot to the first streamed sample, including the phases
+ *              that run in the background such as WiFi association, and reports which chain of phases held
+ *              the first sample back (the critical path).
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "logger.h"
+
+class BootProfiler {
+   public:
+    /**
+     * Get the singleton instance of the boot profiler
+     * @return Reference to the boot profiler instance
+     */
+    static BootProfiler& instance();
+
+    /**
+     * Start profiling, first thing in setup()
+     * The time before it (bootloader and runtime start) is recorded as the first phase.
+     */
+    void begin();
+
+    /**
+     * End a phase of setup() at the current time, the phase started when the previous one ended
+     * @param phase Name of the phase, must be a string literal
+     */
+    void mark(const char* phase);
+
+    /**
+     * Start a phase that runs in the background while setup() goes on
+     * @param phase Name of the phase, must be a string literal
+     */
+    void start(const char* phase);
+
+    /**
+     * End a background phase, does nothing if it already ended or the boot profile is complete
+     * @param phase Name given to start()
+     */
+    void finish(const char* phase);
+
+    /**
+     * Record the first streamed sample, which completes the profile and logs the summary
+     * Cheap once complete, so it can be called for every sample.
+     */
+    void markStreaming() {
+        if (!_complete) complete();
+    }
+
+    /**
+     * Check whether the first sample was streamed
+     * @return true if the profile is complete
+     */
+    bool isComplete() const { return _complete; }
+
+    /**
+     * Print every phase with its start and duration, critical path phases marked with '*'
+     * @param out Output
+     */
+    void report(Print& out) const;
+
+    BootProfiler(const BootProfiler&)            = delete; /**< Delete copy constructor */
+    BootProfiler& operator=(const BootProfiler&) = delete; /**< Delete assignment operator */
+
+   private:
+    /**
+     * A startup phase, times in microseconds since boot
+     */
+    struct Phase {
+        const char* name;       /**< Phase name */
+        uint32_t    startUs;    /**< Start time */
+        uint32_t    endUs;      /**< End time, 0 while running */
+        bool        background; /**< Whether it ran alongside setup() */
+        bool        critical;   /**< Whether it is on the critical path */
+    };
+
+    /**
+     * Constructor
+     */
+    BootProfiler();
+    ~BootProfiler() = default;
+
+    /**
+     * Add a phase
+     * @return The phase, nullptr if the table is full
+     */
+    Phase* add(const char* name, uint32_t startUs, bool background);
+
+    /**
+     * Stamp the first sample, find the critical path and log the summary
+     */
+    void complete();
+
+    /**
+     * Get the time since boot
+     * @return Microseconds since boot
+     */
+    static uint32_t now();
+
+    Phase    _phases[BOOT_MAX_PHASES]; /**< Recorded phases, in start order */
+    size_t   _count;                   /**< Number of phases */
+    uint32_t _lastMarkUs;              /**< End of the last setup() phase */
+    uint32_t _streamingUs;             /**< Time of the first streamed sample */
+    bool     _complete;                /**< Whether the first sample was streamed */
+};
+
+/**
+ * Global instance of the boot profiler
+ */
+extern BootProfiler& bootProfiler;
+
+#endif  // BOOT_PROFILER_H
@@ -48,6 +48,9 @@ bool          ButtonManager::_longPressHandled = false;
 void ButtonManager::begin() {
     pinMode(BUTTON_PIN, INPUT_PULLUP);
     _lastState = digitalRead(BUTTON_PIN);
+
+    // A press still held from the wake-up counts as handled, so it neither sends the device back to sleep nor clicks
+    _longPressHandled = _lastState == LOW;
     Log::info("Button manager initialized on pin %d", BUTTON_PIN);
 }
 
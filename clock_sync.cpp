@@ -0,0 +1,146 @@
+/**
+ * @file        clock_sync.cpp
+ * @brief       Background clock synchronisation implementation for the Wiicon Remote project
+ *
+ * @details     Implements the ClockSync class declared in clock_sync.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "clock_sync.h"
+
+ClockSync& clockSync = ClockSync::instance();
+
+ClockSync& ClockSync::instance() {
+    static ClockSync instance;
+    return instance;
+}
+
+ClockSync::ClockSync()
+    : _initialized(false),
+      _serverPort(0),
+      _locked(false),
+      _sequence(0),
+      _unanswered(0),
+      _exchanges(0),
+      _lastPing(0),
+      _lastLog(0) {}
+
+bool ClockSync::begin() {
+    if (_initialized) {
+        return true;
+    }
+
+    if (!oscManager.isReady()) {
+        return false;
+    }
+
+    if (!_udp.begin(CLOCK_SYNC_LOCAL_PORT)) {
+        Log::error("Clock sync: failed to bind port %d", CLOCK_SYNC_LOCAL_PORT);
+        return false;
+    }
+
+    if (CLOCK_SYNC_SERVER_IP[0] != '\0' && _server.fromString(CLOCK_SYNC_SERVER_IP)) {
+        _serverPort = OSC_TARGET_PORT;
+        _locked     = true;
+    }
+
+    _initialized = true;
+    Log::info("Clock sync initialized on port %d", CLOCK_SYNC_LOCAL_PORT);
+    return true;
+}
+
+void ClockSync::loop() {
+    if (!begin()) return;
+
+    receivePongs();
+
+    // Ping fast until a first estimate is available, then keep it fresh in the background
+    unsigned long interval = _exchanges < CLOCK_WINDOW / 4 ? CLOCK_SYNC_FAST_INTERVAL_MS : CLOCK_SYNC_INTERVAL_MS;
+    unsigned long now      = millis();
+    if (now - _lastPing >= interval) {
+        _lastPing = now;
+        sendPing();
+    }
+
+    if (isSynced() && now - _lastLog >= CLOCK_SYNC_LOG_INTERVAL_MS) {
+        _lastLog = now;
+        Log::debug("Clock sync: offset %lld us, drift %.2f ppm, min rtt %lld us", (long long)_estimator.offset(),
+                   _estimator.driftPpm(), (long long)_estimator.minRtt());
+    }
+}
+
+void ClockSync::receivePongs() {
+    int length;
+    while ((length = _udp.parsePacket()) > 0) {
+        uint8_t       packet[CLOCK_MAX_SIZE];
+        ClockExchange exchange;
+
+        int read = _udp.read(packet, sizeof(packet));
+        if (read <= 0 || !clockPongDecode(packet, (size_t)read, &exchange)) continue;
+
+        // Only the reply to the latest ping has a meaningful t4
+        uint32_t t4 = micros();
+        if (exchange.deviceId != oscManager.getDeviceId() || exchange.sequence != _sequence) continue;
+
+        if (!_locked) {
+            _server     = _udp.remoteIP();
+            _serverPort = _udp.remotePort();
+            _locked     = true;
+            Log::info("Clock sync: reference host %s:%d", _server.toString().c_str(), _serverPort);
+        } else if (_udp.remoteIP() != _server) {
+            continue;
+        }
+
+        _unanswered = 0;
+        _exchanges++;
+        _estimator.addExchange(exchange, t4);
+    }
+}
+
+void ClockSync::sendPing() {
+    // Fall back to the primary destination when the reference host stops answering
+    if (_locked && _unanswered >= CLOCK_SYNC_MAX_UNANSWERED && CLOCK_SYNC_SERVER_IP[0] == '\0') {
+        Log::warning("Clock sync: reference host %s stopped answering", _server.toString().c_str());
+        _locked = false;
+    }
+
+    const OscDestination& primary = oscManager.getPrimaryDestination();
+    IPAddress             ip      = _locked ? _server : primary.ip;
+    uint16_t              port    = _locked ? _serverPort : primary.port;
+
+    uint8_t packet[CLOCK_MAX_SIZE];
+    size_t  length = clockPingEncode(oscManager.getDeviceId(), ++_sequence, micros(), packet);
+
+    _udp.beginPacket(ip, port);
+    _udp.write(packet, length);
+    _udp.endPacket();
+
+    if (_unanswered < UINT8_MAX) _unanswered++;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file        clock_sync.h
+ * @brief       Background clock synchronisation for the Wiicon Remote project
+ *
+ * @details     Periodically pings a host running the sync responder (wiicon_clock.h) and
+ *              keeps an offset and drift estimate, so outgoing timestamps can be expressed
+ *              in host time. Pings go to the primary OSC destination; when that is a
+ *              multicast group, the first host that answers becomes the reference.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef CLOCK_SYNC_H
+#define CLOCK_SYNC_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+#include "config.h"
+#include "logger.h"
+#include "osc_manager.h"
+#include "wiicon_clock.h"
+
+class ClockSync {
+   public:
+    /**
+     * Get the singleton instance of the clock synchronisation
+     * @return Reference to the clock synchronisation instance
+     */
+    static ClockSync& instance();
+
+    /**
+     * Bind the sync port
+     * @return true if initialization was successful
+     */
+    bool begin();
+
+    /**
+     * Read pending replies and send the next ping when due
+     * Never blocks.
+     */
+    void loop();
+
+    /**
+     * Check whether host time is available
+     * @return true once an exchange has been accepted
+     */
+    bool isSynced() const { return _estimator.synced(); }
+
+    /**
+     * Convert a device time to host time
+     * @param device Device micros()
+     * @return Host time in microseconds since the Unix epoch
+     */
+    int64_t toHostMicros(uint32_t device) const { return _estimator.toHost(device); }
+
+    /**
+     * Get the estimator for diagnostics
+     * @return Offset and drift estimator
+     */
+    const ClockEstimator& getEstimator() const { return _estimator; }
+
+    ClockSync(const ClockSync&)            = delete;
+    ClockSync& operator=(const ClockSync&) = delete;
+
+   private:
+    /**
+     * Constructor
+     */
+    ClockSync();
+    ~ClockSync() = default;
+
+    /**
+     * Read every pending pong from the sync port
+     */
+    void receivePongs();
+
+    /**
+     * Send a ping to the reference host, or to the primary destination if none is locked yet
+     */
+    void sendPing();
+
+    WiFiUDP        _udp;         /**< Socket bound to CLOCK_SYNC_LOCAL_PORT */
+    ClockEstimator _estimator;   /**< Offset and drift estimate */
+    bool           _initialized; /**< Whether the sync port is bound */
+    IPAddress      _server;      /**< Reference host, valid when _locked */
+    uint16_t       _serverPort;  /**< Reference host port */
+    bool           _locked;      /**< Whether a reference host has answered */
+    uint16_t       _sequence;    /**< Sequence number of the last ping */
+    uint8_t        _unanswered;  /**< Pings sent since the last pong */
+    uint32_t       _exchanges;   /**< Pongs received since boot */
+    unsigned long  _lastPing;    /**< Time of the last ping (millis) */
+    unsigned long  _lastLog;     /**< Time of the last estimate log (millis) */
+};
+
+/**
+ * Global instance of the clock synchronisation
+ */
+extern ClockSync& clockSync;
+
+#endif  // CLOCK_SYNC_H
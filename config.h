@@ -38,19 +38,41 @@
 #include <Arduino.h>
 
 #include "driver/gpio.h"
-
-const uint32_t SERIAL_BAUD = 115200;
+#include "esp_wifi_types.h"
 
 // DATA MODE
 #define DATA_SERIAL_LOG 0
 
+// SERIAL OSC (wired mode, tools/wiicon_serial)
+#define SERIAL_OSC 0 /**< Send SLIP-framed OSC over USB serial, logs become /wiicon/log messages */
+
+#if DATA_SERIAL_LOG && SERIAL_OSC
+#error "DATA_SERIAL_LOG and SERIAL_OSC both write to the serial port"
+#endif
+
+// Native USB ignores the baud rate, a USB-UART bridge needs the faster rate for serial OSC
+const uint32_t SERIAL_BAUD = SERIAL_OSC ? 921600 : 115200;
+
+// WIFI
+const bool   WIFI_FAST_RECONNECT  = true; /**< Reconnect to the last access point, channel and lease after sleep */
+const time_t WIFI_LEASE_MAX_AGE_S = 3600; /**< Cached lease older than this is not reused, well inside usual leases */
+
+const unsigned long WIFI_RETRY_MIN_MS  = 500;   /**< First wait after a failed attempt or a lost connection */
+const unsigned long WIFI_RETRY_MAX_MS  = 30000; /**< Longest wait between attempts */
+const uint8_t       WIFI_BOOT_ATTEMPTS = 3;     /**< Failed attempts before the portal opens, if never connected */
+
+const size_t        WIFI_SCAN_MAX_RESULTS = 24;    /**< Networks kept from a scan, the strongest first */
+const unsigned long WIFI_SCAN_MAX_AGE_MS  = 10000; /**< A /scan request after this starts a new background scan */
+
 // BUTTON MANAGER
 const gpio_num_t BUTTON_PIN = GPIO_NUM_3;
 
 // BMI160 SENSOR
-const int     SDA_PIN     = 4;
-const int     SCL_PIN     = 2;
-const uint8_t BMI160_ADDR = 0x68;
+const int      SDA_PIN          = 4;
+const int      SCL_PIN          = 2;
+const uint8_t  BMI160_ADDR      = 0x68;
+const uint32_t I2C_CLOCK_HZ     = 400000; /**< The BMI160 supports fast mode, a sample is read in a quarter the time */
+const bool     I2C_SCAN_AT_BOOT = false;  /**< List the devices on the I2C bus at boot, to check the wiring */
 enum class DataMode { RAW, FILTERED };
 
 // SLEEP MANAGER
@@ -59,7 +81,9 @@ const int SLEEP_DEBOUNCE_MS = 1000;
 // TIMING CONSTANTS
 const int DELAY_LED_FEEDBACK_MS   = 200;  /**< LED feedback duration after mode toggle */
 const int DELAY_BEFORE_RESTART_MS = 1000; /**< Delay before device restart */
-const int DELAY_STARTUP_SAFETY_MS = 3000; /**< Safety delay at startup to prevent immediate sleep */
+
+// BOOT PROFILER
+const size_t BOOT_MAX_PHASES = 12; /**< Startup phases recorded, see the "boot" serial command */
 
 // LED STATUS INDICATOR
 const int  LED_PIN_R            = 18;
@@ -68,21 +92,153 @@ const int  LED_PIN_B            = 20;
 const bool LED_RGB_COMMON_ANODE = false;
 
 // OSC MANAGER
-constexpr const char* OSC_TARGET_IP     = "192.168.1.255";
-constexpr int         OSC_TARGET_PORT   = 9000;
-constexpr const char* OSC_ADDRESS_EULER = "/wiicon/euler";
+constexpr const char* OSC_TARGET_IP     = "239.255.0.90"; /**< Target when none is configured (empty = broadcast) */
+constexpr int         OSC_TARGET_PORT   = 9000;           /**< Target port when none is configured */
+constexpr char OSC_ADDRESS_EULER[] = "/wiicon/euler";
+constexpr char OSC_ADDRESS_ACCEL[] = "/wiicon/accel";
+constexpr char OSC_ADDRESS_GYRO[]  = "/wiicon/gyro";
+
+// OSC RECEIVER
+const uint16_t OSC_RECEIVE_PORT         = 8000;    /**< Port for remote control (/wiicon/set/..., /wiicon/get/...) */
+const size_t   OSC_RECEIVE_BUFFER_SIZE  = 128;     /**< Larger datagrams are dropped */
+const int      OSC_RECEIVE_MAX_PER_LOOP = 4;       /**< Messages handled per loop iteration */
+const float    SAMPLE_RATE_MIN_HZ       = 1.0f;    /**< Lowest rate accepted by /wiicon/set/rate, other than 0 */
+const float    SAMPLE_RATE_MAX_HZ       = 1000.0f; /**< Highest rate accepted by /wiicon/set/rate */
+
+// OSC TRANSPORT
+#define OSC_USE_LWIP_TX 0 /**< Encode into preallocated lwIP pbufs and send with udp_sendto() instead of WiFiUDP */
+
+const unsigned long OSC_STATS_INTERVAL_MS = 5000; /**< Interval between OSC send statistics logs */
+
+// OSC OFFLINE POLICY
+const size_t OSC_OFFLINE_BUFFER    = 0; /**< Samples held while no transport is ready, oldest dropped (0 = drop all) */
+const size_t OSC_OFFLINE_FLUSH_MAX = 4; /**< Held samples sent per new sample once a transport is ready */
+
+// OSC RATE CONTROL
+const bool          OSC_ADAPTIVE_RATE        = true;  /**< Lower the output rate when the network is congested */
+const unsigned long OSC_RATE_WINDOW_MS       = 250;   /**< Evaluation window of the rate controller */
+const float         OSC_RATE_MIN_HZ          = 10.0f; /**< Lowest output rate under congestion */
+const float         OSC_RATE_INCREASE_HZ     = 10.0f; /**< Additive increase per clean window */
+const float         OSC_RATE_DECREASE        = 0.5f;  /**< Multiplicative decrease on congestion */
+const uint32_t      OSC_RATE_SEND_US_LIMIT   = 2000;  /**< Average time per send that counts as backpressure */
+const float         OSC_RATE_HOST_LOSS_LIMIT = 0.05f; /**< Host-reported loss that counts as congestion */
+
+// OSC DESTINATIONS
+const uint8_t OSC_STREAM_EULER = 1 << 0;                             /**< Euler angles */
+const uint8_t OSC_STREAM_ACCEL = 1 << 1;                             /**< Raw accelerometer */
+const uint8_t OSC_STREAM_GYRO  = 1 << 2;                             /**< Raw gyroscope */
+const uint8_t OSC_STREAM_FRAME = 1 << 3;                             /**< Compact binary frame (wiicon_frame.h) */
+const uint8_t OSC_STREAM_RAW   = OSC_STREAM_ACCEL | OSC_STREAM_GYRO; /**< Raw accelerometer and gyroscope */
+const uint8_t OSC_STREAM_MODE  = 1 << 7;                             /**< Follow the data mode set by the button */
+
+const size_t  OSC_MAX_DESTINATIONS = 4;               /**< Primary (portal) destination plus extra destinations */
+const uint8_t OSC_PRIMARY_STREAMS  = OSC_STREAM_MODE; /**< Streams sent to the portal destination */
+const size_t  OSC_FRAME_REDUNDANCY = 0; /**< Previous frames repeated in every frame datagram (0 = off, max 4) */
+const uint8_t SERIAL_OSC_STREAMS   = OSC_STREAM_MODE; /**< OSC streams sent over serial with SERIAL_OSC */
+
+struct OscDestinationConfig {
+    const char* ip;         /**< Target IP address, nullptr terminates the table */
+    uint16_t    port;       /**< Target port */
+    uint8_t     streams;    /**< Bitmask of OSC_STREAM_* values */
+    uint8_t     decimation; /**< Send every Nth sample (1 = full rate) */
+};
+
+/**
+ * Extra destinations in addition to the one configured in the portal
+ * Each destination receives its streams from the same encoded buffer, e.g.:
+ * {"192.168.1.20", 9001, OSC_STREAM_EULER, 2},  // audio machine, Euler at half rate
+ * {"192.168.1.30", 9002, OSC_STREAM_RAW, 1},    // visuals machine, accel/gyro at full rate
+ */
+constexpr OscDestinationConfig OSC_EXTRA_DESTINATIONS[] = {
+    {nullptr, 0, 0, 0},
+};
+
+// WEBSOCKET STREAM (station mode, browser clients)
+const bool     WS_ENABLED     = true;  /**< Serve binary frames on ws://<device>/ws */
+const uint16_t WS_PORT        = 80;    /**< Web server port in station mode */
+constexpr char WS_PATH[]      = "/ws"; /**< WebSocket endpoint */
+const float    WS_RATE_HZ     = 60.0f; /**< Frames per second pushed to each client */
+const float    WS_RATE_MIN_HZ = 1.0f;  /**< Lowest rate accepted by setRate() */
+const size_t   WS_MAX_CLIENTS = 4;     /**< Further clients are refused */
+const size_t   WS_QUEUE_DEPTH = 4;     /**< Frames queued per client, the oldest is dropped when full */
+
+// PERFORMANCE PROFILES
+struct PerformanceProfile {
+    const char*    name;       /**< Name used by /wiicon/set/profile and stored in NVS */
+    wifi_ps_type_t wifiSleep;  /**< Modem power save, adds up to a DTIM (MIN) or listen interval (MAX) of latency */
+    float          txPowerDbm; /**< Transmit power */
+    uint32_t       cpuMhz;     /**< CPU frequency */
+    float          sensorHz;   /**< BMI160 output data rate, rounded up to a supported rate */
+    float          outputHz;   /**< Samples sent per second */
+    float          currentMa;  /**< Estimated average draw of the board, for comparison only */
+};
+
+/**
+ * Profiles selectable at runtime, the current draw is an estimate for an ESP32-C6 board with the BMI160
+ */
+constexpr PerformanceProfile PERFORMANCE_PROFILES[] = {
+    {"stage-low-latency", WIFI_PS_NONE, 19.5f, 160, 400.0f, 200.0f, 95.0f},
+    {"balanced", WIFI_PS_MIN_MODEM, 19.5f, 160, 100.0f, 100.0f, 45.0f},
+    {"installation-battery", WIFI_PS_MAX_MODEM, 8.5f, 80, 25.0f, 25.0f, 20.0f},
+};
+constexpr char PROFILE_DEFAULT[] = "balanced"; /**< Profile used until another one is selected */
+
+// DASHBOARD (station mode, http://<device>/, served by the WebSocket web server)
+const bool     DASHBOARD_ENABLED     = true; /**< Serve the telemetry page and its /events stream */
+const float    DASHBOARD_RATE_HZ     = 5.0f; /**< Telemetry updates per second */
+const uint32_t DASHBOARD_MAX_BPS     = 2048; /**< Bytes per second across all dashboard clients */
+const size_t   DASHBOARD_MAX_CLIENTS = 2;    /**< Further dashboards are refused */
+const size_t   DASHBOARD_MAX_QUEUED  = 2;    /**< Updates are skipped while clients have more than this queued */
+
+static_assert(!DASHBOARD_ENABLED || WS_ENABLED, "The dashboard is served by the WebSocket web server");
+
+// MDNS / DNS-SD (station mode, wiicon-<device id>.local)
+const bool          MDNS_ENABLED            = true;           /**< Advertise the controller as an _osc._udp service */
+const bool          MDNS_DISCOVER_SINKS     = true;           /**< Stream to a found receiver while no OSC IP is set */
+constexpr char      MDNS_SINK_SERVICE[]     = "_wiicon-sink"; /**< Service type receivers advertise (over _udp) */
+const unsigned long MDNS_BROWSE_INTERVAL_MS = 15000;          /**< Time between two browses for receivers */
+const unsigned long MDNS_BROWSE_WINDOW_MS   = 1000;           /**< Answers to a browse are collected for this long */
+const uint8_t       MDNS_SINK_MISSES        = 2;              /**< Browses without the receiver before it is dropped */
+const size_t        MDNS_MAX_SINKS          = 4;              /**< Answers kept per browse */
+
+// WEB ASSETS (portal and dashboard pages, built by tools/wiicon_assets)
+#define WEB_ASSETS_EMBEDDED 0 /**< Serve the pages from flash (web_assets_data.h) instead of LittleFS */
+
+const uint32_t WEB_ASSET_MAX_AGE_S = 86400; /**< Browser cache lifetime of styles and scripts, pages revalidate */
+
+// SETTINGS (settings_registry.h, changed from the dashboard, OSC or the serial console)
+const unsigned long SETTINGS_SAVE_DELAY_MS     = 2000;  /**< Changes are written once none came for this long */
+const unsigned long SETTINGS_SAVE_MAX_DELAY_MS = 10000; /**< Longest a change waits while further ones keep coming */
+const bool          SETTINGS_SERIAL_CONSOLE    = true;  /**< Accept get/set/list/save lines on the serial port */
+const size_t        SETTINGS_CONSOLE_LINE_SIZE = 128;   /**< Longer console lines are dropped */
+
+// EVENT CHANNEL
+const uint16_t EVENT_LOCAL_PORT = 9010; /**< Port events are sent from and acknowledgements are received on */
+
+// CLOCK SYNC
+constexpr const char* CLOCK_SYNC_SERVER_IP        = "";    /**< Reference host (empty = first host that answers) */
+const uint16_t        CLOCK_SYNC_LOCAL_PORT       = 9011;  /**< Port pings are sent from and replies received on */
+const unsigned long   CLOCK_SYNC_INTERVAL_MS      = 1000;  /**< Ping interval once synced */
+const unsigned long   CLOCK_SYNC_FAST_INTERVAL_MS = 100;   /**< Ping interval while acquiring */
+const unsigned long   CLOCK_SYNC_LOG_INTERVAL_MS  = 10000; /**< Interval between estimate logs */
+const uint8_t         CLOCK_SYNC_MAX_UNANSWERED   = 10;    /**< Pings without reply before the reference is dropped */
 
-// DATA MAPPING
+// DATA MAPPING (boot defaults, the settings registry changes them at runtime)
 #define SWAP_ROLL_YAW 0
+#define ACCEL_AXES    "+x+y+z" /**< Sign and source axis of the mapped X, Y and Z accelerometer axes */
+#define GYRO_AXES     "+x+y+z" /**< Sign and source axis of the mapped X, Y and Z gyroscope axes */
 
-extern int accelMap[3];
-extern int accelSign[3];
-extern int gyroMap[3];
-extern int gyroSign[3];
+extern bool swapRollYaw;
+extern int  accelMap[3];
+extern int  accelSign[3];
+extern int  gyroMap[3];
+extern int  gyroSign[3];
 
-const float ACC_LSB_PER_G   = 16384.0f; /**< ±2g => LSB/g ≈ 16384 */
-const float GYR_LSB_PER_DPS = 16.4f;    /**< ±2000 dps => LSB/(deg/s) ≈ 16.4 */
-const int   CALIB_SAMPLES   = 200;
-const int   CALIB_DELAY_MS  = 5;
+const float ACC_LSB_PER_G        = 16384.0f; /**< ±2g => LSB/g ≈ 16384 */
+const float GYR_LSB_PER_DPS      = 16.4f;    /**< ±2000 dps => LSB/(deg/s) ≈ 16.4 */
+const float FILTER_BETA          = 0.1f;     /**< Madgwick filter gain */
+const int   CALIB_SAMPLES        = 200;
+const float CALIB_MAX_SPREAD_DPS = 2.0f;     /**< The gyroscope calibration is discarded if an axis moved more */
+const int   CALIB_MAX_RESTARTS   = 5;        /**< A calibration asked for by the user gives up after this many */
 
 #endif  // CONFIG_H
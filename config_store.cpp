@@ -0,0 +1,167 @@
+/**
+ * @file        config_store.cpp
+ * @brief       Persistent configuration record for the Wiicon Remote project
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "config_store.h"
+
+#include <LittleFS.h>
+#include <esp_rom_crc.h>
+
+#include "helpers.h"
+
+ConfigStore& configStore = ConfigStore::instance();
+
+namespace {
+
+const char* const LEGACY_OSC_PORT_PATH = "/osc_port.txt"; /**< Only numeric file of earlier firmware */
+
+uint32_t configCrc(const uint8_t* data, size_t length) { return esp_rom_crc32_le(0, data, length); }
+
+}  // namespace
+
+ConfigStore& ConfigStore::instance() {
+    static ConfigStore instance;
+    return instance;
+}
+
+ConfigStore::ConfigStore() : _config{}, _initialized(false) {}
+
+bool ConfigStore::begin() {
+    if (_initialized) return _config.ssid[0] != '\0';
+    _initialized = true;
+
+    if (load()) return true;
+    return migrate();
+}
+
+bool ConfigStore::save(const StoredConfig& config) {
+    _config = config;
+    return write();
+}
+
+bool ConfigStore::clear() {
+    _config = StoredConfig{};
+    return write();
+}
+
+bool ConfigStore::load() {
+    static_assert(sizeof(RecordHeader) + sizeof(StoredConfig) <= RECORD_SIZE, "StoredConfig outgrew RECORD_SIZE");
+
+    Preferences prefs;
+    if (!prefs.begin(NAMESPACE, true)) return false;
+
+    uint8_t record[RECORD_SIZE];
+    size_t  length = prefs.isKey(KEY) ? prefs.getBytes(KEY, record, sizeof(record)) : 0;
+    prefs.end();
+
+    if (length == 0) return false;
+
+    RecordHeader header;
+    memcpy(&header, record, sizeof(header));
+
+    if (length < sizeof(header) || header.size != length - sizeof(header)) {
+        Log::error("Stored configuration is truncated, using defaults");
+        return false;
+    }
+    if (configCrc(record + sizeof(header), header.size) != header.crc) {
+        Log::error("Stored configuration failed its CRC check, using defaults");
+        return false;
+    }
+    if (header.version != VERSION) {
+        Log::error("Stored configuration has version %d, expected %d, using defaults", header.version, VERSION);
+        return false;
+    }
+
+    // Older records are shorter and newer ones longer, the fields both know about are kept
+    memcpy(&_config, record + sizeof(header), header.size < sizeof(_config) ? header.size : sizeof(_config));
+    Log::info("Configuration loaded (%d bytes)", header.size);
+    return true;
+}
+
+bool ConfigStore::migrate() {
+    const struct {
+        const char* path;
+        char*       field;
+        size_t      size;
+    } FILES[] = {
+        {"/ssid.txt", _config.ssid, sizeof(_config.ssid)},
+        {"/password.txt", _config.password, sizeof(_config.password)},
+        {"/ip.txt", _config.ip, sizeof(_config.ip)},
+        {"/gateway.txt", _config.gateway, sizeof(_config.gateway)},
+        {"/osc_ip.txt", _config.oscIP, sizeof(_config.oscIP)},
+    };
+
+    if (!LittleFS.exists(FILES[0].path)) return false;
+
+    for (const auto& file : FILES) {
+        if (LittleFS.exists(file.path)) strlcpy(file.field, readFile(LittleFS, file.path).c_str(), file.size);
+    }
+    if (LittleFS.exists(LEGACY_OSC_PORT_PATH)) {
+        long port       = readFile(LittleFS, LEGACY_OSC_PORT_PATH).toInt();
+        _config.oscPort = (port > 0 && port <= 65535) ? (uint16_t)port : 0;
+    }
+
+    // The files stay until the record is safely written
+    if (!write()) return _config.ssid[0] != '\0';
+
+    for (const auto& file : FILES) LittleFS.remove(file.path);
+    LittleFS.remove(LEGACY_OSC_PORT_PATH);
+
+    Log::info("Configuration migrated from LittleFS to NVS");
+    return _config.ssid[0] != '\0';
+}
+
+bool ConfigStore::write() {
+    uint8_t      record[sizeof(RecordHeader) + sizeof(StoredConfig)];
+    RecordHeader header = {VERSION, (uint16_t)sizeof(StoredConfig), 0};
+
+    header.crc = configCrc((const uint8_t*)&_config, sizeof(_config));
+    memcpy(record, &header, sizeof(header));
+    memcpy(record + sizeof(header), &_config, sizeof(_config));
+
+    // NVS writes the new blob before it erases the old one, a reset in between keeps the old record
+    Preferences prefs;
+    bool        written = false;
+
+    if (prefs.begin(NAMESPACE, false)) {
+        written = prefs.putBytes(KEY, record, sizeof(record)) == sizeof(record);
+        prefs.end();
+    }
+
+    if (!written) {
+        Log::error("Failed to write configuration");
+        return false;
+    }
+
+    Log::debug("Configuration written (%d bytes)", (int)sizeof(record));
+    return true;
+}
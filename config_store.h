@@ -0,0 +1,169 @@
+/**
+ * @file        config_store.h
+ * @brief       Persistent configuration record for the Wiicon Remote project
+ *
+ * @details     Keeps the settings (network credentials, static IP, OSC target and the runtime
+ *              settings of settings_registry.h) in one versioned, CRC-protected record in NVS. The record is read once at boot and
+ *              always rewritten whole, so a reset during a save leaves either the old or the
+ *              new record. The per-setting LittleFS text files of earlier firmware are
+ *              migrated on the first boot.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+#include "config.h"
+#include "logger.h"
+
+/**
+ * Settings kept across boots
+ * Append new fields at the end: a record written by older firmware is shorter, and the fields it lacks keep the
+ * defaults given here when it is loaded.
+ */
+struct StoredConfig {
+    char     ssid[33];     /**< Network name, empty = not configured */
+    char     password[65]; /**< Passphrase */
+    char     ip[16];       /**< Static IP, empty = DHCP */
+    char     gateway[16];  /**< Gateway of the static IP */
+    char     oscIP[16];    /**< OSC target IP, empty = OSC_TARGET_IP */
+    uint16_t oscPort;      /**< OSC target port, 0 = OSC_TARGET_PORT */
+    char     profile[24];  /**< Performance profile name, empty = PROFILE_DEFAULT */
+
+    float    beta         = FILTER_BETA;   /**< Madgwick filter gain */
+    float    wsRateHz     = WS_RATE_HZ;    /**< Rate frames are pushed to WebSocket clients */
+    uint16_t calibSamples = CALIB_SAMPLES; /**< Samples averaged by the gyroscope calibration */
+    bool     swapRollYaw  = SWAP_ROLL_YAW; /**< Send yaw as roll and roll as yaw */
+    char     accelAxes[8] = ACCEL_AXES;    /**< Accelerometer mapping, e.g. "+x-z+y" */
+    char     gyroAxes[8]  = GYRO_AXES;     /**< Gyroscope mapping */
+};
+
+class ConfigStore {
+   public:
+    /**
+     * Get the singleton instance of the configuration store
+     * @return Reference to the configuration store instance
+     */
+    static ConfigStore& instance();
+
+    /**
+     * Load the record, migrating the LittleFS files of earlier firmware if there is none yet
+     * Call after LittleFS is mounted.
+     * @return true if a stored configuration was found
+     */
+    bool begin();
+
+    /**
+     * Get the current configuration
+     * @return Configuration, all defaults if nothing was stored
+     */
+    const StoredConfig& get() const { return _config; }
+
+    /**
+     * Get the configuration for changes in place, written by the next commit()
+     * Only the settings registry changes it this way, from the main loop.
+     * @return Configuration
+     */
+    StoredConfig& edit() { return _config; }
+
+    /**
+     * Write the current configuration as one record
+     * @return true if the record was written
+     */
+    bool commit() { return write(); }
+
+    /**
+     * Replace the configuration and write it as one record
+     * @param config New configuration
+     * @return true if the record was written
+     */
+    bool save(const StoredConfig& config);
+
+    /**
+     * Reset every setting to its default and write the record
+     * @return true if the record was written
+     */
+    bool clear();
+
+    ConfigStore(const ConfigStore&)            = delete; /**< Delete copy constructor */
+    ConfigStore& operator=(const ConfigStore&) = delete; /**< Delete assignment operator */
+
+   private:
+    /**
+     * Header stored in front of the configuration
+     */
+    struct RecordHeader {
+        uint16_t version; /**< Layout version, bumped when an existing field changes */
+        uint16_t size;    /**< Size of the configuration that follows */
+        uint32_t crc;     /**< CRC-32 of the configuration */
+    };
+
+    /**
+     * Constructor
+     */
+    ConfigStore();
+    ~ConfigStore() = default;
+
+    /**
+     * Read and verify the record
+     * @return true if a valid record was loaded
+     */
+    bool load();
+
+    /**
+     * Import the per-setting text files of earlier firmware and remove them once the record is written
+     * @return true if files were found
+     */
+    bool migrate();
+
+    /**
+     * Write the current configuration as one record
+     * @return true if written
+     */
+    bool write();
+
+    static constexpr uint16_t    VERSION     = 1;        /**< Current layout version */
+    static constexpr size_t      RECORD_SIZE = 256;      /**< Largest record accepted, leaves room for new fields */
+    static constexpr const char* NAMESPACE   = "wiicon"; /**< NVS namespace */
+    static constexpr const char* KEY         = "config"; /**< NVS key of the record */
+
+    StoredConfig _config;      /**< Current configuration */
+    bool         _initialized; /**< Whether begin() has run */
+};
+
+/**
+ * Global instance of the configuration store
+ */
+extern ConfigStore& configStore;
+
+#endif  // CONFIG_STORE_H
@@ -0,0 +1,179 @@
+/**
+ * @file        dashboard.cpp
+ * @brief       Live telemetry dashboard for the Wiicon Remote project
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "dashboard.h"
+
+#include <WiFi.h>
+
+#include "bmi160.h"
+#include "madgwick.h"
+#include "osc_manager.h"
+#include "profile_manager.h"
+#include "settings_registry.h"
+#include "web_assets.h"
+#include "websocket_transport.h"
+
+Dashboard& dashboard = Dashboard::instance();
+
+Dashboard& Dashboard::instance() {
+    static Dashboard instance;
+    return instance;
+}
+
+Dashboard::Dashboard()
+    : _events("/events"),
+      _started(false),
+      _intervalUs((uint32_t)(1000000.0f / DASHBOARD_RATE_HZ)),
+      _nextUpdateUs(0),
+      _lastUpdateUs(0),
+      _budget(0.0f),
+      _lastPackets(0),
+      _updateId(0),
+      _skipped(0) {}
+
+bool Dashboard::begin() {
+    if (_started) return true;
+    if (!DASHBOARD_ENABLED || !webSocketTransport.isStarted()) return false;
+
+    AsyncWebServer& server = webSocketTransport.getServer();
+
+    server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) { sendWebAsset(request, "/dashboard.html"); });
+    server.on("/style.css", HTTP_GET, [](AsyncWebServerRequest* request) { sendWebAsset(request, "/style.css"); });
+    server.on("/settings", HTTP_GET, [](AsyncWebServerRequest* request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        response->addHeader("Cache-Control", "no-store");
+        settingsRegistry.printJson(*response);
+        request->send(response);
+    });
+    server.on("/settings", HTTP_POST, handleSettings);
+
+    _events.onConnect([this](AsyncEventSourceClient* client) {
+        if (_events.count() > DASHBOARD_MAX_CLIENTS) {
+            Log::warning("Dashboard: refusing client, %d connected", (int)DASHBOARD_MAX_CLIENTS);
+            client->close();
+            return;
+        }
+        Log::info("Dashboard client connected");
+    });
+    server.addHandler(&_events);
+
+    _started      = true;
+    _lastUpdateUs = micros();
+    _nextUpdateUs = _lastUpdateUs;
+    _lastPackets  = oscManager.getTotalPackets();
+
+    Log::info("Dashboard ready -> http://%s:%d/ (%.0f Hz, %lu B/s)", WiFi.localIP().toString().c_str(), WS_PORT,
+              DASHBOARD_RATE_HZ, (unsigned long)DASHBOARD_MAX_BPS);
+    return true;
+}
+
+void Dashboard::loop() {
+    if (!_started && !begin()) return;
+
+    uint32_t now = micros();
+    if ((int32_t)(now - _nextUpdateUs) < 0) return;
+    _nextUpdateUs += _intervalUs;
+    if ((int32_t)(now - _nextUpdateUs) >= 0) _nextUpdateUs = now + _intervalUs;
+
+    // One second of burst at most, an idle dashboard does not save up for later
+    _budget += DASHBOARD_MAX_BPS * (float)(now - _lastUpdateUs) / 1000000.0f;
+    if (_budget > DASHBOARD_MAX_BPS) _budget = DASHBOARD_MAX_BPS;
+
+    size_t clients = _events.count();
+    if (clients == 0) {
+        _lastUpdateUs = now;
+        _lastPackets  = oscManager.getTotalPackets();
+        return;
+    }
+
+    char   message[MESSAGE_SIZE];
+    size_t length = encode(message, sizeof(message));
+
+    // Every client gets its own copy, and a client that cannot keep up gets fresh data later rather than a backlog
+    float cost = (float)(length * clients);
+    if (length == 0 || cost > _budget || _events.avgPacketsWaiting() > DASHBOARD_MAX_QUEUED) {
+        _skipped++;
+        return;
+    }
+
+    _budget -= cost;
+    _events.send(message, "telemetry", ++_updateId);
+}
+
+size_t Dashboard::encode(char* out, size_t size) {
+    uint32_t now      = micros();
+    uint32_t packets  = oscManager.getTotalPackets();
+    float    elapsed  = (float)(now - _lastUpdateUs) / 1000000.0f;
+    float    packetHz = elapsed > 0.0f ? (float)(packets - _lastPackets) / elapsed : 0.0f;
+
+    _lastUpdateUs = now;
+    _lastPackets  = packets;
+
+    float roll, pitch, yaw;
+    getEulerAngles(&roll, &pitch, &yaw);
+
+    int length = snprintf(out, size,
+                          "{\"roll\":%.1f,\"pitch\":%.1f,\"yaw\":%.1f,\"sampleHz\":%.1f,\"packetHz\":%.1f,"
+                          "\"limitHz\":%.1f,\"failures\":%lu,\"offline\":%u,\"wsClients\":%u,\"i2cErrors\":%lu,"
+                          "\"i2cRetries\":%lu,\"rssi\":%d,\"latencyMs\":%.2f,\"profile\":\"%s\",\"skipped\":%lu,"
+                          "\"uptime\":%lu}",
+                          roll, pitch, yaw, (float)sampleFreq, packetHz, oscManager.getRateController().getRate(),
+                          (unsigned long)oscManager.getTotalFailures(), (unsigned)oscManager.getOfflineCount(),
+                          (unsigned)webSocketTransport.getClientCount(), (unsigned long)getBMI160ReadErrors(),
+                          (unsigned long)getBMI160PollRetries(), (int)WiFi.RSSI(), profileManager.getLatencyMs(),
+                          profileManager.getProfile().name, (unsigned long)_skipped, millis() / 1000);
+
+    return length > 0 && (size_t)length < size ? (size_t)length : 0;
+}
+
+void Dashboard::handleSettings(AsyncWebServerRequest* request) {
+    int params = request->params();
+
+    // A form is taken whole or not at all
+    for (int i = 0; i < params; i++) {
+        const AsyncWebParameter* p = request->getParam(i);
+        if (!p->isPost()) continue;
+
+        SettingResult result = SettingsRegistry::check(p->name().c_str(), p->value().c_str(), SettingSource::NETWORK);
+        if (result != SettingResult::OK) {
+            request->send(400, "text/plain", p->name() + ": " + SettingsRegistry::describe(result));
+            return;
+        }
+    }
+    for (int i = 0; i < params; i++) {
+        const AsyncWebParameter* p = request->getParam(i);
+        if (p->isPost()) settingsRegistry.set(p->name().c_str(), p->value().c_str(), SettingSource::NETWORK);
+    }
+
+    request->send(200, "text/plain", "Applied");
+}
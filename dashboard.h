@@ -0,0 +1,110 @@
+/**
+ * @file        dashboard.h
+ * @brief       Live telemetry dashboard for the Wiicon Remote project
+ *
+ * @details     Serves dashboard.html from LittleFS in station mode and pushes decimated telemetry
+ *              (orientation, rates, queue depths, I2C errors, RSSI) to it as Server-Sent Events. Updates
+ *              are skipped rather than queued when the byte budget is spent or a client falls behind, so
+ *              the page never competes with the OSC stream. /settings lists and changes the settings of
+ *              the settings registry.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef DASHBOARD_H
+#define DASHBOARD_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#include "config.h"
+#include "logger.h"
+
+class Dashboard {
+   public:
+    /**
+     * Get the singleton instance of the dashboard
+     * @return Reference to the dashboard instance
+     */
+    static Dashboard& instance();
+
+    /**
+     * Register the page and the event stream on the web server of the WebSocket transport
+     * @return true if the dashboard is running
+     */
+    bool begin();
+
+    /**
+     * Send a telemetry update when one is due, call regularly while WiFi is connected
+     */
+    void loop();
+
+    Dashboard(const Dashboard&)            = delete; /**< Delete copy constructor */
+    Dashboard& operator=(const Dashboard&) = delete; /**< Delete assignment operator */
+
+   private:
+    /**
+     * Constructor
+     */
+    Dashboard();
+    ~Dashboard() = default;
+
+    /**
+     * Encode the current telemetry as JSON
+     * @param out Output buffer
+     * @param size Size of the output buffer
+     * @return Length of the JSON, 0 if it did not fit
+     */
+    size_t encode(char* out, size_t size);
+
+    /**
+     * POST /settings - validate every form field, then queue them all in the settings registry
+     * @param request Request
+     */
+    static void handleSettings(AsyncWebServerRequest* request);
+
+    static constexpr size_t MESSAGE_SIZE = 320; /**< Largest telemetry message */
+
+    AsyncEventSource _events;       /**< /events stream */
+    bool             _started;      /**< Whether the handlers are registered */
+    uint32_t         _intervalUs;   /**< Time between updates */
+    uint32_t         _nextUpdateUs; /**< Time of the next update (micros) */
+    uint32_t         _lastUpdateUs; /**< Time of the last update (micros) */
+    float            _budget;       /**< Bytes that may be sent now, refilled at DASHBOARD_MAX_BPS */
+    uint32_t         _lastPackets;  /**< OSC datagram count at the last update */
+    uint32_t         _updateId;     /**< Id of the last update */
+    uint32_t         _skipped;      /**< Updates skipped by the byte budget or slow clients */
+};
+
+/**
+ * Global instance of the dashboard
+ */
+extern Dashboard& dashboard;
+
+#endif  // DASHBOARD_H
@@ -0,0 +1,214 @@
+/**
+ * @file        discovery.cpp
+ * @brief       mDNS / DNS-SD advertisement and receiver discovery for the Wiicon Remote project
+ *
+ * @details     Implementation of the responder setup, the background browse and the choice of receiver.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "discovery.h"
+
+#include "osc_manager.h"
+#include "wifi_manager.h"
+
+Discovery& discovery = Discovery::instance();
+
+Discovery& Discovery::instance() {
+    static Discovery instance;
+    return instance;
+}
+
+Discovery::Discovery()
+    : _search(nullptr), _nextBrowse(0), _sinkPort(0), _sinkName{}, _misses(0), _started(false) {}
+
+bool Discovery::begin() {
+    if (_started) return true;
+    if (!MDNS_ENABLED || !wifiManager.isConnected()) return false;
+
+    // A failed start is retried with the next browse rather than on every loop
+    if ((long)(millis() - _nextBrowse) < 0) return false;
+    _nextBrowse = millis() + MDNS_BROWSE_INTERVAL_MS;
+
+    oscManager.begin();
+    uint8_t id = oscManager.getDeviceId();
+
+    char hostname[16];
+    snprintf(hostname, sizeof(hostname), "wiicon-%u", id);
+    if (!MDNS.begin(hostname)) {
+        Log::error("mDNS: responder failed to start");
+        return false;
+    }
+    char instanceName[24];
+    snprintf(instanceName, sizeof(instanceName), "WiiCon %u", id);
+    MDNS.setInstanceName(instanceName);
+
+    // Receivers read the TXT record instead of having to know the firmware configuration
+    char value[32];
+    MDNS.addService("osc", "udp", OSC_RECEIVE_PORT);
+    snprintf(value, sizeof(value), "%u", id);
+    MDNS.addServiceTxt("osc", "udp", "id", value);
+    value[0] = '\0';
+    if (OSC_PRIMARY_STREAMS & OSC_STREAM_MODE) strlcat(value, ",mode", sizeof(value));
+    if (OSC_PRIMARY_STREAMS & OSC_STREAM_EULER) strlcat(value, ",euler", sizeof(value));
+    if (OSC_PRIMARY_STREAMS & OSC_STREAM_ACCEL) strlcat(value, ",accel", sizeof(value));
+    if (OSC_PRIMARY_STREAMS & OSC_STREAM_GYRO) strlcat(value, ",gyro", sizeof(value));
+    if (OSC_PRIMARY_STREAMS & OSC_STREAM_FRAME) strlcat(value, ",frame", sizeof(value));
+    MDNS.addServiceTxt("osc", "udp", "streams", value[0] ? value + 1 : value);
+    uint16_t targetPort = wifiManager.getOscPort();
+    snprintf(value, sizeof(value), "%u", targetPort > 0 ? targetPort : OSC_TARGET_PORT);
+    MDNS.addServiceTxt("osc", "udp", "target_port", value);
+    snprintf(value, sizeof(value), "%u", EVENT_LOCAL_PORT);
+    MDNS.addServiceTxt("osc", "udp", "event_port", value);
+    snprintf(value, sizeof(value), "%u", CLOCK_SYNC_LOCAL_PORT);
+    MDNS.addServiceTxt("osc", "udp", "sync_port", value);
+    if (WS_ENABLED) {
+        MDNS.addServiceTxt("osc", "udp", "ws", WS_PATH);
+        MDNS.addService("http", "tcp", WS_PORT);
+    }
+
+    _started    = true;
+    _nextBrowse = millis();
+    Log::info("mDNS: %s.local, _osc._udp on port %u", hostname, OSC_RECEIVE_PORT);
+    return true;
+}
+
+void Discovery::end() {
+    if (_search) {
+        mdns_query_async_delete(_search);
+        _search = nullptr;
+    }
+    if (!_started) return;
+
+    // mdns_free() sends the goodbye packets, so receivers forget the controller at once
+    MDNS.end();
+    _started = false;
+}
+
+void Discovery::loop() {
+    if (!_started && !begin()) return;
+    if (!MDNS_DISCOVER_SINKS) return;
+
+    if (_search) {
+        mdns_result_t* results = nullptr;
+        uint8_t        count   = 0;
+        if (!mdns_query_async_get_results(_search, 0, &results, &count)) return;
+
+        mdns_query_async_delete(_search);
+        _search = nullptr;
+        collect(results);
+        mdns_query_results_free(results);
+        return;
+    }
+
+    if ((long)(millis() - _nextBrowse) < 0) return;
+    _nextBrowse = millis() + MDNS_BROWSE_INTERVAL_MS;
+
+    // A configured OSC IP always wins, so browsing would only cost airtime
+    if (wifiManager.getOscIP()[0] != '\0') {
+        if (_sinkPort != 0) useSink(nullptr, IPAddress());
+        return;
+    }
+
+    _search = mdns_query_async_new(nullptr, MDNS_SINK_SERVICE, "_udp", MDNS_TYPE_PTR, MDNS_BROWSE_WINDOW_MS,
+                                   MDNS_MAX_SINKS, nullptr);
+    if (!_search) Log::warning("mDNS: browse could not be started");
+}
+
+void Discovery::collect(const mdns_result_t* results) {
+    const mdns_result_t* chosen = nullptr;
+    IPAddress            chosenIP;
+
+    for (const mdns_result_t* result = results; result != nullptr; result = result->next) {
+        IPAddress ip;
+        if (result->port == 0 || result->ttl == 0 || !findAddress(*result, ip)) continue;
+        if (!acceptsDevice(*result, oscManager.getDeviceId())) continue;
+
+        // Staying on the current receiver keeps every controller on one machine when several answer
+        if (_sinkPort != 0 && ip == _sinkIP && result->port == _sinkPort) {
+            _misses = 0;
+            return;
+        }
+        if (!chosen) {
+            chosen   = result;
+            chosenIP = ip;
+        }
+    }
+
+    if (_sinkPort != 0 && ++_misses < MDNS_SINK_MISSES) return;
+    if (chosen || _sinkPort != 0) useSink(chosen, chosenIP);
+}
+
+void Discovery::useSink(const mdns_result_t* sink, const IPAddress& ip) {
+    _misses = 0;
+
+    if (!sink) {
+        Log::info("mDNS: receiver %s gone, back to the default target", _sinkName);
+        _sinkPort    = 0;
+        _sinkName[0] = '\0';
+        oscManager.setDiscoveredTarget(IPAddress(), 0);
+        return;
+    }
+
+    const char* name = sink->instance_name ? sink->instance_name : (sink->hostname ? sink->hostname : "?");
+    strlcpy(_sinkName, name, sizeof(_sinkName));
+    _sinkIP   = ip;
+    _sinkPort = sink->port;
+    Log::info("mDNS: streaming to receiver %s at %s:%u", _sinkName, ip.toString().c_str(), _sinkPort);
+    oscManager.setDiscoveredTarget(_sinkIP, _sinkPort);
+}
+
+bool Discovery::findAddress(const mdns_result_t& result, IPAddress& ip) {
+    for (const mdns_ip_addr_t* addr = result.addr; addr != nullptr; addr = addr->next) {
+        if (addr->addr.type != ESP_IPADDR_TYPE_V4) continue;
+        ip = IPAddress(addr->addr.u_addr.ip4.addr);
+        return true;
+    }
+    return false;
+}
+
+bool Discovery::acceptsDevice(const mdns_result_t& result, uint8_t deviceId) {
+    for (size_t i = 0; i < result.txt_count; ++i) {
+        if (strcmp(result.txt[i].key, "device") != 0) continue;
+        const char* list = result.txt[i].value;
+        if (!list || strcmp(list, "*") == 0) return true;
+
+        // "3,17" accepts the controllers with device id 3 and 17
+        while (*list) {
+            char* end;
+            long  id = strtol(list, &end, 10);
+            if (end != list && id == deviceId) return true;
+            list = strchr(list, ',');
+            if (!list) break;
+            ++list;
+        }
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file        discovery.h
+ * @brief       mDNS / DNS-SD advertisement and receiver discovery for the Wiicon Remote project
+ *
+ * @details     Advertises the controller as wiicon-<device id>.local with an _osc._udp service whose TXT record
+ *              lists its streams and ports, and browses for _wiicon-sink._udp receivers in the background. While
+ *              no OSC IP is configured, the stream goes unicast to the receiver found and falls back to the
+ *              default target when it stops answering.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef DISCOVERY_H
+#define DISCOVERY_H
+
+#include <Arduino.h>
+#include <ESPmDNS.h>
+#include <WiFi.h>
+#include <mdns.h>
+
+#include "config.h"
+#include "logger.h"
+
+class Discovery {
+   public:
+    /**
+     * Get the singleton instance of the discovery
+     * @return Reference to the discovery instance
+     */
+    static Discovery& instance();
+
+    /**
+     * Start the mDNS responder and advertise the services, called by loop() once the station is connected
+     * @return true if the responder is running
+     */
+    bool begin();
+
+    /**
+     * Send the goodbye packets and stop the responder, before deep sleep
+     */
+    void end();
+
+    /**
+     * Start browses and collect their answers, call regularly from the main loop while connected
+     * Never blocks, a browse runs in the mDNS task for MDNS_BROWSE_WINDOW_MS.
+     */
+    void loop();
+
+    /**
+     * Check whether the stream currently goes to a discovered receiver
+     * @return true if a receiver was found and is still answering
+     */
+    bool hasSink() const { return _sinkPort != 0; }
+
+    /**
+     * Get the instance name of the current receiver
+     * @return Instance name, empty without a receiver
+     */
+    const char* getSinkName() const { return _sinkName; }
+
+    Discovery(const Discovery&)            = delete; /**< Delete copy constructor */
+    Discovery& operator=(const Discovery&) = delete; /**< Delete assignment operator */
+
+   private:
+    /**
+     * Constructor
+     */
+    Discovery();
+    ~Discovery() = default;
+
+    /**
+     * Pick a receiver from the answers of a finished browse, preferring the current one
+     * @param results Answers, may be nullptr
+     */
+    void collect(const mdns_result_t* results);
+
+    /**
+     * Switch the stream to a receiver, or back to the default target
+     * @param sink Answer of the receiver, nullptr for the default target
+     * @param ip IPv4 address of the receiver
+     */
+    void useSink(const mdns_result_t* sink, const IPAddress& ip);
+
+    /**
+     * Get the first IPv4 address of an answer
+     * @param result Answer
+     * @param ip Address found
+     * @return true if the answer has an IPv4 address
+     */
+    static bool findAddress(const mdns_result_t& result, IPAddress& ip);
+
+    /**
+     * Check the optional "device" TXT entry of a receiver, a comma separated list of device ids or "*"
+     * @param result Answer
+     * @param deviceId Id of this controller
+     * @return true if the receiver accepts this controller
+     */
+    static bool acceptsDevice(const mdns_result_t& result, uint8_t deviceId);
+
+    mdns_search_once_t* _search;       /**< Browse in progress, nullptr between browses */
+    unsigned long       _nextBrowse;   /**< Time the next browse starts (millis) */
+    IPAddress           _sinkIP;       /**< Address of the current receiver */
+    uint16_t            _sinkPort;     /**< Port of the current receiver, 0 without one */
+    char                _sinkName[64]; /**< Instance name of the current receiver */
+    uint8_t             _misses;       /**< Browses in a row that did not find the current receiver */
+    bool                _started;      /**< Whether the responder is running */
+};
+
+/**
+ * Global instance of the discovery
+ */
+extern Discovery& discovery;
+
+#endif  // DISCOVERY_H
@@ -0,0 +1,112 @@
+/**
+ * @file        event_channel.cpp
+ * @brief       Reliable event channel implementation for the Wiicon Remote project
+ *
+ * @details     Implements the EventChannel class declared in event_channel.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "event_channel.h"
+
+EventChannel& eventChannel = EventChannel::instance();
+
+EventChannel& EventChannel::instance() {
+    static EventChannel instance;
+    return instance;
+}
+
+EventChannel::EventChannel() : _initialized(false), _expired(0) {}
+
+bool EventChannel::begin() {
+    if (_initialized) {
+        return true;
+    }
+
+    if (!oscManager.isReady()) {
+        return false;
+    }
+
+    if (!_udp.begin(EVENT_LOCAL_PORT)) {
+        Log::error("Events: failed to bind port %d", EVENT_LOCAL_PORT);
+        return false;
+    }
+
+    // A new session per boot lets receivers tell a restarted device from duplicates. Events posted before the link
+    // came up were not sent yet and take this identity too, or their acknowledgements would not match.
+    _queue.setIdentity(oscManager.getDeviceId(), esp_random());
+    _initialized = true;
+    Log::info("Events initialized on port %d", EVENT_LOCAL_PORT);
+    return true;
+}
+
+bool EventChannel::post(EventType type, int32_t value) {
+    if (!_queue.post(type, value, millis())) {
+        Log::warning("Events: queue full, dropping event %d", type);
+        return false;
+    }
+
+    if (begin()) flush();
+    return true;
+}
+
+void EventChannel::loop() {
+    if (!begin()) return;
+
+    receiveAcks();
+    flush();
+
+    const EventQueue::Stats& stats = _queue.stats();
+    if (stats.expired != _expired) {
+        Log::warning("Events: %lu event(s) not acknowledged", (unsigned long)(stats.expired - _expired));
+        _expired = stats.expired;
+    }
+}
+
+void EventChannel::receiveAcks() {
+    int length;
+    while ((length = _udp.parsePacket()) > 0) {
+        uint8_t     packet[EVENT_MAX_SIZE];
+        WiiconEvent ack;
+
+        int read = _udp.read(packet, sizeof(packet));
+        if (read > 0 && eventAckDecode(packet, (size_t)read, &ack)) _queue.acknowledge(ack, millis());
+    }
+}
+
+void EventChannel::flush() {
+    const OscDestination& target = oscManager.getPrimaryDestination();
+
+    _queue.service(millis(), [&](const WiiconEvent& event) {
+        size_t length = eventEncode(event, _buffer);
+        _udp.beginPacket(target.ip, target.port);
+        _udp.write(_buffer, length);
+        _udp.endPacket();
+    });
+}
@@ -0,0 +1,116 @@
+/**
+ * @file        event_channel.h
+ * @brief       Reliable event channel for the Wiicon Remote project
+ *
+ * @details     Sends discrete events (wiicon_event.h) to the primary OSC destination and
+ *              retransmits them until the receiver acknowledges them. Serviced at the start
+ *              of every loop iteration, before the sample stream, so events never wait
+ *              behind a burst of samples.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef EVENT_CHANNEL_H
+#define EVENT_CHANNEL_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+#include "config.h"
+#include "logger.h"
+#include "osc_manager.h"
+#include "wiicon_event.h"
+
+class EventChannel {
+   public:
+    /**
+     * Get the singleton instance of the event channel
+     * @return Reference to the event channel instance
+     */
+    static EventChannel& instance();
+
+    /**
+     * Bind the event port and pick a new session id
+     * @return true if initialization was successful
+     */
+    bool begin();
+
+    /**
+     * Queue an event and send it right away if the network is up
+     * @param type EventType
+     * @param value Event value
+     * @return true if the event was queued, false if the queue is full
+     */
+    bool post(EventType type, int32_t value);
+
+    /**
+     * Process acknowledgements and send due events
+     * Must be called before the sample stream in every loop iteration.
+     */
+    void loop();
+
+    /**
+     * Get the statistics of the retransmission queue
+     * @return Queue statistics
+     */
+    const EventQueue::Stats& getStats() const { return _queue.stats(); }
+
+    EventChannel(const EventChannel&)            = delete;
+    EventChannel& operator=(const EventChannel&) = delete;
+
+   private:
+    /**
+     * Constructor
+     */
+    EventChannel();
+    ~EventChannel() = default;
+
+    /**
+     * Read every pending acknowledgement from the event port
+     */
+    void receiveAcks();
+
+    /**
+     * Send every due event to the primary OSC destination
+     */
+    void flush();
+
+    WiFiUDP    _udp;                    /**< Socket bound to EVENT_LOCAL_PORT, events are sent from it */
+    EventQueue _queue;                  /**< Unacknowledged events */
+    uint8_t    _buffer[EVENT_MAX_SIZE]; /**< Encode buffer */
+    bool       _initialized;            /**< Whether the event port is bound */
+    uint32_t   _expired;                /**< Expired events already reported */
+};
+
+/**
+ * Global instance of the event channel
+ */
+extern EventChannel& eventChannel;
+
+#endif  // EVENT_CHANNEL_H
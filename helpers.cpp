@@ -34,10 +34,58 @@
 
 #include "helpers.h"
 
+namespace {
+
+bool userCalibration = false; /**< Whether the running calibration was asked for by the user */
+int  restarts        = 0;     /**< Times the running calibration started over because the device moved */
+
+/**
+ * Add a sample to the running calibration, started at boot or by the button, and report its end
+ */
+void updateGyroCalibration(int16_t gx_raw, int16_t gy_raw, int16_t gz_raw) {
+    GyroCalibration result = addGyroCalibrationSample(gx_raw, gy_raw, gz_raw);
+    if (result == GyroCalibration::RUNNING) return;
+
+    if (result == GyroCalibration::MOVED) {
+        // The boot calibration waits as long as it takes, the user is told when theirs does not succeed
+        if (userCalibration && restarts >= CALIB_MAX_RESTARTS) {
+            Log::error("Gyroscope calibration failed, the device kept moving. The previous bias stays in use");
+            userCalibration = false;
+            restarts        = 0;
+            LedManager::signalErrorGeneral();
+            return;
+        }
+
+        // Start over on the next samples, the previous bias (or none) stays in use meanwhile
+        if (restarts == 0) Log::info("Gyroscope calibration waits for the device to be still...");
+        restarts++;
+        beginGyroCalibration(configStore.get().calibSamples);
+        return;
+    }
+
+    userCalibration = false;
+    restarts        = 0;
+    Log::info("Gyroscope calibration successful. Raw biases (deg/s): %.4f, %.4f, %.4f", gyroBiasRaw[0],
+              gyroBiasRaw[1], gyroBiasRaw[2]);
+    LedManager::signalSuccess();
+}
+
+}  // namespace
+
+void recalibrateGyro() {
+    Log::info("Resetting calibration, keep the device stationary...");
+    userCalibration = true;
+    restarts        = 0;
+    LedManager::signalCalibrating();
+    beginGyroCalibration(configStore.get().calibSamples);
+}
+
 void sendEulerAngles() {
     int16_t ax_raw, ay_raw, az_raw;
     int16_t gx_raw, gy_raw, gz_raw;
 
+    uint32_t sampleTime = micros();
+
     // Read accelerometer data
     if (!readAccelRaw(&ax_raw, &ay_raw, &az_raw)) {
         Log::error("Failed to read ACC data");
@@ -50,6 +98,13 @@ void sendEulerAngles() {
         return;
     }
 
+    // The calibration averages the regular samples, so streaming does not wait for it
+    if (isGyroCalibrating()) updateGyroCalibration(gx_raw, gy_raw, gz_raw);
+
+    // Before the first bias lands, the samples averaged so far are closer to it than none; a moving device gets none
+    float        estimate[3];
+    const float* bias = !gyroBiasValid && estimateGyroBias(estimate) ? estimate : gyroBiasRaw;
+
     // Debug: print raw values if all are zero
     if (ax_raw == 0 && ay_raw == 0 && az_raw == 0 && gx_raw == 0 && gy_raw == 0 && gz_raw == 0) {
         Log::error("Raw sensor values are all zero — check wiring, address, or that sensor is powered.");
@@ -68,7 +123,7 @@ void sendEulerAngles() {
         a_mapped[i] = a_mapped[i] / ACC_LSB_PER_G;
         g_mapped[i] = (float)rawG[gyroMap[i]] * (float)gyroSign[i];
         // Bias in deg/s for mapped axis: get raw bias from source axis and apply sign
-        bias_mapped[i] = gyroBiasRaw[gyroMap[i]] * (float)gyroSign[i];
+        bias_mapped[i] = bias[gyroMap[i]] * (float)gyroSign[i];
         // Convert gyro LSB -> deg/s and remove bias
         g_mapped[i] = g_mapped[i] / GYR_LSB_PER_DPS - bias_mapped[i];
     }
@@ -81,13 +136,8 @@ void sendEulerAngles() {
     getEulerAngles(&roll, &pitch, &yaw);
 
     // Optionally swap roll and yaw before sending
-#if SWAP_ROLL_YAW
-    float outRoll = yaw;
-    float outYaw  = roll;
-#else
-    float outRoll = roll;
-    float outYaw  = yaw;
-#endif
+    float outRoll = swapRollYaw ? yaw : roll;
+    float outYaw  = swapRollYaw ? roll : yaw;
 
 #if DATA_SERIAL_LOG
     Serial.print(outRoll, 2);
@@ -97,12 +147,19 @@ void sendEulerAngles() {
     Serial.println(outYaw, 2);
 #endif
 
-    if (dataMode == DataMode::FILTERED) {
-        oscManager.sendEulerAngles(outRoll, pitch, outYaw);
-    } else {
-        oscManager.sendFloat3("/wiicon/accel", a_mapped[0], a_mapped[1], a_mapped[2]);
-        oscManager.sendFloat3("/wiicon/gyro", g_mapped[0], g_mapped[1], g_mapped[2]);
-    }
+    // Express the sample time in host time once the clock sync has an estimate
+    bool hostTime = clockSync.isSynced();
+
+    OscSample sample = {
+        {outRoll, pitch, outYaw},
+        {a_mapped[0], a_mapped[1], a_mapped[2]},
+        {g_mapped[0], g_mapped[1], g_mapped[2]},
+        {q0, q1, q2, q3},
+        hostTime ? (uint32_t)clockSync.toHostMicros(sampleTime) : sampleTime,
+        hostTime,
+    };
+    oscManager.sendSample(sample, dataMode);
+    profileManager.recordLatency(micros() - sampleTime);
 
     LedManager::signalOscReady();
 }
@@ -154,3 +211,24 @@ void writeFile(fs::FS& fs, const char* path, const char* message) {
 
     file.close();
 }
+
+void printJsonString(Print& out, const char* value) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+
+    out.write('"');
+    for (const char* c = value; *c != '\0'; ++c) {
+        uint8_t ch = (uint8_t)*c;
+
+        if (ch == '"' || ch == '\\') {
+            out.write('\\');
+            out.write(ch);
+        } else if (ch < 0x20) {
+            out.print("\\u00");
+            out.write(HEX_DIGITS[ch >> 4]);
+            out.write(HEX_DIGITS[ch & 0x0F]);
+        } else {
+            out.write(ch);
+        }
+    }
+    out.write('"');
+}
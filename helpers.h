@@ -41,11 +41,13 @@
 
 #include "actions.h"
 #include "bmi160.h"
+#include "clock_sync.h"
 #include "config.h"
 #include "led_manager.h"
 #include "logger.h"
 #include "madgwick.h"
 #include "osc_manager.h"
+#include "profile_manager.h"
 
 /**
  * Sends Euler angles via Serial
@@ -53,6 +55,13 @@
  */
 void sendEulerAngles();
 
+/**
+ * Start a gyroscope calibration asked for by the user
+ * Runs on the regular samples with the current bias in use. The LED stays yellow until it ends: green once the bias
+ * is stored, the general error if the device still moved after CALIB_MAX_RESTARTS restarts.
+ */
+void recalibrateGyro();
+
 /**
  * Initialize LittleFS filesystem
  */
@@ -74,4 +83,12 @@ String readFile(fs::FS& fs, const char* path);
  */
 void writeFile(fs::FS& fs, const char* path, const char* message);
 
+/**
+ * Print a string as a quoted JSON string
+ * Quotes, backslashes and control characters are escaped, other bytes (UTF-8) are copied unchanged.
+ * @param out Output to print to
+ * @param value NUL-terminated string
+ */
+void printJsonString(Print& out, const char* value);
+
 #endif  // HELPERS_H
@@ -34,6 +34,11 @@
 
 #include "led_manager.h"
 
+uint8_t       LedManager::_color     = 0;
+uint8_t       LedManager::_steps     = 0;
+unsigned long LedManager::_stepMs    = 0;
+unsigned long LedManager::_stepStart = 0;
+
 void LedManager::begin() {
     pinMode(LED_PIN_R, OUTPUT);
     pinMode(LED_PIN_G, OUTPUT);
@@ -54,6 +59,35 @@ void LedManager::setColor(bool r, bool g, bool b) {
 
 void LedManager::off() { setColor(false, false, false); }
 
+void LedManager::show(bool r, bool g, bool b, uint8_t blinks, unsigned long stepMs) {
+    _color     = (r ? 1 : 0) | (g ? 2 : 0) | (b ? 4 : 0);
+    _steps     = blinks > 0 ? blinks * 2 : 1;
+    _stepMs    = stepMs;
+    _stepStart = millis();
+    setColor(r, g, b);
+}
+
+void LedManager::loop() {
+    if (_steps == 0 || millis() - _stepStart < _stepMs) return;
+
+    _stepStart = millis();
+    _steps--;
+
+    // Blinks start lit, so an even number of phases left means the next one is lit
+    if (_steps > 0 && _steps % 2 == 0) {
+        setColor(_color & 1, _color & 2, _color & 4);
+    } else {
+        off();
+    }
+}
+
+void LedManager::finish() {
+    while (isBusy()) {
+        loop();
+        delay(10);
+    }
+}
+
 void LedManager::blink(bool r, bool g, bool b, int times, int delayMs) {
     for (int i = 0; i < times; i++) {
         setColor(r, g, b);
@@ -63,13 +97,11 @@ void LedManager::blink(bool r, bool g, bool b, int times, int delayMs) {
     }
 }
 
-void LedManager::signalStartup() {
-    setColor(true, true, true);
-    delay(1000);
-    off();
-}
+void LedManager::signalStartup() { show(true, true, true, 0, 1000); }
 
 void LedManager::signalWifiSearch() {
+    if (isBusy()) return;
+
     static unsigned long lastToggle = 0;
     const int            interval   = 200;
 
@@ -86,6 +118,8 @@ void LedManager::signalWifiSearch() {
 }
 
 void LedManager::signalWifiConnecting() {
+    if (isBusy()) return;
+
     static unsigned long lastToggle = 0;
     const int            interval   = 500;
 
@@ -98,6 +132,8 @@ void LedManager::signalWifiConnecting() {
 }
 
 void LedManager::signalAPMode() {
+    if (isBusy()) return;
+
     static unsigned long lastToggle = 0;
     const int            interval   = 500;
 
@@ -109,11 +145,7 @@ void LedManager::signalAPMode() {
     }
 }
 
-void LedManager::signalSuccess() {
-    setColor(false, true, false);
-    delay(2000);
-    off();
-}
+void LedManager::signalSuccess() { show(false, true, false, 0, 2000); }
 
 void LedManager::signalErrorSensor() {
     while (true) {
@@ -121,9 +153,15 @@ void LedManager::signalErrorSensor() {
     }
 }
 
-void LedManager::signalErrorGeneral() { blink(true, false, true, 3, 300); }
+void LedManager::signalErrorGeneral() { show(true, false, true, 3, 300); }
+
+void LedManager::signalDataMode() { show(false, false, true, 0, DELAY_LED_FEEDBACK_MS); }
+
+void LedManager::signalCalibrating() { show(true, true, false, 0, HOLD_MS); }
 
 void LedManager::signalOscReady() {
+    if (isBusy()) return;
+
     static unsigned long lastBlinkTime = 0;
     static bool          isLedOn       = false;
 
@@ -47,6 +47,11 @@ class LedManager {
      */
     static void begin();
 
+    /**
+     * End the timed signals when their time is up, call regularly from the main loop
+     */
+    static void loop();
+
     /**
      * Set the color of the RGB LED
      * @param r Red
@@ -57,6 +62,7 @@ class LedManager {
 
     /**
      * Signal the startup of the device
+     * Like the other one-shot signals it returns at once, loop() turns the LED off when the time is up.
      */
     static void signalStartup();
 
@@ -95,6 +101,28 @@ class LedManager {
      */
     static void signalOscReady();
 
+    /**
+     * Signal a change of data mode
+     */
+    static void signalDataMode();
+
+    /**
+     * Signal a calibration in progress
+     * Steady yellow held until the next one-shot signal (success or error) replaces it.
+     */
+    static void signalCalibrating();
+
+    /**
+     * Check whether a one-shot signal is showing, the blinking state signals pause until it ends
+     * @return true while a one-shot signal is showing
+     */
+    static bool isBusy() { return _steps > 0; }
+
+    /**
+     * Wait until the one-shot signal has ended, before a restart
+     */
+    static void finish();
+
     /**
      * Turn off the RGB LED
      */
@@ -102,7 +130,24 @@ class LedManager {
 
    private:
     /**
-     * Blink the RGB LED
+     * Start a one-shot signal
+     * @param r Red
+     * @param g Green
+     * @param b Blue
+     * @param blinks Number of blinks, 0 for a steady light
+     * @param stepMs Duration of the steady light, or of each on and off phase of a blink
+     */
+    static void show(bool r, bool g, bool b, uint8_t blinks, unsigned long stepMs);
+
+    static constexpr unsigned long HOLD_MS = ~0UL; /**< Step duration of a signal held until another replaces it */
+
+    static uint8_t       _color;     /**< Color of the one-shot signal, bit 0 red, bit 1 green, bit 2 blue */
+    static uint8_t       _steps;     /**< On and off phases left, 0 when no one-shot signal is showing */
+    static unsigned long _stepMs;    /**< Duration of each phase */
+    static unsigned long _stepStart; /**< Start of the current phase (millis) */
+
+    /**
+     * Blink the RGB LED, blocking
      * @param r Red
      * @param g Green
      * @param b Blue
@@ -37,6 +37,7 @@
 LogLevel Log::_level            = LOG_LEVEL_INFO; /**< Current log level */
 bool     Log::_timestampEnabled = true;           /**< Whether timestamp is enabled */
 char     Log::_buffer[256]      = {0};            /**< Buffer for the log message */
+LogSink  Log::_sink             = nullptr;        /**< Sink that replaces the serial output */
 
 void Log::init(LogLevel level) {
     _level            = level;
@@ -49,6 +50,8 @@ LogLevel Log::getLevel() { return _level; }
 
 void Log::enableTimestamp(bool enable) { _timestampEnabled = enable; }
 
+void Log::setSink(LogSink sink) { _sink = sink; }
+
 const char* Log::levelToString(LogLevel level) {
     switch (level) {
         case LOG_LEVEL_DEBUG:
@@ -71,6 +74,12 @@ void Log::printLog(LogLevel level, const char* file, int line, const char* messa
         return;
     }
 
+    // The sink timestamps and labels messages on its own side
+    if (_sink) {
+        _sink(level, message);
+        return;
+    }
+
     if (_timestampEnabled) {
         Serial.print("[");
         Serial.print(millis());
@@ -42,6 +42,11 @@ typedef enum {
     LOG_LEVEL_NONE     = 5
 } LogLevel;
 
+/**
+ * Alternative log output, receives each formatted message instead of the serial port
+ */
+typedef void (*LogSink)(LogLevel level, const char* message);
+
 class Log {
    public:
     /**
@@ -66,6 +71,12 @@ class Log {
      */
     static void enableTimestamp(bool enable);
 
+    /**
+     * Route log messages to a sink instead of printing them
+     * @param sink Sink function, nullptr to print to the serial port again
+     */
+    static void setSink(LogSink sink);
+
     /**
      * Log a debug message
      * @param format Format string
@@ -130,6 +141,11 @@ class Log {
      */
     static bool _timestampEnabled;
 
+    /**
+     * Sink that replaces the serial output, if any
+     */
+    static LogSink _sink;
+
     /**
      * Buffer for the log message
      */
@@ -0,0 +1,51 @@
+/**
+ * @file        loopback_transport.cpp
+ * @brief       In-memory loopback output transport implementation for the Wiicon Remote project
+ *
+ * @details     Implements the LoopbackTransport class declared in loopback_transport.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "loopback_transport.h"
+
+LoopbackTransport::LoopbackTransport() : _count(0), _failures(0), _ready(true) {}
+
+bool LoopbackTransport::send(const OscDestination& destination, const uint8_t* data, size_t length) {
+    if (_failures > 0) {
+        _failures--;
+        return false;
+    }
+
+    Packet& packet = _packets[_count++ % CAPACITY];
+    memcpy(packet.data, data, length < PACKET_SIZE ? length : PACKET_SIZE);
+    packet.length = length;
+    packet.port   = destination.port;
+    return true;
+}
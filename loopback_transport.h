@@ -0,0 +1,112 @@
+/**
+ * @file        loopback_transport.h
+ * @brief       In-memory loopback output transport for the Wiicon Remote project
+ *
+ * @details     Keeps the last packets sent to it in memory instead of putting them on a
+ *              wire, so the encoders and the fan-out scheduling of OSCManager can be run and
+ *              measured on the host or on a bare board. Failures can be injected to drive
+ *              the rate controller.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef LOOPBACK_TRANSPORT_H
+#define LOOPBACK_TRANSPORT_H
+
+#include <Arduino.h>
+
+#include "osc_transport.h"
+
+class LoopbackTransport : public OscTransport {
+   public:
+    static constexpr size_t CAPACITY    = 16;  /**< Packets kept, older ones are overwritten */
+    static constexpr size_t PACKET_SIZE = 256; /**< Largest packet kept, longer ones are truncated */
+
+    /**
+     * Captured packet
+     */
+    struct Packet {
+        uint8_t  data[PACKET_SIZE]; /**< Packet bytes */
+        size_t   length;            /**< Packet length, may exceed PACKET_SIZE if truncated */
+        uint16_t port;              /**< Destination port */
+    };
+
+    /**
+     * Constructor
+     */
+    LoopbackTransport();
+
+    const char* name() const override { return "loopback"; }
+    bool        begin() override { return _ready; }
+    bool        isReady() const override { return _ready; }
+
+    /**
+     * Capture one packet
+     * @return false while failures are injected
+     */
+    bool send(const OscDestination& destination, const uint8_t* data, size_t length) override;
+
+    /**
+     * Make the transport appear up or down
+     * @param ready Whether isReady() returns true
+     */
+    void setReady(bool ready) { _ready = ready; }
+
+    /**
+     * Reject the next packets
+     * @param count Number of packets send() will reject
+     */
+    void failNext(uint32_t count) { _failures = count; }
+
+    /**
+     * Get the number of packets accepted since the last clear()
+     * @return Packet count
+     */
+    uint32_t count() const { return _count; }
+
+    /**
+     * Get a captured packet
+     * @param age 0 for the newest packet, up to min(count(), CAPACITY) - 1
+     * @return Packet
+     */
+    const Packet& packet(size_t age) const { return _packets[(_count - 1 - age) % CAPACITY]; }
+
+    /**
+     * Drop every captured packet
+     */
+    void clear() { _count = 0; }
+
+   private:
+    Packet   _packets[CAPACITY]; /**< Ring of captured packets */
+    uint32_t _count;             /**< Packets accepted since the last clear() */
+    uint32_t _failures;          /**< Packets still to reject */
+    bool     _ready;             /**< Whether the transport appears up */
+};
+
+#endif  // LOOPBACK_TRANSPORT_H
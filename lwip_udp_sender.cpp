@@ -0,0 +1,139 @@
+/**
+ * @file        lwip_udp_sender.cpp
+ * @brief       Raw lwIP UDP sender implementation for the Wiicon Remote project
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+
+#include "lwip_udp_sender.h"
+
+#include "lwip/priv/tcpip_priv.h"
+
+namespace {
+
+struct NewPcbCall {
+    struct tcpip_api_call_data call;
+    struct udp_pcb*            pcb;
+};
+
+struct SendCall {
+    struct tcpip_api_call_data call;
+    struct udp_pcb*            pcb;
+    struct pbuf*               p;
+    uint8_t*                   payload;
+    uint16_t                   length;
+    ip_addr_t                  addr;
+    uint16_t                   port;
+};
+
+err_t newPcbInTcpip(struct tcpip_api_call_data* data) {
+    NewPcbCall* call = (NewPcbCall*)data;
+    call->pcb        = udp_new_ip_type(IPADDR_TYPE_ANY);
+    return call->pcb ? ERR_OK : ERR_MEM;
+}
+
+err_t sendInTcpip(struct tcpip_api_call_data* data) {
+    SendCall*    call = (SendCall*)data;
+    struct pbuf* p    = call->p;
+
+    // udp_sendto() prepends the UDP/IP headers in place, move the payload back to the message start
+    size_t headers = call->payload - (uint8_t*)p->payload;
+    if (headers > 0) pbuf_remove_header(p, headers);
+    p->len     = call->length;
+    p->tot_len = call->length;
+
+    return udp_sendto(call->pcb, p, &call->addr, call->port);
+}
+
+}  // namespace
+
+LwipUdpSender::LwipUdpSender() : _pcb(nullptr), _pool{}, _payload{}, _current(0) {}
+
+bool LwipUdpSender::begin() {
+    if (_pcb) return true;
+
+    NewPcbCall call;
+    if (tcpip_api_call(newPcbInTcpip, &call.call) != ERR_OK) {
+        Log::error("lwIP: failed to create UDP PCB");
+        return false;
+    }
+    _pcb = call.pcb;
+
+    for (size_t i = 0; i < POOL_SIZE; ++i) {
+        // PBUF_TRANSPORT reserves headroom so lwIP can prepend headers without chaining a new pbuf
+        _pool[i] = pbuf_alloc(PBUF_TRANSPORT, CAPACITY, PBUF_RAM);
+        if (!_pool[i]) {
+            Log::error("lwIP: failed to allocate pbuf pool");
+            return false;
+        }
+        _payload[i] = (uint8_t*)_pool[i]->payload;
+    }
+
+    Log::info("lwIP UDP sender ready (%d x %d byte pbufs)", POOL_SIZE, CAPACITY);
+    return true;
+}
+
+uint8_t* LwipUdpSender::acquire() {
+    if (!_pcb) return nullptr;
+
+    for (size_t n = 1; n <= POOL_SIZE; ++n) {
+        size_t i = (_current + n) % POOL_SIZE;
+
+        // The driver holds an extra reference while a datagram is still queued
+        if (_pool[i]->ref == 1) {
+            _current = i;
+            return _payload[i];
+        }
+    }
+
+    return nullptr;
+}
+
+bool LwipUdpSender::send(const IPAddress& ip, uint16_t port, size_t length) {
+    if (!_pcb || length > CAPACITY) return false;
+
+    // Fanning out while the previous datagram is still queued: continue from a copy in another pbuf
+    if (_pool[_current]->ref != 1) {
+        uint8_t* message = _payload[_current];
+        uint8_t* copy    = acquire();
+        if (!copy) return false;
+        memcpy(copy, message, length);
+    }
+
+    SendCall call;
+    call.pcb     = _pcb;
+    call.p       = _pool[_current];
+    call.payload = _payload[_current];
+    call.length  = (uint16_t)length;
+    call.port    = port;
+    IP_ADDR4(&call.addr, ip[0], ip[1], ip[2], ip[3]);
+
+    return tcpip_api_call(sendInTcpip, &call.call) == ERR_OK;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file        lwip_udp_sender.h
+ * @brief       Raw lwIP UDP sender for the Wiicon Remote project
+ *
+ * @details     Sends UDP datagrams straight from a small pool of preallocated lwIP pbufs.
+ *              Messages are encoded directly into the pbuf payload and handed to udp_sendto()
+ *              from the TCP/IP task, skipping the WiFiUDP copy and socket layers.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+
+#ifndef LWIP_UDP_SENDER_H
+#define LWIP_UDP_SENDER_H
+
+#include <Arduino.h>
+
+#include "logger.h"
+#include "lwip/pbuf.h"
+#include "lwip/udp.h"
+
+class LwipUdpSender {
+   public:
+    static constexpr size_t CAPACITY  = 256; /**< Payload capacity of each pbuf in bytes */
+    static constexpr size_t POOL_SIZE = 4;   /**< Number of preallocated pbufs */
+
+    /**
+     * Constructor
+     */
+    LwipUdpSender();
+
+    /**
+     * Create the UDP PCB and allocate the pbuf pool
+     * @return true if initialization was successful
+     */
+    bool begin();
+
+    /**
+     * Acquire a free pbuf from the pool to encode the next message into
+     * @return Pointer to CAPACITY bytes of payload, or nullptr if every pbuf is still in flight
+     */
+    uint8_t* acquire();
+
+    /**
+     * Send the acquired pbuf
+     * May be called several times for the same message to fan it out to several destinations.
+     * @param ip Target IP address
+     * @param port Target port
+     * @param length Message length in bytes
+     * @return true if lwIP accepted the datagram
+     */
+    bool send(const IPAddress& ip, uint16_t port, size_t length);
+
+   private:
+    struct udp_pcb* _pcb;                /**< UDP protocol control block */
+    struct pbuf*    _pool[POOL_SIZE];    /**< Preallocated pbufs */
+    uint8_t*        _payload[POOL_SIZE]; /**< Payload start of each pbuf, before lwIP prepends headers */
+    size_t          _current;            /**< Index of the acquired pbuf */
+};
+
+#endif  // LWIP_UDP_SENDER_H
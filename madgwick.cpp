@@ -30,7 +30,32 @@ float          q1         = 0.0f;
 float          q2         = 0.0f;
 float          q3         = 0.0f;
 
+static bool seeded = false; /**< Whether the quaternion was initialized from gravity */
+
+/**
+ * Set roll and pitch from the measured gravity, yaw to zero
+ * Without this the filter starts at identity and takes a few seconds at the normal gain to converge.
+ */
+static void seedQuaternion(float ax, float ay, float az) {
+    float halfRoll  = 0.5f * atan2f(ay, az);
+    float halfPitch = 0.5f * atan2f(-ax, sqrtf(ay * ay + az * az));
+    float cr = cosf(halfRoll), sr = sinf(halfRoll);
+    float cp = cosf(halfPitch), sp = sinf(halfPitch);
+
+    q0 = cr * cp;
+    q1 = sr * cp;
+    q2 = cr * sp;
+    q3 = -sr * sp;
+}
+
 void MadgwickAHRSupdate(float gx, float gy, float gz, float ax, float ay, float az) {
+    if (!seeded) {
+        if (ax == 0.0f && ay == 0.0f && az == 0.0f) return;
+        seedQuaternion(ax, ay, az);
+        seeded = true;
+        return;
+    }
+
     float SEq_1 = q0;
     float SEq_2 = q1;
     float SEq_3 = q2;
@@ -135,8 +160,9 @@ void getEulerAngles(float *roll, float *pitch, float *yaw) {
 }
 
 void resetQuaternion() {
-    q0 = 1.0f;
-    q1 = 0.0f;
-    q2 = 0.0f;
-    q3 = 0.0f;
+    q0     = 1.0f;
+    q1     = 0.0f;
+    q2     = 0.0f;
+    q3     = 0.0f;
+    seeded = false;
 }
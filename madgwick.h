@@ -86,6 +86,7 @@ void getEulerAngles(float *roll, float *pitch, float *yaw);
 
 /**
  * Reset the quaternion to the identity orientation (no rotation)
+ * The next update starts again from the measured gravity.
  */
 void resetQuaternion();
 
@@ -34,64 +34,331 @@
 
 #include "osc_manager.h"
 
+#include "boot_profiler.h"
+#include "serial_link.h"
+#include "websocket_transport.h"
+
 OSCManager& oscManager = OSCManager::instance();
 
+namespace {
+
+using EulerMessage = osc::Message<OSC_ADDRESS_EULER, float, float, float>;
+using AccelMessage = osc::Message<OSC_ADDRESS_ACCEL, float, float, float>;
+using GyroMessage  = osc::Message<OSC_ADDRESS_GYRO, float, float, float>;
+
+/**
+ * "#bundle" and an immediate timetag
+ */
+constexpr uint8_t BUNDLE_HEADER[16] = {'#', 'b', 'u', 'n', 'd', 'l', 'e', 0, 0, 0, 0, 0, 0, 0, 0, 1};
+
+static_assert(sizeof(BUNDLE_HEADER) + 3 * 4 + EulerMessage::MAX_SIZE + AccelMessage::MAX_SIZE +
+                      GyroMessage::MAX_SIZE <=
+                  OSCManager::BUFFER_SIZE,
+              "A bundle of every stream does not fit the buffer");
+
+/**
+ * Encode one three-float stream of a sample
+ */
+template <typename Message, float (OscSample::*Values)[3]>
+size_t encodeStream(uint8_t* out, const OscSample& sample) {
+    const float* v = sample.*Values;
+    return Message::template encode<OSCManager::BUFFER_SIZE>(out, v[0], v[1], v[2]);
+}
+
+/**
+ * OSC streams carrying three floats of a sample
+ */
+const struct {
+    uint8_t stream;
+    size_t (*encode)(uint8_t* out, const OscSample& sample);
+} FLOAT3_STREAMS[] = {
+    {OSC_STREAM_EULER, &encodeStream<EulerMessage, &OscSample::euler>},
+    {OSC_STREAM_ACCEL, &encodeStream<AccelMessage, &OscSample::accel>},
+    {OSC_STREAM_GYRO, &encodeStream<GyroMessage, &OscSample::gyro>},
+};
+
+}  // namespace
+
 OSCManager& OSCManager::instance() {
     static OSCManager instance;
     return instance;
 }
 
-OSCManager::OSCManager() : _initialized(false), _bufferIndex(0) {}
+OSCManager::OSCManager()
+    : _initialized(false),
+      _buffer(nullptr),
+      _bufferIndex(0),
+      _destinationCount(1),
+      _targetDirty(true),
+      _discoveredPort(0),
+      _stats{},
+      _totalPackets(0),
+      _totalFailures(0),
+      _deviceId(0),
+      _sequence(0),
+      _frameHead(0),
+      _frameCount(0),
+      _offlineHead(0),
+      _offlineCount(0),
+      _offlineDropped(0),
+      _wasOffline(false) {
+    _buffer          = _txBuffer;
+    _destinations[0] = {IPAddress(), (uint16_t)OSC_TARGET_PORT, OSC_PRIMARY_STREAMS, 1, 0, &_network};
+}
 
 bool OSCManager::begin() {
     if (_initialized) {
         return true;
     }
 
-    if (!wifiManager.isConnected()) {
-        Log::warning("OSC: WiFi not connected, cannot initialize");
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_LOST_IP);
+
+    // Last octet of the MAC address, enough to tell controllers apart on one network
+    _deviceId    = (uint8_t)(ESP.getEfuseMac() >> 40);
+    _initialized = true;
+    Log::info("OSC initialized (device %d)", _deviceId);
+
+    for (const OscDestinationConfig* config = OSC_EXTRA_DESTINATIONS; config->ip != nullptr; ++config) {
+        IPAddress ip;
+        if (!ip.fromString(config->ip)) {
+            Log::warning("OSC: invalid destination IP: %s", config->ip);
+            continue;
+        }
+        addDestination(ip, config->port, config->streams, config->decimation);
+    }
+
+    if (serialLink.isActive()) addDestination(IPAddress(), 0, SERIAL_OSC_STREAMS, 1, &serialLink);
+    if (WS_ENABLED) addDestination(IPAddress(), 0, OSC_STREAM_FRAME, 1, &webSocketTransport);
+
+    return true;
+}
+
+bool OSCManager::addDestination(const IPAddress& ip, uint16_t port, uint8_t streams, uint8_t decimation,
+                                OscTransport* transport) {
+    if (!transport) transport = &_network;
+
+    if (_destinationCount >= OSC_MAX_DESTINATIONS) {
+        Log::warning("OSC: destination table full, ignoring %s %s:%d", transport->name(), ip.toString().c_str(), port);
         return false;
     }
 
-    _initialized       = true;
-    IPAddress targetIP = getTargetIP();
-    Log::info("OSC initialized -> %s:%d", targetIP.toString().c_str(), OSC_TARGET_PORT);
+    _destinations[_destinationCount++] = {ip, port, streams, decimation > 0 ? decimation : (uint8_t)1, 0, transport};
+    Log::info("OSC destination added -> %s %s:%d (streams 0x%02X, 1/%d)", transport->name(), ip.toString().c_str(),
+              port, streams, decimation);
     return true;
 }
 
-bool OSCManager::isReady() const { return _initialized && wifiManager.isConnected() && !wifiManager.isInAPMode(); }
+void OSCManager::onWiFiEvent(arduino_event_id_t) { instance().invalidateTarget(); }
+
+bool OSCManager::isReady() const { return _initialized && _network.isReady(); }
+
+bool OSCManager::ensureReady() {
+    if (!_initialized) begin();
+
+    if (!_network.isReady()) {
+        if (!_network.begin()) return false;
+
+        resolveTarget();
+        Log::info("OSC %s ready -> %s:%d%s", _network.name(), _destinations[0].ip.toString().c_str(),
+                  _destinations[0].port, isMulticastTarget() ? " (multicast)" : "");
+    }
+
+    if (_targetDirty) resolveTarget();
+    return true;
+}
+
+void OSCManager::sendSample(const OscSample& sample, DataMode mode) {
+    // Other transports (serial) keep streaming while the network is down
+    bool network = ensureReady();
+    bool ready   = network;
+    for (size_t i = 0; i < _destinationCount && !ready; ++i) ready = _destinations[i].transport->isReady();
+
+    if (!ready) {
+        if (!_wasOffline) Log::info("OSC: no transport ready, %s samples", OSC_OFFLINE_BUFFER ? "holding" : "dropping");
+        _wasOffline = true;
+        holdOffline(sample);
+        return;
+    }
+    bootProfiler.markStreaming();
+
+    if (_wasOffline) {
+        Log::info("OSC: transport ready, %u held, %lu dropped", (unsigned)_offlineCount,
+                  (unsigned long)_offlineDropped);
+        _wasOffline     = false;
+        _offlineDropped = 0;
+    }
+
+    if (_offlineCount == 0) {
+        sendNow(sample, mode, network);
+        logStats();
+        return;
+    }
+
+    // Queue behind the backlog so the receiver sees samples in order, and drain a few per call to catch up
+    holdOffline(sample);
+    for (size_t i = 0; i < OSC_OFFLINE_FLUSH_MAX && _offlineCount > 0; ++i) {
+        sendNow(_offline[_offlineHead], mode, network);
+        _offlineHead = (_offlineHead + 1) % OFFLINE_SLOTS;
+        _offlineCount--;
+    }
+    logStats();
+}
+
+void OSCManager::holdOffline(const OscSample& sample) {
+    if (OSC_OFFLINE_BUFFER == 0) {
+        _offlineDropped++;
+        return;
+    }
+
+    if (_offlineCount == OFFLINE_SLOTS) {
+        _offlineHead = (_offlineHead + 1) % OFFLINE_SLOTS;
+        _offlineCount--;
+        _offlineDropped++;
+    }
+    _offline[(_offlineHead + _offlineCount) % OFFLINE_SLOTS] = sample;
+    _offlineCount++;
+}
+
+void OSCManager::sendNow(const OscSample& sample, DataMode mode, bool network) {
+    // Skipped samples do not take a sequence number, so thinning is not reported as loss by the host. The sequence is
+    // shared by every destination, so serial and WebSocket follow the WiFi rate too: sending them the samples WiFi
+    // skips would either repeat numbers or open gaps in the network stream.
+    _rate.update(millis());
+    if (!_rate.admit(micros())) return;
+
+    const uint8_t modeStreams = mode == DataMode::FILTERED ? OSC_STREAM_EULER : OSC_STREAM_RAW;
+    _sequence++;
+
+    // Streams due for each destination on this sample
+    uint8_t due[OSC_MAX_DESTINATIONS];
+    uint8_t wanted = 0;
+
+    for (size_t i = 0; i < _destinationCount; ++i) {
+        OscDestination& destination = _destinations[i];
+        due[i]                      = 0;
+
+        if (destination.transport == &_network ? !network : !destination.transport->isReady()) continue;
+        if (++destination.counter < destination.decimation) continue;
+        destination.counter = 0;
+
+        due[i] = destination.streams & ~OSC_STREAM_MODE;
+        if (destination.streams & OSC_STREAM_MODE) due[i] |= modeStreams;
+        wanted |= due[i];
+    }
+
+    if (_rate.isCoalescing()) {
+        // One datagram per destination instead of one per stream, the bundle differs with each subscription
+        for (size_t i = 0; i < _destinationCount; ++i) {
+            uint8_t oscStreams = due[i] & (OSC_STREAM_EULER | OSC_STREAM_RAW);
+            if (oscStreams && encodeBundle(sample, oscStreams)) sendBuffer(_destinations[i]);
+        }
+    } else {
+        for (const auto& stream : FLOAT3_STREAMS) {
+            if (!(wanted & stream.stream)) continue;
 
-void OSCManager::sendEulerAngles(float roll, float pitch, float yaw) {
-    if (!isReady()) {
-        if (!_initialized && wifiManager.isConnected()) {
-            begin();
+            if (!beginMessage()) continue;
+            _bufferIndex = stream.encode(_buffer, sample);
+            fanOut(stream.stream, due);
         }
-        if (!isReady()) return;
     }
 
-    sendFloat3(OSC_ADDRESS_EULER, roll, pitch, yaw);
+    if ((wanted & OSC_STREAM_FRAME) && encodeFrame(sample)) {
+        fanOut(OSC_STREAM_FRAME, due);
+    }
 }
 
-void OSCManager::sendFloat(const char* address, float value) {
-    if (!isReady()) return;
+void OSCManager::fanOut(uint8_t stream, const uint8_t* due) {
+    for (size_t i = 0; i < _destinationCount; ++i) {
+        if (due[i] & stream) sendBuffer(_destinations[i]);
+    }
+}
 
-    _bufferIndex = 0;
+bool OSCManager::encodeBundle(const OscSample& sample, uint8_t streams) {
+    if (!beginMessage()) return false;
+
+    memcpy(_buffer, BUNDLE_HEADER, sizeof(BUNDLE_HEADER));
+    _bufferIndex = sizeof(BUNDLE_HEADER);
+
+    for (const auto& stream : FLOAT3_STREAMS) {
+        if (!(streams & stream.stream)) continue;
+
+        // Each element is its size followed by the message
+        size_t size = stream.encode(_buffer + _bufferIndex + 4, sample);
+        _bufferIndex += osc::writeWord(_buffer + _bufferIndex, (uint32_t)size) + size;
+    }
+    return true;
+}
+
+bool OSCManager::encodeFrame(const OscSample& sample) {
+    if (!beginMessage()) return false;
+
+    WiiconFrame frame;
+    frame.flags     = FRAME_HAS_ACCEL | FRAME_HAS_GYRO | FRAME_HAS_QUAT | (sample.hostTime ? FRAME_HOST_TIME : 0);
+    frame.deviceId  = _deviceId;
+    frame.sequence  = _sequence;
+    frame.timestamp = sample.timestamp;
+
+    for (int i = 0; i < 3; ++i) {
+        frame.accel[i] = frameQuantize(sample.accel[i], FRAME_ACC_LSB_PER_G);
+        frame.gyro[i]  = frameQuantize(sample.gyro[i], FRAME_GYR_LSB_PER_DPS);
+    }
+    for (int i = 0; i < 4; ++i) frame.quat[i] = sample.quat[i];
+
+    if (OSC_FRAME_REDUNDANCY == 0) {
+        _bufferIndex = frameEncode(frame, _buffer, BUFFER_SIZE);
+        return _bufferIndex > 0;
+    }
+
+    // Repeat the previous frames in every datagram so the host can fill gaps without waiting
+    _frameHead                = (_frameHead + 1) % FRAME_HISTORY;
+    _frameLengths[_frameHead] = frameEncode(frame, _frameHistory[_frameHead], FRAME_MAX_SIZE);
+    if (_frameCount < FRAME_HISTORY) _frameCount++;
+
+    const uint8_t* frames[FRAME_HISTORY];
+    size_t         lengths[FRAME_HISTORY];
+    for (size_t i = 0; i < _frameCount; ++i) {
+        size_t slot = (_frameHead + FRAME_HISTORY - i) % FRAME_HISTORY;
+        frames[i]   = _frameHistory[slot];
+        lengths[i]  = _frameLengths[slot];
+    }
+
+    _bufferIndex = frameBundleEncode(frames, lengths, _frameCount, _buffer, BUFFER_SIZE);
+    return _bufferIndex > 0;
+}
+
+void OSCManager::logStats() {
+    unsigned long now = millis();
+    if (now - _stats.windowStart < OSC_STATS_INTERVAL_MS) return;
+
+    if (_stats.packets > 0) {
+        Log::debug("OSC %s: %lu packets, %lu failed, %.1f us/packet", _network.name(),
+                   (unsigned long)_stats.packets, (unsigned long)_stats.failures,
+                   (float)_stats.sendMicros / (float)_stats.packets);
+    }
+
+    _stats             = {};
+    _stats.windowStart = now;
+}
+
+bool OSCManager::sendEulerAngles(float roll, float pitch, float yaw) {
+    if (!ensureReady()) return false;
+
+    return send<EulerMessage>(roll, pitch, yaw);
+}
+
+bool OSCManager::sendFloat(const char* address, float value) {
+    if (!isReady() || osc::pad4(strlen(address) + 1) + 8 > BUFFER_SIZE || !beginMessage()) return false;
 
     writeOSCString(address);
     writeOSCString(",f");
     writeOSCFloat(value);
 
-    IPAddress targetIP   = getTargetIP();
-
-    _udp.beginPacket(targetIP, OSC_TARGET_PORT);
-    _udp.write(_buffer, _bufferIndex);
-    _udp.endPacket();
+    return sendBuffer(_destinations[0]);
 }
 
-void OSCManager::sendFloat3(const char* address, float v1, float v2, float v3) {
-    if (!isReady()) return;
-
-    _bufferIndex = 0;
+bool OSCManager::sendFloat3(const char* address, float v1, float v2, float v3) {
+    if (!isReady() || osc::pad4(strlen(address) + 1) + 20 > BUFFER_SIZE || !beginMessage()) return false;
 
     writeOSCString(address);
     writeOSCString(",fff");
@@ -99,11 +366,46 @@ void OSCManager::sendFloat3(const char* address, float v1, float v2, float v3) {
     writeOSCFloat(v2);
     writeOSCFloat(v3);
 
-    IPAddress targetIP   = getTargetIP();
+    return sendBuffer(_destinations[0]);
+}
+
+bool OSCManager::beginMessage() {
+    _bufferIndex = 0;
 
-    _udp.beginPacket(targetIP, OSC_TARGET_PORT);
-    _udp.write(_buffer, _bufferIndex);
-    _udp.endPacket();
+    // The network transport may lend its own buffer (lwIP pbuf) so the common case is sent without a copy
+    _buffer = _network.acquire(_txBuffer);
+    if (!_buffer) {
+        // Every pbuf still in flight, the TX queue is backed up
+        _buffer = _txBuffer;
+        _stats.failures++;
+        _totalFailures++;
+        _rate.recordSend(false, 0);
+        return false;
+    }
+
+    return true;
+}
+
+bool OSCManager::sendBuffer(const OscDestination& destination) {
+    bool network = destination.transport == &_network;
+    if (network && _targetDirty) resolveTarget();
+
+    unsigned long start = micros();
+    bool          sent  = destination.transport->send(destination, _buffer, _bufferIndex);
+
+    uint32_t elapsed = micros() - start;
+    _totalPackets++;
+    if (!sent) _totalFailures++;
+    if (!network) return sent;
+
+    // The window statistics compare the two UDP paths, a serial or WebSocket send would skew the time per packet
+    _stats.sendMicros += elapsed;
+    _stats.packets++;
+    if (!sent) _stats.failures++;
+
+    // Only WiFi sends drive the rate, a serial port nobody reads must not throttle every transport
+    _rate.recordSend(sent, elapsed);
+    return sent;
 }
 
 void OSCManager::writeOSCString(const char* str) {
@@ -125,10 +427,7 @@ void OSCManager::writeOSCFloat(float value) {
     u.f = value;
 
     // OSC uses big-endian (network byte order)
-    _buffer[_bufferIndex++] = (u.i >> 24) & 0xFF;
-    _buffer[_bufferIndex++] = (u.i >> 16) & 0xFF;
-    _buffer[_bufferIndex++] = (u.i >> 8) & 0xFF;
-    _buffer[_bufferIndex++] = u.i & 0xFF;
+    _bufferIndex += osc::writeWord(_buffer + _bufferIndex, u.i);
 }
 
 void OSCManager::padToFourBytes() {
@@ -137,18 +436,48 @@ void OSCManager::padToFourBytes() {
     }
 }
 
-IPAddress OSCManager::getTargetIP() const {
-    String configIP = wifiManager.getOscIP();
+void OSCManager::setDiscoveredTarget(const IPAddress& ip, uint16_t port) {
+    _discoveredIP   = ip;
+    _discoveredPort = port;
+    invalidateTarget();
+}
 
-    if (configIP.length() > 0) {
-        IPAddress targetIP;
-        targetIP.fromString(configIP.c_str());
-        return targetIP;
-    } else {
-        IPAddress localIP = WiFi.localIP();
-        IPAddress subnet  = WiFi.subnetMask();
+const OscDestination& OSCManager::getPrimaryDestination() {
+    // Without a connection the broadcast fallback has no subnet, the target stays dirty until there is one
+    if (_targetDirty && wifiManager.isConnected()) resolveTarget();
+    return _destinations[0];
+}
+
+void OSCManager::resolveTarget() {
+    // Clear first so an IP event arriving mid-resolve schedules another pass
+    _targetDirty = false;
+
+    OscDestination& primary = _destinations[0];
+
+    uint16_t configPort = wifiManager.getOscPort();
+    primary.port        = configPort > 0 ? configPort : OSC_TARGET_PORT;
 
-        return IPAddress(localIP[0] | ~subnet[0], localIP[1] | ~subnet[1], localIP[2] | ~subnet[2],
-                         localIP[3] | ~subnet[3]);
+    const char* configIP = wifiManager.getOscIP();
+
+    if (configIP[0] != '\0' && primary.ip.fromString(configIP)) {
+        return;
+    }
+
+    // Unicast to a receiver that announced itself costs less airtime than the multicast default
+    if (_discoveredPort != 0) {
+        primary.ip   = _discoveredIP;
+        primary.port = _discoveredPort;
+        return;
     }
+
+    // Multicast is acknowledged by the AP on the uplink, unlike broadcast, so it is the preferred default
+    if (OSC_TARGET_IP[0] != '\0' && primary.ip.fromString(OSC_TARGET_IP)) {
+        return;
+    }
+
+    IPAddress localIP = WiFi.localIP();
+    IPAddress subnet  = WiFi.subnetMask();
+
+    primary.ip = IPAddress(localIP[0] | ~subnet[0], localIP[1] | ~subnet[1], localIP[2] | ~subnet[2],
+                           localIP[3] | ~subnet[3]);
 }
\ No newline at end of file
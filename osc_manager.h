@@ -2,8 +2,9 @@
  * @file        osc_manager.h
  * @brief       OSC (Open Sound Control) manager for the Wiicon Remote project
  *
- * @details     Provides functions for sending sensor data via OSC over UDP.
- *              Supports configurable target IP, port, and OSC address patterns.
+ * @details     Provides functions for sending sensor data via OSC. Packets are encoded
+ *              once per sample and delivered through the transport of each destination
+ *              (osc_transport.h). Supports configurable target IP, port, and OSC address patterns.
  *
  * @author      See AUTHORS file for full list of contributors
  * @date        2025
@@ -39,14 +40,42 @@
 #define OSC_MANAGER_H
 
 #include <Arduino.h>
-#include <WiFiUdp.h>
 
 #include "config.h"
 #include "logger.h"
+#include "osc_message.h"
+#include "osc_transport.h"
+#include "rate_controller.h"
+#include "udp_transport.h"
 #include "wifi_manager.h"
+#include "wiicon_frame.h"
+
+/**
+ * One sensor sample as published over OSC
+ */
+struct OscSample {
+    float    euler[3];  /**< Roll, pitch, yaw in degrees */
+    float    accel[3];  /**< Mapped acceleration in g */
+    float    gyro[3];   /**< Mapped, bias-corrected angular velocity in deg/s */
+    float    quat[4];   /**< Orientation quaternion (w, x, y, z) */
+    uint32_t timestamp; /**< Sensor read time (device micros, or low 32 bits of host micros if hostTime) */
+    bool     hostTime;  /**< Whether timestamp was converted to host time by the clock sync */
+};
+
+/**
+ * OSC send statistics of the network transport over the current measurement window
+ */
+struct OscSendStats {
+    uint32_t      packets;     /**< Datagrams handed to the network transport */
+    uint32_t      failures;    /**< Datagrams it rejected, or that found every lwIP pbuf in flight */
+    uint32_t      sendMicros;  /**< Time spent inside it */
+    unsigned long windowStart; /**< Start of the window (millis) */
+};
 
 class OSCManager {
    public:
+    static constexpr size_t BUFFER_SIZE = 256; /**< Capacity of the message buffer */
+
     /**
      * Get the singleton instance of the OSC manager
      * @return Reference to the OSC manager instance
@@ -54,41 +83,157 @@ class OSCManager {
     static OSCManager& instance();
 
     /**
-     * Initialize the OSC manager
+     * Initialize the OSC manager and its destination table
+     * Does not need WiFi; the UDP transport is started once the network is up.
      * @return true if initialization as successful
      */
     bool begin();
 
     /**
-     * Send Euler angles via OSC
+     * Send one sensor sample to every destination
+     * Each stream is encoded once and the same buffer is sent to every destination that subscribes to it and is
+     * due according to its decimation. Under WiFi congestion the rate controller skips samples for every transport
+     * (they share the frame sequence) and coalesces the OSC messages of each destination into one bundle. While no
+     * transport is ready the sample is held or dropped according to OSC_OFFLINE_BUFFER, and held samples are sent
+     * oldest first once a transport comes up.
+     * @param sample Sensor sample with Euler angles and raw data in physical units
+     * @param mode Data mode used by destinations subscribed to OSC_STREAM_MODE
+     */
+    void sendSample(const OscSample& sample, DataMode mode);
+
+    /**
+     * Add a destination to the fan-out table
+     * @param ip Target IP address
+     * @param port Target port
+     * @param streams Bitmask of OSC_STREAM_* values
+     * @param decimation Send every Nth sample (1 = full rate)
+     * @param transport Transport to reach the destination through, nullptr for UDP
+     * @return true if the destination was added, false if the table is full
+     */
+    bool addDestination(const IPAddress& ip, uint16_t port, uint8_t streams, uint8_t decimation = 1,
+                        OscTransport* transport = nullptr);
+
+    /**
+     * Remove every destination except the primary one
+     */
+    void clearDestinations() { _destinationCount = 1; }
+
+    /**
+     * Send Euler angles to the primary destination via OSC
      * @param roll Roll angle in degrees
      * @param pitch Pitch angle in degrees
      * @param yaw Yaw angle in degrees
+     * @return true if the message was sent
      */
-    void sendEulerAngles(float roll, float pitch, float yaw);
+    bool sendEulerAngles(float roll, float pitch, float yaw);
+
+    /**
+     * Send a typed message to the primary destination
+     * @tparam Message osc::Message type, checked against BUFFER_SIZE at compile time
+     * @param values Argument values
+     * @return true if the message was sent
+     */
+    template <typename Message, typename... Values>
+    bool send(Values... values) {
+        if (!isReady() || !beginMessage()) return false;
+
+        _bufferIndex = Message::template encode<BUFFER_SIZE>(_buffer, values...);
+        return _bufferIndex > 0 && sendBuffer(_destinations[0]);
+    }
 
     /**
-     * Send a single float value via OSC
+     * Send a single float value to the primary destination via OSC
      * @param address OSC address pattern (e.g., "/wiicon/roll")
      * @param value Float value to send
+     * @return true if the message was sent, false if not ready or the address does not fit the buffer
      */
-    void sendFloat(const char* address, float value);
+    bool sendFloat(const char* address, float value);
 
     /**
-     * Send three float values via OSC
+     * Send three float values to the primary destination via OSC
      * @param address OSC address pattern (e.g., "/wiicon/euler")
      * @param v1 First float value
      * @param v2 Second float value
      * @param v3 Third float value
+     * @return true if the message was sent, false if not ready or the address does not fit the buffer
      */
-    void sendFloat3(const char* address, float v1, float v2, float v3);
+    bool sendFloat3(const char* address, float v1, float v2, float v3);
 
     /**
-     * Check if OSC is ready to send (WiFi connected, not in AP mode)
+     * Check if OSC is ready to send over the network (WiFi connected, not in AP mode)
      * @return true if ready
      */
     bool isReady() const;
 
+    /**
+     * Check if the cached primary target is a multicast group
+     * @return true if the target address is in 224.0.0.0/4
+     */
+    bool isMulticastTarget() const { return (_destinations[0].ip[0] & 0xF0) == 0xE0; }
+
+    /**
+     * Mark the cached target address as stale
+     * The target is resolved again before the next packet is sent. Called on WiFi IP events and whenever the
+     * configured OSC IP changes, so the per-packet path never parses strings or queries the network stack.
+     */
+    void invalidateTarget() { _targetDirty = true; }
+
+    /**
+     * Send the primary streams to a receiver found over mDNS, unless an OSC IP is configured
+     * @param ip Receiver address
+     * @param port Receiver port, 0 = go back to the default target
+     */
+    void setDiscoveredTarget(const IPAddress& ip, uint16_t port);
+
+    /**
+     * Get the network send statistics of the current measurement window
+     * @return Send statistics
+     */
+    const OscSendStats& getStats() const { return _stats; }
+
+    /**
+     * Get the number of datagrams handed to the transports since boot
+     * @return Datagrams sent or attempted
+     */
+    uint32_t getTotalPackets() const { return _totalPackets; }
+
+    /**
+     * Get the number of datagrams that could not be sent since boot
+     * @return Failed datagrams
+     */
+    uint32_t getTotalFailures() const { return _totalFailures; }
+
+    /**
+     * Get the number of samples held while no transport is ready
+     * @return Held samples
+     */
+    size_t getOfflineCount() const { return _offlineCount; }
+
+    /**
+     * Get the output rate controller
+     * @return Rate controller
+     */
+    const RateController& getRateController() const { return _rate; }
+
+    /**
+     * Report the loss a host observed on the stream (/wiicon/feedback)
+     * @param loss Lost fraction of the stream, 0 to 1
+     */
+    void reportHostLoss(float loss) { _rate.recordHostLoss(loss); }
+
+    /**
+     * Get the primary destination (portal or default target)
+     * Resolves the target first if it changed since the last sample, so other senders never get a stale address.
+     * @return Primary destination
+     */
+    const OscDestination& getPrimaryDestination();
+
+    /**
+     * Get the device id carried in binary frames and events
+     * @return Last octet of the MAC address
+     */
+    uint8_t getDeviceId() const { return _deviceId; }
+
     OSCManager(const OSCManager&)            = delete;
     OSCManager& operator=(const OSCManager&) = delete;
 
@@ -116,16 +261,112 @@ class OSCManager {
     void padToFourBytes();
 
     /**
-     * Get the target IP address for OSC messages
-     * Uses configured IP if available, otherwise calculates network broadcast address
-     * @return Target IP address
+     * Encode a compact binary frame into the OSC buffer
+     * With OSC_FRAME_REDUNDANCY > 0 the frame is wrapped in a bundle that repeats the previous frames.
+     * @param sample Sensor sample
+     * @return true if the frame was encoded
      */
-    IPAddress getTargetIP() const;
+    bool encodeFrame(const OscSample& sample);
+
+    /**
+     * Encode and send one sample to every ready destination
+     * @param sample Sensor sample
+     * @param mode Data mode used by destinations subscribed to OSC_STREAM_MODE
+     * @param network Whether the network transport is ready
+     */
+    void sendNow(const OscSample& sample, DataMode mode, bool network);
+
+    /**
+     * Hold a sample while offline, dropping the oldest one when the buffer is full
+     * @param sample Sensor sample
+     */
+    void holdOffline(const OscSample& sample);
+
+    /**
+     * Send the current buffer to every destination due for a stream
+     * @param stream OSC_STREAM_* value
+     * @param due Streams due for each destination
+     */
+    void fanOut(uint8_t stream, const uint8_t* due);
+
+    /**
+     * Start a new message in the OSC buffer
+     * @return true if a buffer is available
+     */
+    bool beginMessage();
+
+    /**
+     * Log and reset the send statistics once per OSC_STATS_INTERVAL_MS
+     */
+    void logStats();
+
+    /**
+     * Encode the due OSC streams of one sample into a single bundle with an immediate timetag
+     * @param sample Sensor sample
+     * @param streams Bitmask of OSC_STREAM_EULER, OSC_STREAM_ACCEL and OSC_STREAM_GYRO
+     * @return true if the bundle was encoded
+     */
+    bool encodeBundle(const OscSample& sample, uint8_t streams);
+
+    /**
+     * Make sure the manager is initialized and WiFi is up
+     * @return true if ready to send
+     */
+    bool ensureReady();
+
+    /**
+     * Resolve the primary target address and port for OSC messages into the cache
+     * Uses the configured IP if available, then a receiver found over mDNS, otherwise the default OSC_TARGET_IP (a
+     * multicast group). When all are empty or invalid, falls back to the network broadcast address.
+     */
+    void resolveTarget();
+
+    /**
+     * Send the current buffer to a destination
+     * @param destination Destination to send to
+     * @return true if the transport accepted the datagram
+     */
+    bool sendBuffer(const OscDestination& destination);
+
+    /**
+     * WiFi event handler that invalidates the cached target on IP changes
+     * @param event WiFi event identifier
+     */
+    static void onWiFiEvent(arduino_event_id_t event);
+
+    static constexpr size_t FRAME_HISTORY = OSC_FRAME_REDUNDANCY + 1; /**< Frames kept for forward redundancy */
+    static constexpr size_t OFFLINE_SLOTS = OSC_OFFLINE_BUFFER > 0 ? OSC_OFFLINE_BUFFER : 1; /**< Offline ring size */
+
+    static_assert(OSC_FRAME_REDUNDANCY <= FRAME_MAX_REDUNDANCY, "OSC_FRAME_REDUNDANCY is too large");
+#if OSC_USE_LWIP_TX
+    static_assert(LwipUdpSender::CAPACITY >= BUFFER_SIZE, "lwIP pbufs are smaller than the message buffer");
+#endif
 
-    WiFiUDP _udp;         /**< UDP instance for OSC communication */
-    bool    _initialized; /**< Whether the OSC manager is initialized */
-    uint8_t _buffer[256]; /**< Buffer for the OSC message */
-    size_t  _bufferIndex; /**< Index of the current position in the buffer */
+    UdpTransport   _network;                                     /**< Default transport of the destinations */
+    uint8_t        _txBuffer[BUFFER_SIZE];                       /**< Buffer for transports without their own */
+    bool           _initialized;                                 /**< Whether the OSC manager is initialized */
+    uint8_t*       _buffer;                                      /**< Buffer the current message is encoded into */
+    size_t         _bufferIndex;                                 /**< Index of the current position in the buffer */
+    OscDestination _destinations[OSC_MAX_DESTINATIONS];          /**< Fan-out table, entry 0 is the primary target */
+    size_t         _destinationCount;                            /**< Number of used entries in the fan-out table */
+    volatile bool  _targetDirty;                                 /**< Whether the primary target is stale */
+    IPAddress      _discoveredIP;                                /**< Receiver found over mDNS */
+    uint16_t       _discoveredPort;                              /**< Its port, 0 = none */
+    OscSendStats   _stats;                                       /**< Send statistics of the current window */
+    uint32_t       _totalPackets;                                /**< Datagrams handed to the transports since boot */
+    uint32_t       _totalFailures;                               /**< Datagrams not sent since boot */
+    RateController _rate;                                        /**< Adaptive output rate under congestion */
+    uint8_t        _deviceId;                                    /**< Device id carried in binary frames */
+    uint16_t       _sequence;                                    /**< Sample sequence number */
+    uint8_t        _frameHistory[FRAME_HISTORY][FRAME_MAX_SIZE]; /**< Last encoded frames, ring buffer */
+    size_t         _frameLengths[FRAME_HISTORY];                 /**< Length of each frame in the history */
+    size_t         _frameHead;                                   /**< Slot of the newest frame */
+    size_t         _frameCount;                                  /**< Number of frames in the history */
+    OscSample      _offline[OFFLINE_SLOTS];                      /**< Samples held while offline, ring buffer */
+    size_t         _offlineHead;                                 /**< Slot of the oldest held sample */
+    size_t         _offlineCount;                                /**< Number of held samples */
+    uint32_t       _offlineDropped;                              /**< Samples dropped since the link went down */
+    bool           _wasOffline;                                  /**< Whether no transport was ready last sample */
 };
 
 /**
@@ -0,0 +1,266 @@
+/**
+ * @file        osc_parser.h
+ * @brief       Bounds-checked OSC message parser for the Wiicon Remote project
+ *
+ * @details     Validates an incoming OSC message in place (address, type tags and the size
+ *              of every argument) before any argument is read, so malformed or truncated
+ *              datagrams are rejected without touching memory past the end of the packet.
+ *              Header-only and free of Arduino dependencies so it can be fuzzed on the host.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef OSC_PARSER_H
+#define OSC_PARSER_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Parsed view of an OSC message, pointing into the original datagram
+ */
+struct OscMessageView {
+    const char*    address;    /**< NUL-terminated address pattern */
+    const char*    typeTags;   /**< NUL-terminated type tags, without the leading ',' */
+    const uint8_t* args;       /**< First argument */
+    size_t         argsLength; /**< Bytes from args to the end of the datagram */
+};
+
+/**
+ * FNV-1a hash of an OSC address, usable at compile time to build dispatch tables
+ * @param str NUL-terminated address
+ * @return 32-bit hash
+ */
+constexpr uint32_t oscHash(const char* str) {
+    uint32_t hash = 2166136261u;
+    while (*str) hash = (hash ^ (uint8_t)*str++) * 16777619u;
+    return hash;
+}
+
+/**
+ * Measure a padded OSC string
+ * @param data String start
+ * @param length Bytes available
+ * @return Padded size including the terminator, 0 if the string is not terminated within length
+ */
+inline size_t oscStringSize(const uint8_t* data, size_t length) {
+    const void* end = memchr(data, '\0', length);
+    if (!end) return 0;
+
+    size_t size = (((const uint8_t*)end - data) + 4) & ~(size_t)3;
+    return size <= length ? size : 0;
+}
+
+/**
+ * Size of one argument in the message body
+ * @param tag Type tag
+ * @param data Argument start
+ * @param length Bytes available
+ * @return Argument size in bytes, or SIZE_MAX if the tag is unknown or the argument is truncated
+ */
+inline size_t oscArgSize(char tag, const uint8_t* data, size_t length) {
+    size_t size;
+    switch (tag) {
+        case 'i':
+        case 'f':
+        case 'c':
+        case 'r':
+        case 'm':
+            size = 4;
+            break;
+        case 'h':
+        case 't':
+        case 'd':
+            size = 8;
+            break;
+        case 'T':
+        case 'F':
+        case 'N':
+        case 'I':
+            return 0;
+        case 's':
+        case 'S':
+            size = oscStringSize(data, length);
+            return size > 0 ? size : SIZE_MAX;
+        case 'b': {
+            if (length < 4) return SIZE_MAX;
+            uint32_t blob = ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+            if (blob > length - 4) return SIZE_MAX;
+            size = 4 + ((blob + 3) & ~(size_t)3);
+            break;
+        }
+        default:
+            return SIZE_MAX;
+    }
+    return size <= length ? size : SIZE_MAX;
+}
+
+/**
+ * Parse and validate an OSC message
+ * Bundles are not accepted. Every argument listed in the type tags must fit in the datagram.
+ * @param data Datagram
+ * @param length Datagram length in bytes
+ * @param message Output view into data
+ * @return true if the datagram is a well-formed OSC message
+ */
+inline bool oscParseMessage(const uint8_t* data, size_t length, OscMessageView* message) {
+    if (length < 8 || length % 4 != 0 || data[0] != '/') return false;
+
+    size_t addressSize = oscStringSize(data, length);
+    if (addressSize == 0 || addressSize >= length || data[addressSize] != ',') return false;
+
+    size_t tagsSize = oscStringSize(data + addressSize, length - addressSize);
+    if (tagsSize == 0) return false;
+
+    message->address    = (const char*)data;
+    message->typeTags   = (const char*)data + addressSize + 1;
+    message->args       = data + addressSize + tagsSize;
+    message->argsLength = length - addressSize - tagsSize;
+
+    size_t offset = 0;
+    for (const char* tag = message->typeTags; *tag; ++tag) {
+        size_t size = oscArgSize(*tag, message->args + offset, message->argsLength - offset);
+        if (size == SIZE_MAX) return false;
+        offset += size;
+    }
+
+    return true;
+}
+
+/**
+ * Sequential reader over the arguments of a validated message
+ */
+class OscArgReader {
+   public:
+    /**
+     * Constructor
+     * @param message Message validated by oscParseMessage()
+     */
+    explicit OscArgReader(const OscMessageView& message)
+        : _tag(message.typeTags), _data(message.args), _length(message.argsLength) {}
+
+    /**
+     * Number of arguments not read yet
+     */
+    size_t remaining() const { return strlen(_tag); }
+
+    /**
+     * Read a number given as int32 or float
+     * @param value Output value
+     * @return true if the next argument is numeric
+     */
+    bool readFloat(float* value) {
+        if (*_tag == 'f') {
+            uint32_t bits = readWord();
+            memcpy(value, &bits, sizeof(*value));
+            return true;
+        }
+        if (*_tag == 'i') {
+            *value = (float)(int32_t)readWord();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Read an integer given as int32 or float (truncated, clamped to the int32 range)
+     * @param value Output value
+     * @return true if the next argument is numeric, false for a NaN float (the argument is still consumed)
+     */
+    bool readInt(int32_t* value) {
+        if (*_tag == 'i') {
+            *value = (int32_t)readWord();
+            return true;
+        }
+        float f;
+        if (!readFloat(&f) || isnan(f)) return false;
+
+        // Converting a float outside the int32 range is undefined, and the value comes straight from the network
+        if (f >= 2147483648.0f) {
+            *value = INT32_MAX;
+        } else if (f <= -2147483648.0f) {
+            *value = INT32_MIN;
+        } else {
+            *value = (int32_t)f;
+        }
+        return true;
+    }
+
+    /**
+     * Read a 64-bit integer given as int64 or int32
+     * @param value Output value
+     * @return true if the next argument is an integer
+     */
+    bool readInt64(int64_t* value) {
+        if (*_tag == 'i') {
+            *value = (int32_t)readWord();
+            return true;
+        }
+        if (*_tag != 'h') return false;
+        uint64_t word = 0;
+        for (int i = 0; i < 8; ++i) word = (word << 8) | _data[i];
+        advance(8);
+        *value = (int64_t)word;
+        return true;
+    }
+
+    /**
+     * Read a string
+     * @param value Output pointer into the datagram
+     * @return true if the next argument is a string
+     */
+    bool readString(const char** value) {
+        if (*_tag != 's' && *_tag != 'S') return false;
+        size_t size = oscStringSize(_data, _length);
+        *value      = (const char*)_data;
+        advance(size);
+        return true;
+    }
+
+   private:
+    uint32_t readWord() {
+        uint32_t word = ((uint32_t)_data[0] << 24) | ((uint32_t)_data[1] << 16) | ((uint32_t)_data[2] << 8) | _data[3];
+        advance(4);
+        return word;
+    }
+
+    void advance(size_t size) {
+        _data += size;
+        _length -= size;
+        _tag++;
+    }
+
+    const char*    _tag;    /**< Type tag of the next argument */
+    const uint8_t* _data;   /**< Next argument */
+    size_t         _length; /**< Bytes left */
+};
+
+#endif  // OSC_PARSER_H
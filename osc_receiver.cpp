@@ -0,0 +1,277 @@
+/**
+ * @file        osc_receiver.cpp
+ * @brief       OSC receiver implementation for the Wiicon Remote project
+ *
+ * @details     Implements the OscReceiver class declared in osc_receiver.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "osc_receiver.h"
+#include "profile_manager.h"
+#include "settings_registry.h"
+
+OscReceiver& oscReceiver = OscReceiver::instance();
+
+namespace {
+
+/**
+ * Device id, data mode (0 = raw, 1 = filtered), rate setting (Hz), measured rate (Hz), beta, uptime (s)
+ */
+using StatusMessage = osc::Message<"/wiicon/status", int32_t, int32_t, float, float, float, float>;
+
+/**
+ * Device id, profile name, measured latency (ms), estimated current (mA), output rate (Hz)
+ */
+using ProfileMessage = osc::Message<"/wiicon/profile", int32_t, osc::String<23>, float, float, float>;
+
+/**
+ * Device id, setting name, current value (empty for secrets)
+ */
+using SettingMessage = osc::Message<"/wiicon/setting", int32_t, osc::String<23>, osc::String<64>>;
+
+}  // namespace
+
+constexpr OscReceiver::Route OscReceiver::ROUTES[] = {
+    {"/wiicon/set/rate", &OscReceiver::handleSetRate},
+    {"/wiicon/set/beta", &OscReceiver::handleSetBeta},
+    {"/wiicon/set/mode", &OscReceiver::handleSetMode},
+    {"/wiicon/get/status", &OscReceiver::handleGetStatus},
+    {"/wiicon/feedback", &OscReceiver::handleFeedback},
+    {"/wiicon/set/wsrate", &OscReceiver::handleSetWebSocketRate},
+    {"/wiicon/set/profile", &OscReceiver::handleSetProfile},
+    {"/wiicon/get/profile", &OscReceiver::handleGetProfile},
+    {"/wiicon/set/setting", &OscReceiver::handleSetSetting},
+    {"/wiicon/get/setting", &OscReceiver::handleGetSetting},
+};
+
+constexpr std::array<int8_t, OscReceiver::TABLE_SIZE> OscReceiver::buildTable() {
+    static_assert(sizeof(ROUTES) / sizeof(ROUTES[0]) < TABLE_SIZE, "TABLE_SIZE must leave an empty slot");
+
+    std::array<int8_t, TABLE_SIZE> table{};
+    for (int8_t& slot : table) slot = -1;
+
+    for (size_t i = 0; i < sizeof(ROUTES) / sizeof(ROUTES[0]); ++i) {
+        size_t slot = oscHash(ROUTES[i].address) & (TABLE_SIZE - 1);
+        while (table[slot] >= 0) slot = (slot + 1) & (TABLE_SIZE - 1);
+        table[slot] = (int8_t)i;
+    }
+
+    return table;
+}
+
+constexpr std::array<int8_t, OscReceiver::TABLE_SIZE> OscReceiver::TABLE = OscReceiver::buildTable();
+
+OscReceiver& OscReceiver::instance() {
+    static OscReceiver instance;
+    return instance;
+}
+
+OscReceiver::OscReceiver() : _initialized(false) {}
+
+bool OscReceiver::begin() {
+    if (_initialized) {
+        return true;
+    }
+
+    if (!oscManager.isReady()) {
+        return false;
+    }
+
+    if (!_udp.begin(OSC_RECEIVE_PORT)) {
+        Log::error("OSC: failed to bind receive port %d", OSC_RECEIVE_PORT);
+        return false;
+    }
+
+    _initialized = true;
+    Log::info("OSC receiver listening on port %d", OSC_RECEIVE_PORT);
+    return true;
+}
+
+void OscReceiver::loop() {
+    if (!begin()) return;
+
+    for (int i = 0; i < OSC_RECEIVE_MAX_PER_LOOP; ++i) {
+        int size = _udp.parsePacket();
+        if (size <= 0) return;
+
+        // Oversized datagrams are never valid commands, drop them without reading
+        if ((size_t)size > sizeof(_packet)) {
+            _udp.flush();
+            continue;
+        }
+
+        int length = _udp.read(_packet, sizeof(_packet));
+        if (length > 0) dispatch(_packet, (size_t)length);
+    }
+}
+
+const OscReceiver::Route* OscReceiver::findRoute(const char* address) {
+    size_t slot = oscHash(address) & (TABLE_SIZE - 1);
+
+    for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+        int8_t index = TABLE[slot];
+        if (index < 0) return nullptr;
+        if (strcmp(ROUTES[index].address, address) == 0) return &ROUTES[index];
+        slot = (slot + 1) & (TABLE_SIZE - 1);
+    }
+
+    return nullptr;
+}
+
+void OscReceiver::dispatch(const uint8_t* data, size_t length) {
+    OscMessageView message;
+    if (!oscParseMessage(data, length, &message)) {
+        Log::debug("OSC: dropped malformed message (%u bytes)", (unsigned)length);
+        return;
+    }
+
+    const Route* route = findRoute(message.address);
+    if (!route) {
+        Log::debug("OSC: no handler for %s", message.address);
+        return;
+    }
+
+    OscArgReader args(message);
+    (this->*route->handler)(args);
+}
+
+void OscReceiver::handleSetRate(OscArgReader& args) {
+    float hz;
+    if (!args.readFloat(&hz)) return;
+    actionSetSampleRate(hz);
+}
+
+void OscReceiver::handleSetBeta(OscArgReader& args) {
+    float gain;
+    if (!args.readFloat(&gain)) return;
+    settingsRegistry.set("beta", gain, SettingSource::NETWORK);
+}
+
+void OscReceiver::handleSetMode(OscArgReader& args) {
+    const char* name;
+    int32_t     value;
+
+    if (args.readString(&name)) {
+        if (strcmp(name, "raw") == 0) {
+            actionSetDataMode(DataMode::RAW);
+        } else if (strcmp(name, "filtered") == 0) {
+            actionSetDataMode(DataMode::FILTERED);
+        }
+    } else if (args.readInt(&value)) {
+        actionSetDataMode(value == 0 ? DataMode::RAW : DataMode::FILTERED);
+    }
+}
+
+void OscReceiver::handleFeedback(OscArgReader& args) {
+    float loss;
+    if (!args.readFloat(&loss) || !(loss >= 0.0f && loss <= 1.0f)) return;
+    oscManager.reportHostLoss(loss);
+}
+
+void OscReceiver::handleSetWebSocketRate(OscArgReader& args) {
+    float hz;
+    if (!args.readFloat(&hz)) return;
+    settingsRegistry.set("ws_rate", hz, SettingSource::NETWORK);
+}
+
+void OscReceiver::handleGetStatus(OscArgReader& args) {
+    int32_t  port  = 0;
+    uint16_t reply = args.readInt(&port) && port > 0 && port <= 65535 ? (uint16_t)port : _udp.remotePort();
+    float    rate  = sampleIntervalUs > 0 ? 1000000.0f / (float)sampleIntervalUs : 0.0f;
+
+    uint8_t status[StatusMessage::MAX_SIZE];
+    size_t  length = StatusMessage::encode(status, oscManager.getDeviceId(), dataMode == DataMode::RAW ? 0 : 1, rate,
+                                           sampleFreq, beta, millis() / 1000.0f);
+
+    _udp.beginPacket(_udp.remoteIP(), reply);
+    _udp.write(status, length);
+    _udp.endPacket();
+}
+
+void OscReceiver::handleSetProfile(OscArgReader& args) {
+    const char* name;
+    if (!args.readString(&name)) return;
+    settingsRegistry.set("profile", name, SettingSource::NETWORK);
+}
+
+void OscReceiver::handleGetProfile(OscArgReader& args) {
+    const PerformanceProfile& profile = profileManager.getProfile();
+
+    int32_t  port  = 0;
+    uint16_t reply = args.readInt(&port) && port > 0 && port <= 65535 ? (uint16_t)port : _udp.remotePort();
+
+    uint8_t message[ProfileMessage::MAX_SIZE];
+    size_t  length = ProfileMessage::encode(message, oscManager.getDeviceId(), osc::String<23>{profile.name},
+                                            profileManager.getLatencyMs(), profile.currentMa, profile.outputHz);
+
+    _udp.beginPacket(_udp.remoteIP(), reply);
+    _udp.write(message, length);
+    _udp.endPacket();
+}
+
+void OscReceiver::handleSetSetting(OscArgReader& args) {
+    const char* key;
+    const char* text;
+    float       number;
+
+    if (!args.readString(&key)) return;
+
+    // The network settings are left to the portal and the serial console
+    if (args.readString(&text)) {
+        settingsRegistry.set(key, text, SettingSource::NETWORK);
+    } else if (args.readFloat(&number)) {
+        settingsRegistry.set(key, number, SettingSource::NETWORK);
+    }
+}
+
+void OscReceiver::handleGetSetting(OscArgReader& args) {
+    const char* key;
+    if (!args.readString(&key)) return;
+
+    const Setting* setting = SettingsRegistry::find(key);
+    if (!setting) {
+        Log::debug("OSC: no setting %s", key);
+        return;
+    }
+
+    int32_t  port  = 0;
+    uint16_t reply = args.readInt(&port) && port > 0 && port <= 65535 ? (uint16_t)port : _udp.remotePort();
+
+    char value[65];
+    settingsRegistry.format(*setting, value, sizeof(value));
+
+    uint8_t message[SettingMessage::MAX_SIZE];
+    size_t  length =
+        SettingMessage::encode(message, oscManager.getDeviceId(), osc::String<23>{setting->key}, osc::String<64>{value});
+
+    _udp.beginPacket(_udp.remoteIP(), reply);
+    _udp.write(message, length);
+    _udp.endPacket();
+}
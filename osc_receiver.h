@@ -0,0 +1,178 @@
+/**
+ * @file        osc_receiver.h
+ * @brief       OSC receiver for remote control of the Wiicon Remote project
+ *
+ * @details     Listens for OSC messages on OSC_RECEIVE_PORT and dispatches them through a
+ *              hash table built at compile time. Settings are applied between samples from
+ *              the main loop, and status queries are answered to the sender.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef OSC_RECEIVER_H
+#define OSC_RECEIVER_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+#include <array>
+
+#include "actions.h"
+#include "config.h"
+#include "logger.h"
+#include "osc_manager.h"
+#include "osc_parser.h"
+
+class OscReceiver {
+   public:
+    /**
+     * Get the singleton instance of the OSC receiver
+     * @return Reference to the OSC receiver instance
+     */
+    static OscReceiver& instance();
+
+    /**
+     * Bind the receive port
+     * @return true if initialization was successful
+     */
+    bool begin();
+
+    /**
+     * Handle the pending messages, at most OSC_RECEIVE_MAX_PER_LOOP per call
+     * Never blocks. Must be called between samples.
+     */
+    void loop();
+
+    OscReceiver(const OscReceiver&)            = delete;
+    OscReceiver& operator=(const OscReceiver&) = delete;
+
+   private:
+    using Handler = void (OscReceiver::*)(OscArgReader& args);
+
+    /**
+     * Entry of the dispatch table
+     */
+    struct Route {
+        const char* address; /**< OSC address */
+        Handler     handler; /**< Member function handling the address */
+    };
+
+    static constexpr size_t TABLE_SIZE = 16; /**< Hash table slots, a power of two larger than the route count */
+
+    /**
+     * Constructor
+     */
+    OscReceiver();
+    ~OscReceiver() = default;
+
+    /**
+     * Validate a datagram and call the handler of its address
+     * @param data Datagram
+     * @param length Datagram length in bytes
+     */
+    void dispatch(const uint8_t* data, size_t length);
+
+    /**
+     * Find the route of an address
+     * @param address NUL-terminated address
+     * @return Route, nullptr if the address is unknown
+     */
+    static const Route* findRoute(const char* address);
+
+    /**
+     * Build the open-addressing table from ROUTES at compile time
+     * @return Index into ROUTES for each slot, -1 = empty
+     */
+    static constexpr std::array<int8_t, TABLE_SIZE> buildTable();
+
+    /**
+     * /wiicon/set/rate [f|i hz] - output rate, 0 = as fast as the sensor loop runs
+     */
+    void handleSetRate(OscArgReader& args);
+
+    /**
+     * /wiicon/set/beta [f] - Madgwick filter gain
+     */
+    void handleSetBeta(OscArgReader& args);
+
+    /**
+     * /wiicon/set/mode [i 0 = raw, 1 = filtered | s "raw" / "filtered"] - data mode
+     */
+    void handleSetMode(OscArgReader& args);
+
+    /**
+     * /wiicon/get/status [i port] - reply with /wiicon/status to the sender, or to port on the sender's address
+     */
+    void handleGetStatus(OscArgReader& args);
+
+    /**
+     * /wiicon/feedback [f loss] - loss fraction a host observed on the stream, drives the output rate control
+     */
+    void handleFeedback(OscArgReader& args);
+
+    /**
+     * /wiicon/set/wsrate [f hz] - rate frames are pushed to WebSocket clients
+     */
+    void handleSetWebSocketRate(OscArgReader& args);
+
+    /**
+     * /wiicon/set/profile [s name] - apply a performance profile and keep it for the next boot
+     */
+    void handleSetProfile(OscArgReader& args);
+
+    /**
+     * /wiicon/get/profile [i port] - reply with /wiicon/profile to the sender, or to port on the sender's address
+     */
+    void handleGetProfile(OscArgReader& args);
+
+    /**
+     * /wiicon/set/setting [s key, s|f|i value] - change any setting of the settings registry
+     */
+    void handleSetSetting(OscArgReader& args);
+
+    /**
+     * /wiicon/get/setting [s key, i port] - reply with /wiicon/setting to the sender, or to port on the sender's
+     * address
+     */
+    void handleGetSetting(OscArgReader& args);
+
+    static const Route                          ROUTES[]; /**< Every handled address */
+    static const std::array<int8_t, TABLE_SIZE> TABLE;    /**< Open-addressing table of indices into ROUTES */
+
+    WiFiUDP _udp;                             /**< Socket bound to OSC_RECEIVE_PORT */
+    uint8_t _packet[OSC_RECEIVE_BUFFER_SIZE]; /**< Receive buffer */
+    bool    _initialized;                     /**< Whether the receive port is bound */
+};
+
+/**
+ * Global instance of the OSC receiver
+ */
+extern OscReceiver& oscReceiver;
+
+#endif  // OSC_RECEIVER_H
@@ -0,0 +1,99 @@
+/**
+ * @file        osc_transport.h
+ * @brief       Output transport interface for the Wiicon Remote project
+ *
+ * @details     Separates packet encoding from delivery: OSCManager encodes each packet once
+ *              and hands it to the transport of every destination that is due. Backends are
+ *              UDP (udp_transport.h), SLIP over USB serial (serial_link.h) and an in-memory
+ *              loopback for host tests and benchmarks (loopback_transport.h).
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef OSC_TRANSPORT_H
+#define OSC_TRANSPORT_H
+
+#include <Arduino.h>
+
+class OscTransport;
+
+/**
+ * Entry of the OSC fan-out table
+ */
+struct OscDestination {
+    IPAddress     ip;         /**< Target IP address (ignored by point-to-point transports) */
+    uint16_t      port;       /**< Target port (ignored by point-to-point transports) */
+    uint8_t       streams;    /**< Bitmask of OSC_STREAM_* values */
+    uint8_t       decimation; /**< Send every Nth sample */
+    uint8_t       counter;    /**< Samples since the last send */
+    OscTransport* transport;  /**< Transport the destination is reached through */
+};
+
+class OscTransport {
+   public:
+    virtual ~OscTransport() = default;
+
+    /**
+     * Get a short name for logs
+     * @return Transport name
+     */
+    virtual const char* name() const = 0;
+
+    /**
+     * Start the transport, called again until it succeeds
+     * @return true if the transport is ready to send
+     */
+    virtual bool begin() = 0;
+
+    /**
+     * Check whether packets can be sent now
+     * Called for every destination on every sample, so it must be cheap.
+     * @return true if ready
+     */
+    virtual bool isReady() const = 0;
+
+    /**
+     * Get the buffer the next packet is encoded into
+     * Transports that send from their own memory return it so the packet is not copied again.
+     * @param fallback Caller's buffer of at least OSCManager::BUFFER_SIZE bytes
+     * @return Buffer to encode into, nullptr if the transport has no free buffer right now
+     */
+    virtual uint8_t* acquire(uint8_t* fallback) { return fallback; }
+
+    /**
+     * Send one packet
+     * @param destination Destination of the packet
+     * @param data Packet, possibly the buffer returned by acquire()
+     * @param length Packet length in bytes
+     * @return true if the transport accepted the packet
+     */
+    virtual bool send(const OscDestination& destination, const uint8_t* data, size_t length) = 0;
+};
+
+#endif  // OSC_TRANSPORT_H
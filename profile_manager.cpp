@@ -0,0 +1,129 @@
+/**
+ * @file        profile_manager.cpp
+ * @brief       Latency and power profiles for the Wiicon Remote project
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "profile_manager.h"
+
+#include <WiFi.h>
+
+#include "actions.h"
+#include "bmi160.h"
+#include "clock_sync.h"
+#include "config_store.h"
+#include "wifi_manager.h"
+
+ProfileManager& profileManager = ProfileManager::instance();
+
+ProfileManager& ProfileManager::instance() {
+    static ProfileManager instance;
+    return instance;
+}
+
+ProfileManager::ProfileManager()
+    : _index(0), _sensorHz(0.0f), _latencySum(0), _latencyCount(0), _windowStart(0), _latencyMs(0.0f) {}
+
+void ProfileManager::begin() {
+    const char* stored = configStore.get().profile;
+    int         index  = find(stored[0] != '\0' ? stored : PROFILE_DEFAULT);
+
+    if (index < 0) {
+        Log::warning("Unknown profile %s, using %s", stored, PROFILE_DEFAULT);
+        index = find(PROFILE_DEFAULT);
+    }
+
+    apply(index >= 0 ? (size_t)index : 0);
+}
+
+bool ProfileManager::select(const char* name) {
+    int index = find(name);
+    if (index < 0) {
+        Log::warning("Unknown profile %s", name);
+        return false;
+    }
+
+    apply((size_t)index);
+    return true;
+}
+
+void ProfileManager::applyRadio() {
+    const PerformanceProfile& profile = getProfile();
+
+    WiFi.setSleep(profile.wifiSleep);
+    WiFi.setTxPower((wifi_power_t)(int)(profile.txPowerDbm * 4.0f));
+}
+
+void ProfileManager::recordLatency(uint32_t micros) {
+    _latencySum += micros;
+    _latencyCount++;
+
+    unsigned long now = millis();
+    if (now - _windowStart < OSC_STATS_INTERVAL_MS) return;
+
+    const ClockEstimator& clock = clockSync.getEstimator();
+
+    // Sensor data is on average half a period old when it is read
+    _latencyMs = (float)_latencySum / (float)_latencyCount / 1000.0f;
+    if (_sensorHz > 0.0f) _latencyMs += 500.0f / _sensorHz;
+    if (clock.synced()) _latencyMs += (float)clock.minRtt() / 2000.0f;
+
+    Log::debug("Profile %s: %.2f ms latency, ~%.0f mA", getProfile().name, _latencyMs, getProfile().currentMa);
+
+    _latencySum   = 0;
+    _latencyCount = 0;
+    _windowStart  = now;
+}
+
+int ProfileManager::find(const char* name) {
+    for (size_t i = 0; i < PROFILE_COUNT; ++i) {
+        if (strcmp(PERFORMANCE_PROFILES[i].name, name) == 0) return (int)i;
+    }
+    return -1;
+}
+
+void ProfileManager::apply(size_t index) {
+    const PerformanceProfile& profile = PERFORMANCE_PROFILES[index];
+
+    _index = index;
+    setCpuFrequencyMhz(profile.cpuMhz);
+    _sensorHz = setBMI160DataRate(profile.sensorHz);
+    actionSetSampleRate(profile.outputHz);
+    if (wifiManager.isConnected()) applyRadio();
+
+    // Measurements of the previous profile do not describe this one
+    _latencySum   = 0;
+    _latencyCount = 0;
+    _windowStart  = millis();
+    _latencyMs    = 0.0f;
+
+    Log::info("Profile %s: CPU %lu MHz, sensor %.0f Hz, output %.0f Hz, TX %.1f dBm, ~%.0f mA", profile.name,
+              (unsigned long)getCpuFrequencyMhz(), _sensorHz, profile.outputHz, profile.txPowerDbm, profile.currentMa);
+}
@@ -0,0 +1,132 @@
+/**
+ * @file        profile_manager.h
+ * @brief       Latency and power profiles for the Wiicon Remote project
+ *
+ * @details     Applies a named profile from PERFORMANCE_PROFILES: WiFi power save, transmit power,
+ *              CPU frequency, sensor data rate and output rate are set together. The selected profile is
+ *              stored in NVS, and the measured sample latency is reported next to the current estimate.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef PROFILE_MANAGER_H
+#define PROFILE_MANAGER_H
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "logger.h"
+
+class ProfileManager {
+   public:
+    /**
+     * Get the singleton instance of the profile manager
+     * @return Reference to the profile manager instance
+     */
+    static ProfileManager& instance();
+
+    /**
+     * Apply the stored profile, or PROFILE_DEFAULT if none is stored
+     * Call after the sensor is initialized and calibrated and after the configuration store is loaded.
+     */
+    void begin();
+
+    /**
+     * Apply a profile
+     * The settings registry stores it as the one used on the next boot.
+     * @param name Profile name from PERFORMANCE_PROFILES
+     * @return true if the profile exists
+     */
+    bool select(const char* name);
+
+    /**
+     * Apply the WiFi settings of the current profile
+     * The driver only accepts them while the station is up, so the WiFi manager calls this on every connection.
+     */
+    void applyRadio();
+
+    /**
+     * Record the time from a sensor read until its sample was handed to the transports
+     * @param micros Elapsed time in microseconds
+     */
+    void recordLatency(uint32_t micros);
+
+    /**
+     * Get the current profile
+     * @return Profile
+     */
+    const PerformanceProfile& getProfile() const { return PERFORMANCE_PROFILES[_index]; }
+
+    /**
+     * Get the measured latency of the last window
+     * Sum of the average read-to-send time, half a sensor period of data age and, once the clock sync has a
+     * reference, half the shortest network round trip.
+     * @return Latency in milliseconds, 0 before the first window
+     */
+    float getLatencyMs() const { return _latencyMs; }
+
+    /**
+     * Find a profile by name
+     * @param name Profile name
+     * @return Index in PERFORMANCE_PROFILES, or -1 if there is none
+     */
+    static int find(const char* name);
+
+    ProfileManager(const ProfileManager&)            = delete; /**< Delete copy constructor */
+    ProfileManager& operator=(const ProfileManager&) = delete; /**< Delete assignment operator */
+
+   private:
+    /**
+     * Constructor
+     */
+    ProfileManager();
+    ~ProfileManager() = default;
+
+    /**
+     * Apply every setting of a profile
+     * @param index Index in PERFORMANCE_PROFILES
+     */
+    void apply(size_t index);
+
+    static constexpr size_t PROFILE_COUNT = sizeof(PERFORMANCE_PROFILES) / sizeof(PERFORMANCE_PROFILES[0]);
+
+    size_t        _index;        /**< Current profile */
+    float         _sensorHz;     /**< Data rate the sensor was set to */
+    uint32_t      _latencySum;   /**< Read-to-send time summed over the window (micros) */
+    uint32_t      _latencyCount; /**< Samples in the window */
+    unsigned long _windowStart;  /**< Start of the window (millis) */
+    float         _latencyMs;    /**< Latency of the last window */
+};
+
+/**
+ * Global instance of the profile manager
+ */
+extern ProfileManager& profileManager;
+
+#endif  // PROFILE_MANAGER_H
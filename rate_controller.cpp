@@ -0,0 +1,114 @@
+/**
+ * @file        rate_controller.cpp
+ * @brief       Adaptive output rate control implementation for the Wiicon Remote project
+ *
+ * @details     Implements the RateController class declared in rate_controller.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "rate_controller.h"
+
+RateController::RateController()
+    : _limited(false),
+      _rate(0.0f),
+      _nextAdmit(0),
+      _windowStart(0),
+      _offered(0),
+      _admitted(0),
+      _packets(0),
+      _failures(0),
+      _sendMicros(0),
+      _hostLoss(-1.0f) {}
+
+bool RateController::admit(unsigned long nowMicros) {
+    _offered++;
+
+    if (_limited) {
+        if ((long)(nowMicros - _nextAdmit) < 0) return false;
+
+        // Keep the average rate, but do not burst to catch up after a stall
+        unsigned long period = (unsigned long)(1000000.0f / _rate);
+        _nextAdmit += period;
+        if ((long)(nowMicros - _nextAdmit) >= 0) _nextAdmit = nowMicros + period;
+    }
+
+    _admitted++;
+    return true;
+}
+
+void RateController::recordSend(bool sent, uint32_t sendMicros) {
+    _packets++;
+    _sendMicros += sendMicros;
+    if (!sent) _failures++;
+}
+
+void RateController::recordHostLoss(float loss) {
+    if (loss > _hostLoss) _hostLoss = loss;
+}
+
+void RateController::update(unsigned long nowMillis) {
+    unsigned long elapsed = nowMillis - _windowStart;
+    if (elapsed < OSC_RATE_WINDOW_MS) return;
+
+    float offeredRate  = _offered * 1000.0f / elapsed;
+    float admittedRate = _admitted * 1000.0f / elapsed;
+
+    bool failing  = _failures > 0;
+    bool slow     = _packets > 0 && _sendMicros / _packets > OSC_RATE_SEND_US_LIMIT;
+    bool hostLoss = _hostLoss > OSC_RATE_HOST_LOSS_LIMIT;
+
+    if (OSC_ADAPTIVE_RATE && (failing || slow || hostLoss) && admittedRate > 0.0f) {
+        // Multiplicative decrease from what actually went out, not from a stale limit
+        float base = _limited && _rate < admittedRate ? _rate : admittedRate;
+        _rate      = fmaxf(OSC_RATE_MIN_HZ, base * OSC_RATE_DECREASE);
+        _nextAdmit = micros();
+
+        if (!_limited || _rate > OSC_RATE_MIN_HZ) {
+            Log::warning("OSC: congestion (%lu/%lu failed, %lu us/send, host loss %.2f), output rate -> %.0f Hz",
+                         (unsigned long)_failures, (unsigned long)_packets,
+                         (unsigned long)(_packets ? _sendMicros / _packets : 0), fmaxf(_hostLoss, 0.0f), _rate);
+        }
+        _limited = true;
+    } else if (_limited) {
+        _rate += OSC_RATE_INCREASE_HZ;
+        if (_rate >= offeredRate) {
+            _limited = false;
+            Log::info("OSC: network recovered, output back to the full sample rate");
+        }
+    }
+
+    _windowStart = nowMillis;
+    _offered     = 0;
+    _admitted    = 0;
+    _packets     = 0;
+    _failures    = 0;
+    _sendMicros  = 0;
+    _hostLoss    = -1.0f;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file        rate_controller.h
+ * @brief       Adaptive output rate control for the Wiicon Remote project
+ *
+ * @details     AIMD congestion controller for the OSC output. Send failures, time spent in
+ *              the transport and optional host-reported loss are evaluated once per window:
+ *              on congestion the output rate is halved and messages are coalesced into
+ *              bundles, and while the network is clean the rate climbs back additively.
+ *              Sampling and sensor fusion are never throttled, only the output is.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef RATE_CONTROLLER_H
+#define RATE_CONTROLLER_H
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "logger.h"
+
+class RateController {
+   public:
+    /**
+     * Constructor
+     */
+    RateController();
+
+    /**
+     * Decide whether the current sample is sent
+     * Counts every offered sample, so the unthrottled rate is known when the limit is lifted.
+     * @param nowMicros Current time (micros)
+     * @return true if the sample should be sent
+     */
+    bool admit(unsigned long nowMicros);
+
+    /**
+     * Record the outcome of one datagram
+     * @param sent Whether the transport accepted the datagram
+     * @param sendMicros Time spent in the transport
+     */
+    void recordSend(bool sent, uint32_t sendMicros);
+
+    /**
+     * Record the loss observed by a host (e.g. from /wiicon/feedback)
+     * @param loss Lost fraction of the stream, 0 to 1
+     */
+    void recordHostLoss(float loss);
+
+    /**
+     * Evaluate the window and step the rate, once per OSC_RATE_WINDOW_MS
+     * @param nowMillis Current time (millis)
+     */
+    void update(unsigned long nowMillis);
+
+    /**
+     * Check whether the output is currently limited
+     * @return true if the rate is below the offered sample rate
+     */
+    bool isLimited() const { return _limited; }
+
+    /**
+     * Check whether messages of one sample should be coalesced into a bundle
+     * @return true while congested
+     */
+    bool isCoalescing() const { return _limited; }
+
+    /**
+     * Get the allowed output rate
+     * @return Rate in Hz, 0 when not limited
+     */
+    float getRate() const { return _limited ? _rate : 0.0f; }
+
+   private:
+    bool          _limited;     /**< Whether the output is throttled */
+    float         _rate;        /**< Allowed output rate (Hz) while limited */
+    unsigned long _nextAdmit;   /**< Time the next sample may be sent (micros) */
+    unsigned long _windowStart; /**< Start of the evaluation window (millis) */
+    uint32_t      _offered;     /**< Samples offered in the window */
+    uint32_t      _admitted;    /**< Samples sent in the window */
+    uint32_t      _packets;     /**< Datagrams in the window */
+    uint32_t      _failures;    /**< Datagrams the transport rejected in the window */
+    uint32_t      _sendMicros;  /**< Time spent in the transport in the window */
+    float         _hostLoss;    /**< Highest host-reported loss since the last evaluation, -1 = none */
+};
+
+#endif  // RATE_CONTROLLER_H
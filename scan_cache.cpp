@@ -0,0 +1,142 @@
+/**
+ * @file        scan_cache.cpp
+ * @brief       Background WiFi scan cache for the Wiicon Remote project
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "scan_cache.h"
+
+#include "helpers.h"
+
+ScanCache& scanCache = ScanCache::instance();
+
+ScanCache& ScanCache::instance() {
+    static ScanCache instance;
+    return instance;
+}
+
+ScanCache::ScanCache() : _results{}, _count(0), _scannedAt(0), _valid(false), _running(false), _requested(false) {
+    portMUX_INITIALIZE(&_lock);
+}
+
+void ScanCache::loop() {
+    if (_running) {
+        int16_t result = WiFi.scanComplete();
+        if (result == WIFI_SCAN_RUNNING) return;
+
+        _running = false;
+        if (result >= 0) {
+            collect(result);
+        } else {
+            Log::warning("WiFi scan failed");
+        }
+        WiFi.scanDelete();
+        return;
+    }
+
+    if (!_requested) return;
+    _requested = false;
+
+    // Asynchronous, the driver scans every channel while the loop keeps serving DNS
+    if (WiFi.scanNetworks(true) == WIFI_SCAN_FAILED) {
+        Log::warning("WiFi scan could not be started");
+        return;
+    }
+    _running = true;
+    Log::debug("WiFi scan started");
+}
+
+void ScanCache::respond(AsyncWebServerRequest* request) {
+    ScanResult    results[WIFI_SCAN_MAX_RESULTS];
+    size_t        count;
+    unsigned long scannedAt;
+    bool          valid;
+
+    portENTER_CRITICAL(&_lock);
+    count     = _count;
+    scannedAt = _scannedAt;
+    valid     = _valid;
+    memcpy(results, _results, count * sizeof(ScanResult));
+    portEXIT_CRITICAL(&_lock);
+
+    unsigned long age = millis() - scannedAt;
+    if (!valid || age >= WIFI_SCAN_MAX_AGE_MS) refresh();
+
+    AsyncResponseStream* response = request->beginResponseStream("application/json");
+    response->addHeader("Cache-Control", "no-store");
+
+    if (valid) {
+        response->printf("{\"age\":%lu", age);
+    } else {
+        response->print("{\"age\":null");
+    }
+    response->printf(",\"scanning\":%s,\"networks\":[", _running || _requested ? "true" : "false");
+
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) response->write(',');
+        response->print("{\"ssid\":");
+        printJsonString(*response, results[i].ssid);
+        response->printf(",\"rssi\":%d,\"secure\":%s}", results[i].rssi, results[i].secure ? "true" : "false");
+    }
+
+    response->print("]}");
+    request->send(response);
+}
+
+void ScanCache::collect(int16_t count) {
+    ScanResult results[WIFI_SCAN_MAX_RESULTS];
+    size_t     kept = 0;
+
+    // Insertion by signal strength, so the weakest are the ones left out when there are too many
+    for (int16_t i = 0; i < count; ++i) {
+        ScanResult result;
+        strlcpy(result.ssid, WiFi.SSID(i).c_str(), sizeof(result.ssid));
+        result.rssi   = (int8_t)WiFi.RSSI(i);
+        result.secure = WiFi.encryptionType(i) != WIFI_AUTH_OPEN;
+
+        size_t slot = kept;
+        while (slot > 0 && results[slot - 1].rssi < result.rssi) slot--;
+        if (slot >= WIFI_SCAN_MAX_RESULTS) continue;
+
+        size_t last = kept < WIFI_SCAN_MAX_RESULTS ? kept : WIFI_SCAN_MAX_RESULTS - 1;
+        memmove(&results[slot + 1], &results[slot], (last - slot) * sizeof(ScanResult));
+        results[slot] = result;
+        if (kept < WIFI_SCAN_MAX_RESULTS) kept++;
+    }
+
+    portENTER_CRITICAL(&_lock);
+    memcpy(_results, results, kept * sizeof(ScanResult));
+    _count     = kept;
+    _scannedAt = millis();
+    _valid     = true;
+    portEXIT_CRITICAL(&_lock);
+
+    Log::info("WiFi scan found %d networks", count);
+}
@@ -0,0 +1,113 @@
+/**
+ * @file        scan_cache.h
+ * @brief       Background WiFi scan cache for the Wiicon Remote project
+ *
+ * @details     Scans for networks asynchronously from the main loop and keeps the timestamped result,
+ *              so the portal's /scan request is answered at once from the cache with a streamed, escaped
+ *              JSON document while the async web server and the captive portal DNS keep running.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef SCAN_CACHE_H
+#define SCAN_CACHE_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <WiFi.h>
+
+#include "config.h"
+#include "logger.h"
+
+/**
+ * One network found by a scan
+ */
+struct ScanResult {
+    char   ssid[33]; /**< Network name, may be empty for hidden networks */
+    int8_t rssi;     /**< Signal strength in dBm */
+    bool   secure;   /**< Whether the network needs a password */
+};
+
+class ScanCache {
+   public:
+    /**
+     * Get the singleton instance of the scan cache
+     * @return Reference to the scan cache instance
+     */
+    static ScanCache& instance();
+
+    /**
+     * Ask for a new scan, started by the next loop() unless one is running
+     * Safe to call from the web server task.
+     */
+    void refresh() { _requested = true; }
+
+    /**
+     * Start requested scans and collect finished ones, call regularly from the main loop
+     */
+    void loop();
+
+    /**
+     * Answer a /scan request from the cache and ask for a refresh if the cache is older than WIFI_SCAN_MAX_AGE_MS
+     * The response is {"age": ms or null, "scanning": bool, "networks": [{"ssid", "rssi", "secure"}, ...]}.
+     * @param request Request to answer
+     */
+    void respond(AsyncWebServerRequest* request);
+
+    ScanCache(const ScanCache&)            = delete; /**< Delete copy constructor */
+    ScanCache& operator=(const ScanCache&) = delete; /**< Delete assignment operator */
+
+   private:
+    /**
+     * Constructor
+     */
+    ScanCache();
+    ~ScanCache() = default;
+
+    /**
+     * Copy the results of a finished scan into the cache, strongest first
+     * @param count Networks found by the scan
+     */
+    void collect(int16_t count);
+
+    portMUX_TYPE  _lock;                           /**< Guards the results against the web server task */
+    ScanResult    _results[WIFI_SCAN_MAX_RESULTS]; /**< Networks of the last scan */
+    size_t        _count;                          /**< Number of results */
+    unsigned long _scannedAt;                      /**< Time the last scan finished (millis) */
+    bool          _valid;                          /**< Whether a scan has finished */
+    bool          _running;                        /**< Whether a scan is in progress */
+    volatile bool _requested;                      /**< Whether a new scan was asked for */
+};
+
+/**
+ * Global instance of the scan cache
+ */
+extern ScanCache& scanCache;
+
+#endif  // SCAN_CACHE_H
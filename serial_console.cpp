@@ -0,0 +1,122 @@
+/**
+ * @file        serial_console.cpp
+ * @brief       Serial settings console for the Wiicon Remote project
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "serial_console.h"
+
+#include "boot_profiler.h"
+
+SerialConsole& serialConsole = SerialConsole::instance();
+
+namespace {
+
+const char* const USAGE = "Commands: list | get <key> | set <key> <value> | save | boot";
+
+}  // namespace
+
+SerialConsole& SerialConsole::instance() {
+    static SerialConsole instance;
+    return instance;
+}
+
+SerialConsole::SerialConsole() : _line{}, _length(0), _overflow(false) {}
+
+void SerialConsole::loop() {
+    if (SERIAL_OSC || !SETTINGS_SERIAL_CONSOLE) return;
+
+    int available = Serial.available();
+    while (available-- > 0) {
+        char c = (char)Serial.read();
+
+        if (c != '\n' && c != '\r') {
+            if (_length + 1 < sizeof(_line)) {
+                _line[_length++] = c;
+            } else {
+                _overflow = true;
+            }
+            continue;
+        }
+
+        // CR LF ends the line at CR, the LF then finds an empty line
+        if (_overflow) {
+            Serial.println("error: line too long");
+        } else if (_length > 0) {
+            _line[_length] = '\0';
+            execute(_line);
+        }
+        _length   = 0;
+        _overflow = false;
+    }
+}
+
+void SerialConsole::execute(char* line) {
+    char* command = strtok(line, " \t");
+    char* key     = strtok(nullptr, " \t");
+    char* value   = strtok(nullptr, "");
+
+    // The value runs to the end of the line, so network names may contain spaces
+    if (value) {
+        while (*value == ' ' || *value == '\t') value++;
+    }
+
+    if (!command) return;
+
+    if (strcmp(command, "list") == 0) {
+        for (size_t i = 0; i < SettingsRegistry::count(); ++i) print(SettingsRegistry::at(i));
+    } else if (strcmp(command, "get") == 0 && key) {
+        const Setting* setting = SettingsRegistry::find(key);
+        if (setting) {
+            print(*setting);
+        } else {
+            Serial.printf("error: %s\n", SettingsRegistry::describe(SettingResult::UNKNOWN_KEY));
+        }
+    } else if (strcmp(command, "set") == 0 && key) {
+        SettingResult result = settingsRegistry.set(key, value ? value : "", SettingSource::LOCAL);
+        if (result == SettingResult::OK) {
+            Serial.println("ok");
+        } else {
+            Serial.printf("error: %s\n", SettingsRegistry::describe(result));
+        }
+    } else if (strcmp(command, "save") == 0) {
+        Serial.println(settingsRegistry.flush() ? "saved" : "error: write failed");
+    } else if (strcmp(command, "boot") == 0) {
+        bootProfiler.report(Serial);
+    } else {
+        Serial.println(USAGE);
+    }
+}
+
+void SerialConsole::print(const Setting& setting) {
+    char value[65];
+    settingsRegistry.format(setting, value, sizeof(value));
+    Serial.printf("%s = %s  (%s)\n", setting.key, (setting.flags & SETTING_SECRET) ? "***" : value, setting.help);
+}
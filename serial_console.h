@@ -0,0 +1,92 @@
+/**
+ * @file        serial_console.h
+ * @brief       Serial settings console for the Wiicon Remote project
+ *
+ * @details     Reads "get", "set", "list" and "save" lines from the USB serial port and passes them to the
+ *              settings registry, so settings can be changed from a terminal without WiFi. Off with SERIAL_OSC,
+ *              where the port carries SLIP frames.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef SERIAL_CONSOLE_H
+#define SERIAL_CONSOLE_H
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "settings_registry.h"
+
+class SerialConsole {
+   public:
+    /**
+     * Get the singleton instance of the serial console
+     * @return Reference to the serial console instance
+     */
+    static SerialConsole& instance();
+
+    /**
+     * Read the pending input and run each complete line
+     * Never blocks. Does nothing with SERIAL_OSC or without SETTINGS_SERIAL_CONSOLE.
+     */
+    void loop();
+
+    SerialConsole(const SerialConsole&)            = delete; /**< Delete copy constructor */
+    SerialConsole& operator=(const SerialConsole&) = delete; /**< Delete assignment operator */
+
+   private:
+    /**
+     * Constructor
+     */
+    SerialConsole();
+    ~SerialConsole() = default;
+
+    /**
+     * Run one command line
+     * @param line NUL-terminated line, split in place
+     */
+    void execute(char* line);
+
+    /**
+     * Print one setting as "key = value"
+     * @param setting Setting
+     */
+    void print(const Setting& setting);
+
+    char   _line[SETTINGS_CONSOLE_LINE_SIZE]; /**< Line being received */
+    size_t _length;                           /**< Characters in _line */
+    bool   _overflow;                         /**< Whether the current line was too long and is skipped */
+};
+
+/**
+ * Global instance of the serial console
+ */
+extern SerialConsole& serialConsole;
+
+#endif  // SERIAL_CONSOLE_H
@@ -0,0 +1,116 @@
+/**
+ * @file        serial_link.cpp
+ * @brief       SLIP-framed OSC over USB serial implementation for the Wiicon Remote project
+ *
+ * @details     Implements the SerialLink class declared in serial_link.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "serial_link.h"
+
+SerialLink& serialLink = SerialLink::instance();
+
+namespace {
+
+/**
+ * Log level and text; the logger buffer holds at most 255 characters
+ */
+using LogMessage = osc::Message<"/wiicon/log", int32_t, osc::String<255>>;
+
+}  // namespace
+
+SerialLink& SerialLink::instance() {
+    static SerialLink instance;
+    return instance;
+}
+
+SerialLink::SerialLink() : _active(false), _busy(false), _dropped(0) { portMUX_INITIALIZE(&_lock); }
+
+bool SerialLink::begin() {
+    if (!SERIAL_OSC || _active) return _active;
+
+    _active = true;
+    Log::info("Serial OSC enabled, logs continue as /wiicon/log");
+    Log::setSink(logSink);
+    return true;
+}
+
+bool SerialLink::send(const OscDestination&, const uint8_t* data, size_t length) {
+    if (!_active) return false;
+
+    if (!tryLock()) {
+        _dropped++;
+        return false;
+    }
+    bool sent = write(data, length, _encoded, sizeof(_encoded));
+    unlock();
+    return sent;
+}
+
+bool SerialLink::tryLock() {
+    portENTER_CRITICAL(&_lock);
+    bool free = !_busy;
+    _busy     = true;
+    portEXIT_CRITICAL(&_lock);
+    return free;
+}
+
+void SerialLink::unlock() {
+    portENTER_CRITICAL(&_lock);
+    _busy = false;
+    portEXIT_CRITICAL(&_lock);
+}
+
+bool SerialLink::write(const uint8_t* packet, size_t length, uint8_t* encoded, size_t capacity) {
+    size_t size = slipEncode(packet, length, encoded, capacity);
+    if (length == 0 || size == 0) return false;
+
+    // A partial packet would corrupt the next one on the host, drop it whole instead
+    if ((size_t)Serial.availableForWrite() < size) {
+        _dropped++;
+        return false;
+    }
+
+    Serial.write(encoded, size);
+    return true;
+}
+
+void SerialLink::logSink(LogLevel level, const char* message) {
+    SerialLink& link = instance();
+
+    // Another task is writing a frame, the line is dropped rather than interleaved with it
+    if (!link.tryLock()) {
+        link._dropped++;
+        return;
+    }
+    size_t length = LogMessage::encode(link._logPacket, (int32_t)level, osc::String<255>{message});
+    link.write(link._logPacket, length, link._logEncoded, sizeof(link._logEncoded));
+    link.unlock();
+}
@@ -0,0 +1,154 @@
+/**
+ * @file        serial_link.h
+ * @brief       SLIP-framed OSC over USB serial for the Wiicon Remote project
+ *
+ * @details     Wired output transport for rehearsals and studio work: OSC packets are
+ *              SLIP-encoded (OSC 1.1 serial framing) and written to the USB serial port,
+ *              independent of WiFi. OSCManager adds it as a destination for SERIAL_OSC_STREAMS. While the link is active the logger is
+ *              multiplexed into the same stream as /wiicon/log messages, so the byte stream
+ *              only ever carries SLIP packets. tools/wiicon_serial republishes them to UDP.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef SERIAL_LINK_H
+#define SERIAL_LINK_H
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "logger.h"
+#include "osc_message.h"
+#include "osc_transport.h"
+#include "slip.h"
+
+class SerialLink : public OscTransport {
+   public:
+    /**
+     * Get the singleton instance of the serial link
+     * @return Reference to the serial link instance
+     */
+    static SerialLink& instance();
+
+    const char* name() const override { return "serial"; }
+
+    /**
+     * Start the link and route the logger through it
+     * Does nothing unless SERIAL_OSC is enabled. Call after Serial.begin().
+     * @return true if the link is active
+     */
+    bool begin() override;
+
+    /**
+     * Check whether packets go out over serial
+     * @return true after a successful begin()
+     */
+    bool isReady() const override { return _active; }
+
+    /**
+     * Check whether samples go out over serial
+     * @return true after a successful begin()
+     */
+    bool isActive() const { return _active; }
+
+    /**
+     * Send one packet, SLIP-encoded
+     * The packet is dropped rather than blocking the loop when the serial TX buffer is full (e.g. no host attached)
+     * or another task is writing a log line.
+     * @param destination Ignored, the link is point-to-point
+     * @param data Packet
+     * @param length Packet length in bytes
+     * @return true if the whole packet was queued
+     */
+    bool send(const OscDestination& destination, const uint8_t* data, size_t length) override;
+
+    /**
+     * Get the number of packets and log lines dropped because the TX buffer was full or the port was busy
+     * @return Dropped packets since boot
+     */
+    uint32_t getDropped() const { return _dropped; }
+
+    SerialLink(const SerialLink&)            = delete;
+    SerialLink& operator=(const SerialLink&) = delete;
+
+   private:
+    /**
+     * Constructor
+     */
+    SerialLink();
+    ~SerialLink() = default;
+
+    /**
+     * Logger sink that wraps each line in a /wiicon/log message
+     * @param level Log level
+     * @param message Formatted message
+     */
+    static void logSink(LogLevel level, const char* message);
+
+    /**
+     * Take the port without waiting
+     * Samples come from the loop and log lines from any task; a frame is encoded and written only while holding it,
+     * so two frames never share a buffer or interleave on the wire. The holder never waits for the other.
+     * @return true if the port was free, call unlock() when done
+     */
+    bool tryLock();
+
+    /**
+     * Release the port taken by tryLock()
+     */
+    void unlock();
+
+    /**
+     * SLIP-encode a packet and write it if the TX buffer has room
+     * @param packet Packet
+     * @param length Packet length in bytes
+     * @param encoded Scratch buffer for the encoding
+     * @param capacity Scratch buffer size
+     * @return true if the whole packet was queued
+     */
+    bool write(const uint8_t* packet, size_t length, uint8_t* encoded, size_t capacity);
+
+    static constexpr size_t PACKET_SIZE     = 256; /**< Largest packet, matches OSCManager::BUFFER_SIZE */
+    static constexpr size_t LOG_PACKET_SIZE = 320; /**< Largest log packet */
+
+    bool         _active;                                          /**< Whether the link is running */
+    portMUX_TYPE _lock;                                            /**< Guards _busy */
+    bool         _busy;                                            /**< Whether a task is writing a frame */
+    uint32_t     _dropped;                                         /**< Frames dropped, TX buffer full or port busy */
+    uint8_t      _encoded[slipMaxEncodedSize(PACKET_SIZE)];        /**< SLIP encoding of a packet */
+    uint8_t      _logPacket[LOG_PACKET_SIZE];                      /**< Log packet being encoded */
+    uint8_t      _logEncoded[slipMaxEncodedSize(LOG_PACKET_SIZE)]; /**< SLIP encoding of a log packet */
+};
+
+/**
+ * Global instance of the serial link
+ */
+extern SerialLink& serialLink;
+
+#endif  // SERIAL_LINK_H
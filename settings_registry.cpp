@@ -0,0 +1,461 @@
+/**
+ * @file        settings_registry.cpp
+ * @brief       Runtime settings registry for the Wiicon Remote project
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "settings_registry.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#include "actions.h"
+#include "helpers.h"
+#include "osc_manager.h"
+#include "profile_manager.h"
+#include "websocket_transport.h"
+#include "wifi_manager.h"
+
+SettingsRegistry& settingsRegistry = SettingsRegistry::instance();
+
+namespace {
+
+const StoredConfig DEFAULTS{}; /**< Default of every field, for numbers and flags set to an empty value */
+
+/**
+ * Parse a mapping such as "+x-z+y" into source axes and signs
+ * @return false unless it names every axis once, each with a sign
+ */
+bool parseAxes(const char* text, int* map, int* sign) {
+    if (strlen(text) != 6) return false;
+
+    bool used[3] = {false, false, false};
+    for (int i = 0; i < 3; ++i) {
+        char s = text[2 * i];
+        char a = text[2 * i + 1];
+        if ((s != '+' && s != '-') || a < 'x' || a > 'z' || used[a - 'x']) return false;
+
+        used[a - 'x'] = true;
+        map[i]        = a - 'x';
+        sign[i]       = s == '-' ? -1 : 1;
+    }
+    return true;
+}
+
+bool validateAxes(const char* value) {
+    int map[3], sign[3];
+    return parseAxes(value, map, sign);
+}
+
+bool validateProfile(const char* value) { return value[0] == '\0' || ProfileManager::find(value) >= 0; }
+
+void applyNetwork() { wifiManager.reconnect(); }
+
+void applyOscTarget() { oscManager.invalidateTarget(); }
+
+void applyProfile() {
+    const char* name = configStore.get().profile;
+    profileManager.select(name[0] != '\0' ? name : PROFILE_DEFAULT);
+}
+
+void applyFilterGain() { actionSetFilterGain(configStore.get().beta); }
+
+void applyWebSocketRate() { webSocketTransport.setRate(configStore.get().wsRateHz); }
+
+void applyMapping() {
+    const StoredConfig& config = configStore.get();
+
+    // Both mappings were validated when they were set, a damaged record keeps the previous one
+    int map[3], sign[3];
+    if (parseAxes(config.accelAxes, map, sign)) {
+        memcpy(accelMap, map, sizeof(map));
+        memcpy(accelSign, sign, sizeof(sign));
+    }
+    if (parseAxes(config.gyroAxes, map, sign)) {
+        memcpy(gyroMap, map, sizeof(map));
+        memcpy(gyroSign, sign, sizeof(sign));
+    }
+    swapRollYaw = config.swapRollYaw;
+
+    Log::info("Axis mapping: accel %s, gyro %s%s", config.accelAxes, config.gyroAxes,
+              swapRollYaw ? ", roll and yaw swapped" : "");
+}
+
+#define SETTING_FIELD(field) (uint16_t)offsetof(StoredConfig, field), (uint16_t)sizeof(StoredConfig::field)
+
+/**
+ * Every setting, append only: the bit of a queued value is its index
+ * The network settings keep the names of the portal form fields, and only the portal and the serial console may
+ * change them: a wrong value sent from the LAN would take the device off it for good.
+ */
+const Setting SETTINGS[] = {
+    {"ssid", SettingType::STRING, SETTING_FIELD(ssid), 0, 0, SETTING_LOCAL, nullptr, applyNetwork, "WiFi network"},
+    {"password", SettingType::STRING, SETTING_FIELD(password), 0, 0, SETTING_SECRET | SETTING_LOCAL, nullptr,
+     applyNetwork, "WiFi passphrase"},
+    {"ip", SettingType::IP, SETTING_FIELD(ip), 0, 0, SETTING_LOCAL, nullptr, applyNetwork, "Static IP, empty = DHCP"},
+    {"gateway", SettingType::IP, SETTING_FIELD(gateway), 0, 0, SETTING_LOCAL, nullptr, applyNetwork,
+     "Gateway of the static IP"},
+    {"osc_ip", SettingType::IP, SETTING_FIELD(oscIP), 0, 0, 0, nullptr, applyOscTarget,
+     "OSC target IP, empty = default group"},
+    {"osc_port", SettingType::UINT16, SETTING_FIELD(oscPort), 0, 65535, 0, nullptr, applyOscTarget,
+     "OSC target port, 0 = default"},
+    {"profile", SettingType::STRING, SETTING_FIELD(profile), 0, 0, 0, validateProfile, applyProfile,
+     "Performance profile"},
+    {"beta", SettingType::FLOAT, SETTING_FIELD(beta), 0.0f, 1.0f, SETTING_BOOT, nullptr, applyFilterGain,
+     "Madgwick filter gain"},
+    {"ws_rate", SettingType::FLOAT, SETTING_FIELD(wsRateHz), WS_RATE_MIN_HZ, SAMPLE_RATE_MAX_HZ, SETTING_BOOT, nullptr,
+     applyWebSocketRate, "WebSocket frame rate (Hz)"},
+    {"calib_samples", SettingType::UINT16, SETTING_FIELD(calibSamples), 10, 2000, 0, nullptr, nullptr,
+     "Gyroscope calibration samples"},
+    {"swap_roll_yaw", SettingType::BOOL, SETTING_FIELD(swapRollYaw), 0, 1, SETTING_BOOT, nullptr, applyMapping,
+     "Send yaw as roll and roll as yaw"},
+    {"accel_axes", SettingType::STRING, SETTING_FIELD(accelAxes), 0, 0, SETTING_BOOT, validateAxes, applyMapping,
+     "Accelerometer axes, e.g. +x-z+y"},
+    {"gyro_axes", SettingType::STRING, SETTING_FIELD(gyroAxes), 0, 0, SETTING_BOOT, validateAxes, applyMapping,
+     "Gyroscope axes, e.g. +x-z+y"},
+};
+
+#undef SETTING_FIELD
+
+constexpr size_t SETTING_COUNT = sizeof(SETTINGS) / sizeof(SETTINGS[0]);
+constexpr size_t VALUE_SIZE    = sizeof(StoredConfig::password); /**< Largest field */
+
+static_assert(SETTING_COUNT <= 32, "The queue keeps one bit per setting");
+
+const char* typeName(SettingType type) {
+    switch (type) {
+        case SettingType::STRING:
+            return "string";
+        case SettingType::IP:
+            return "ip";
+        case SettingType::UINT16:
+            return "int";
+        case SettingType::FLOAT:
+            return "float";
+        case SettingType::BOOL:
+            return "bool";
+    }
+    return "";
+}
+
+/**
+ * Whether a front-end may change a setting
+ */
+bool allowedFrom(const Setting& setting, SettingSource source) {
+    return !(setting.flags & SETTING_LOCAL) || source == SettingSource::LOCAL;
+}
+
+/**
+ * Add a callback to a list unless it is already there, so a batch of related changes applies once
+ */
+void addOnce(SettingApply* list, size_t* count, SettingApply apply) {
+    for (size_t i = 0; i < *count; ++i) {
+        if (list[i] == apply) return;
+    }
+    list[(*count)++] = apply;
+}
+
+}  // namespace
+
+SettingsRegistry& SettingsRegistry::instance() {
+    static SettingsRegistry instance;
+    return instance;
+}
+
+SettingsRegistry::SettingsRegistry()
+    : _queued{}, _queuedMask(0), _lock(portMUX_INITIALIZER_UNLOCKED), _unsaved(false), _firstChange(0), _lastChange(0) {}
+
+void SettingsRegistry::begin() {
+    configStore.begin();
+
+    SettingApply pending[SETTING_COUNT];
+    size_t       pendingCount = 0;
+
+    for (const Setting& setting : SETTINGS) {
+        if ((setting.flags & SETTING_BOOT) && setting.apply) addOnce(pending, &pendingCount, setting.apply);
+    }
+    for (size_t i = 0; i < pendingCount; ++i) pending[i]();
+}
+
+SettingResult SettingsRegistry::set(const char* key, const char* value, SettingSource source) {
+    const Setting* setting = find(key);
+    if (!setting) {
+        Log::warning("Unknown setting %s", key);
+        return SettingResult::UNKNOWN_KEY;
+    }
+
+    uint8_t       field[VALUE_SIZE];
+    SettingResult result = allowedFrom(*setting, source) ? parse(*setting, value, field) : SettingResult::LOCAL_ONLY;
+    if (result != SettingResult::OK) {
+        Log::warning("Setting %s rejected: %s", key, describe(result));
+        return result;
+    }
+
+    // The web server task may queue while the main loop applies, the last value of a setting wins
+    portENTER_CRITICAL(&_lock);
+    memcpy((uint8_t*)&_queued + setting->offset, field, setting->size);
+    _queuedMask |= 1u << (setting - SETTINGS);
+    portEXIT_CRITICAL(&_lock);
+
+    return SettingResult::OK;
+}
+
+SettingResult SettingsRegistry::check(const char* key, const char* value, SettingSource source) {
+    const Setting* setting = find(key);
+    if (!setting) return SettingResult::UNKNOWN_KEY;
+    if (!allowedFrom(*setting, source)) return SettingResult::LOCAL_ONLY;
+
+    uint8_t field[VALUE_SIZE];
+    return parse(*setting, value, field);
+}
+
+SettingResult SettingsRegistry::set(const char* key, float value, SettingSource source) {
+    char text[24];
+    snprintf(text, sizeof(text), "%.9g", value);
+    return set(key, text, source);
+}
+
+SettingResult SettingsRegistry::parse(const Setting& setting, const char* text, uint8_t* field) {
+    size_t length = strlen(text);
+
+    if (setting.type == SettingType::STRING || setting.type == SettingType::IP) {
+        IPAddress address;
+
+        if (length >= setting.size) return SettingResult::INVALID;
+        if (setting.type == SettingType::IP && length > 0 && !address.fromString(text)) return SettingResult::INVALID;
+        if (setting.validate && !setting.validate(text)) return SettingResult::INVALID;
+
+        memset(field, 0, setting.size);
+        memcpy(field, text, length);
+        return SettingResult::OK;
+    }
+
+    if (length == 0) {
+        memcpy(field, (const uint8_t*)&DEFAULTS + setting.offset, setting.size);
+        return SettingResult::OK;
+    }
+
+    char* end = nullptr;
+
+    switch (setting.type) {
+        case SettingType::UINT16: {
+            long value = strtol(text, &end, 10);
+            if (*end != '\0') return SettingResult::INVALID;
+            if (value < setting.min || value > setting.max) return SettingResult::OUT_OF_RANGE;
+
+            uint16_t number = (uint16_t)value;
+            memcpy(field, &number, sizeof(number));
+            return SettingResult::OK;
+        }
+
+        case SettingType::FLOAT: {
+            float value = strtof(text, &end);
+            if (*end != '\0' || !isfinite(value)) return SettingResult::INVALID;
+            if (value < setting.min || value > setting.max) return SettingResult::OUT_OF_RANGE;
+
+            memcpy(field, &value, sizeof(value));
+            return SettingResult::OK;
+        }
+
+        case SettingType::BOOL: {
+            bool value;
+            if (strcmp(text, "1") == 0 || strcasecmp(text, "true") == 0 || strcasecmp(text, "on") == 0) {
+                value = true;
+            } else if (strcmp(text, "0") == 0 || strcasecmp(text, "false") == 0 || strcasecmp(text, "off") == 0) {
+                value = false;
+            } else {
+                return SettingResult::INVALID;
+            }
+
+            memcpy(field, &value, sizeof(value));
+            return SettingResult::OK;
+        }
+
+        default:
+            return SettingResult::INVALID;
+    }
+}
+
+void SettingsRegistry::format(const Setting& setting, char* out, size_t size) const {
+    const uint8_t* field = (const uint8_t*)&configStore.get() + setting.offset;
+
+    if (setting.flags & SETTING_SECRET) {
+        if (size > 0) out[0] = '\0';
+        return;
+    }
+
+    switch (setting.type) {
+        case SettingType::STRING:
+        case SettingType::IP:
+            snprintf(out, size, "%.*s", (int)setting.size, (const char*)field);
+            break;
+
+        case SettingType::UINT16: {
+            uint16_t value;
+            memcpy(&value, field, sizeof(value));
+            snprintf(out, size, "%u", (unsigned)value);
+            break;
+        }
+
+        case SettingType::FLOAT: {
+            float value;
+            memcpy(&value, field, sizeof(value));
+            snprintf(out, size, "%g", value);
+            break;
+        }
+
+        case SettingType::BOOL: {
+            bool value;
+            memcpy(&value, field, sizeof(value));
+            snprintf(out, size, "%s", value ? "true" : "false");
+            break;
+        }
+    }
+}
+
+const Setting* SettingsRegistry::find(const char* key) {
+    for (const Setting& setting : SETTINGS) {
+        if (strcmp(setting.key, key) == 0) return &setting;
+    }
+    return nullptr;
+}
+
+size_t SettingsRegistry::count() { return SETTING_COUNT; }
+
+const Setting& SettingsRegistry::at(size_t index) { return SETTINGS[index]; }
+
+void SettingsRegistry::printJson(Print& out) const {
+    char value[VALUE_SIZE];
+
+    out.print('[');
+    for (size_t i = 0; i < SETTING_COUNT; ++i) {
+        const Setting& setting = SETTINGS[i];
+        format(setting, value, sizeof(value));
+
+        out.print(i > 0 ? ",{\"key\":" : "{\"key\":");
+        printJsonString(out, setting.key);
+        out.printf(",\"type\":\"%s\",\"value\":", typeName(setting.type));
+        printJsonString(out, value);
+        if (setting.type == SettingType::UINT16 || setting.type == SettingType::FLOAT) {
+            out.printf(",\"min\":%g,\"max\":%g", setting.min, setting.max);
+        } else if (setting.type != SettingType::BOOL) {
+            out.printf(",\"maxLength\":%u", (unsigned)(setting.size - 1));
+        }
+        out.printf(",\"secret\":%s,\"localOnly\":%s,\"help\":", (setting.flags & SETTING_SECRET) ? "true" : "false",
+                   (setting.flags & SETTING_LOCAL) ? "true" : "false");
+        printJsonString(out, setting.help);
+        out.print('}');
+    }
+    out.print(']');
+}
+
+void SettingsRegistry::loop() {
+    applyQueued();
+    if (!_unsaved) return;
+
+    // Sliders and scripts send bursts of changes, they are written once the burst is over
+    unsigned long now = millis();
+    if (now - _lastChange < SETTINGS_SAVE_DELAY_MS && now - _firstChange < SETTINGS_SAVE_MAX_DELAY_MS) return;
+
+    flush();
+}
+
+bool SettingsRegistry::flush() {
+    applyQueued();
+    if (!_unsaved) return true;
+
+    if (!configStore.commit()) {
+        // Try again after another delay rather than on every loop
+        _firstChange = _lastChange = millis();
+        return false;
+    }
+
+    _unsaved = false;
+    Log::info("Settings saved");
+    return true;
+}
+
+const char* SettingsRegistry::describe(SettingResult result) {
+    switch (result) {
+        case SettingResult::OK:
+            return "ok";
+        case SettingResult::UNKNOWN_KEY:
+            return "unknown setting";
+        case SettingResult::INVALID:
+            return "invalid value";
+        case SettingResult::OUT_OF_RANGE:
+            return "out of range";
+        case SettingResult::LOCAL_ONLY:
+            return "only the portal or the serial console may change it";
+    }
+    return "";
+}
+
+void SettingsRegistry::applyQueued() {
+    if (_queuedMask == 0) return;
+
+    StoredConfig queued;
+    uint32_t     mask;
+
+    portENTER_CRITICAL(&_lock);
+    mask        = _queuedMask;
+    queued      = _queued;
+    _queuedMask = 0;
+    portEXIT_CRITICAL(&_lock);
+
+    uint8_t*     config = (uint8_t*)&configStore.edit();
+    SettingApply pending[SETTING_COUNT];
+    size_t       pendingCount = 0;
+
+    for (size_t i = 0; i < SETTING_COUNT; ++i) {
+        const Setting& setting = SETTINGS[i];
+        const uint8_t* value   = (const uint8_t*)&queued + setting.offset;
+
+        if (!(mask & (1u << i)) || memcmp(config + setting.offset, value, setting.size) == 0) continue;
+        memcpy(config + setting.offset, value, setting.size);
+
+        if (setting.flags & SETTING_SECRET) {
+            Log::info("Setting %s changed", setting.key);
+        } else {
+            char text[VALUE_SIZE];
+            format(setting, text, sizeof(text));
+            Log::info("Setting %s = %s", setting.key, text);
+        }
+
+        if (setting.apply) addOnce(pending, &pendingCount, setting.apply);
+
+        unsigned long now = millis();
+        if (!_unsaved) _firstChange = now;
+        _lastChange = now;
+        _unsaved    = true;
+    }
+
+    for (size_t i = 0; i < pendingCount; ++i) pending[i]();
+}
@@ -0,0 +1,236 @@
+/**
+ * @file        settings_registry.h
+ * @brief       Runtime settings registry for the Wiicon Remote project
+ *
+ * @details     Describes every setting that can change without a restart (name, type, range, field in the
+ *              stored configuration and the callback that applies it). The dashboard, OSC and the serial console
+ *              all read and write through it. Changes are validated at once, applied by the main loop between
+ *              samples, and written to flash in batches.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef SETTINGS_REGISTRY_H
+#define SETTINGS_REGISTRY_H
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "config_store.h"
+#include "logger.h"
+
+/**
+ * How a setting is stored and parsed
+ */
+enum class SettingType : uint8_t {
+    STRING, /**< char array, any text that fits */
+    IP,     /**< char array holding a dotted IPv4 address, or empty */
+    UINT16, /**< uint16_t within [min, max] */
+    FLOAT,  /**< float within [min, max] */
+    BOOL,   /**< bool, given as 1/0, true/false or on/off */
+};
+
+/**
+ * Outcome of SettingsRegistry::set()
+ */
+enum class SettingResult : uint8_t {
+    OK,           /**< Accepted, applied by the next loop() */
+    UNKNOWN_KEY,  /**< No setting has this name */
+    INVALID,      /**< Not a value of the setting's type, or rejected by its validator */
+    OUT_OF_RANGE, /**< Number outside [min, max] */
+    LOCAL_ONLY,   /**< Network setting sent over the network, see SETTING_LOCAL */
+};
+
+/**
+ * Front-end a change comes from
+ */
+enum class SettingSource : uint8_t {
+    LOCAL,   /**< Serial console, or the portal on the device's own access point */
+    NETWORK, /**< OSC or the dashboard, open to anyone on the LAN */
+};
+
+const uint8_t SETTING_SECRET = 1 << 0; /**< Never read back, e.g. the WiFi password */
+const uint8_t SETTING_BOOT   = 1 << 1; /**< The apply callback also runs from begin() */
+const uint8_t SETTING_LOCAL  = 1 << 2; /**< Only a LOCAL source may change it, a bad value could strand the device */
+
+using SettingValidator = bool (*)(const char* value); /**< Further check of a string value */
+using SettingApply     = void (*)();                  /**< Puts a changed value into effect */
+
+/**
+ * Description of one setting
+ */
+struct Setting {
+    const char*      key;      /**< Name used by every front-end, and by the portal form */
+    SettingType      type;     /**< Storage and syntax */
+    uint16_t         offset;   /**< Offset of the field in StoredConfig */
+    uint16_t         size;     /**< Size of the field */
+    float            min;      /**< Lowest accepted number */
+    float            max;      /**< Highest accepted number */
+    uint8_t          flags;    /**< SETTING_* flags */
+    SettingValidator validate; /**< nullptr = any text that fits */
+    SettingApply     apply;    /**< nullptr = the value is read where it is used */
+    const char*      help;     /**< One-line description */
+};
+
+class SettingsRegistry {
+   public:
+    /**
+     * Get the singleton instance of the settings registry
+     * @return Reference to the settings registry instance
+     */
+    static SettingsRegistry& instance();
+
+    /**
+     * Load the stored configuration and apply the settings marked SETTING_BOOT
+     * Call after LittleFS is mounted and before the sensor is calibrated.
+     */
+    void begin();
+
+    /**
+     * Validate a new value and queue it for the next loop()
+     * Safe to call from the web server task. An empty value resets a number or flag to its default.
+     * @param key Setting name
+     * @param value Value as text
+     * @param source Front-end the change comes from
+     * @return OK, or why the value was rejected
+     */
+    SettingResult set(const char* key, const char* value, SettingSource source);
+
+    /**
+     * Validate a value without queueing it
+     * Lets a front-end reject a whole form before any of its fields is queued.
+     * @param key Setting name
+     * @param value Value as text
+     * @param source Front-end the change comes from
+     * @return OK, or why set() would reject the value
+     */
+    static SettingResult check(const char* key, const char* value, SettingSource source);
+
+    /**
+     * Validate a new numeric value and queue it for the next loop()
+     * @param key Setting name
+     * @param value Value
+     * @param source Front-end the change comes from
+     * @return OK, or why the value was rejected
+     */
+    SettingResult set(const char* key, float value, SettingSource source);
+
+    /**
+     * Format the current value of a setting
+     * Secret settings read back empty.
+     * @param setting Setting
+     * @param out Output buffer
+     * @param size Output buffer size
+     */
+    void format(const Setting& setting, char* out, size_t size) const;
+
+    /**
+     * Find a setting by name
+     * @param key Setting name
+     * @return Setting, nullptr if there is none
+     */
+    static const Setting* find(const char* key);
+
+    /**
+     * Get the number of settings
+     * @return Number of settings
+     */
+    static size_t count();
+
+    /**
+     * Get a setting by position
+     * @param index Position, below count()
+     * @return Setting
+     */
+    static const Setting& at(size_t index);
+
+    /**
+     * Write every setting with its type, range and current value as a JSON array
+     * @param out Output
+     */
+    void printJson(Print& out) const;
+
+    /**
+     * Apply the queued changes and write them once they have settled
+     * Must be called from the main loop, between samples.
+     */
+    void loop();
+
+    /**
+     * Apply the queued changes and write every unsaved change now
+     * Call before a restart or deep sleep.
+     * @return true if nothing was left unsaved
+     */
+    bool flush();
+
+    /**
+     * Describe a result for replies and logs
+     * @param result Result
+     * @return Short text
+     */
+    static const char* describe(SettingResult result);
+
+    SettingsRegistry(const SettingsRegistry&)            = delete; /**< Delete copy constructor */
+    SettingsRegistry& operator=(const SettingsRegistry&) = delete; /**< Delete assignment operator */
+
+   private:
+    /**
+     * Constructor
+     */
+    SettingsRegistry();
+    ~SettingsRegistry() = default;
+
+    /**
+     * Parse a value into the storage of its field
+     * @param setting Setting
+     * @param text Value as text
+     * @param field Output, setting.size bytes
+     * @return OK, or why the value was rejected
+     */
+    static SettingResult parse(const Setting& setting, const char* text, uint8_t* field);
+
+    /**
+     * Copy the queued values into the configuration and run the apply callback of each changed setting once
+     */
+    void applyQueued();
+
+    StoredConfig  _queued;      /**< Values waiting for loop(), only the fields flagged in _queuedMask are used */
+    uint32_t      _queuedMask;  /**< Bit per setting index with a queued value */
+    portMUX_TYPE  _lock;        /**< Guards the queue against the web server task */
+    bool          _unsaved;     /**< Whether the configuration has changes that are not written yet */
+    unsigned long _firstChange; /**< First unsaved change (millis) */
+    unsigned long _lastChange;  /**< Latest unsaved change (millis) */
+};
+
+/**
+ * Global instance of the settings registry
+ */
+extern SettingsRegistry& settingsRegistry;
+
+#endif  // SETTINGS_REGISTRY_H
@@ -0,0 +1,169 @@
+/**
+ * @file        slip.h
+ * @brief       SLIP packet framing for the Wiicon Remote project
+ *
+ * @details     Encoder and incremental decoder for SLIP (RFC 1055) as used by the OSC 1.1
+ *              serial transport: every packet is delimited by END on both sides and END/ESC
+ *              bytes inside it are escaped. Header-only and free of Arduino dependencies so
+ *              the firmware and the host serial bridge share the same code.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef SLIP_H
+#define SLIP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+const uint8_t SLIP_END     = 0xC0; /**< Packet delimiter */
+const uint8_t SLIP_ESC     = 0xDB; /**< Escape byte */
+const uint8_t SLIP_ESC_END = 0xDC; /**< Escaped END */
+const uint8_t SLIP_ESC_ESC = 0xDD; /**< Escaped ESC */
+
+const size_t SLIP_MAX_PACKET = 1500; /**< Largest decoded packet, longer ones are dropped */
+
+/**
+ * Worst-case encoded size of a packet
+ * @param length Packet length in bytes
+ * @return Bytes needed when every byte is escaped, plus both delimiters
+ */
+constexpr size_t slipMaxEncodedSize(size_t length) { return 2 * length + 2; }
+
+/**
+ * Encode one packet
+ * @param data Packet
+ * @param length Packet length in bytes
+ * @param out Output buffer
+ * @param capacity Output buffer size
+ * @return Encoded size, 0 if it does not fit
+ */
+inline size_t slipEncode(const uint8_t* data, size_t length, uint8_t* out, size_t capacity) {
+    size_t size = 0;
+    if (capacity < 2) return 0;
+
+    // Leading END flushes any line noise the receiver collected before the packet
+    out[size++] = SLIP_END;
+    for (size_t i = 0; i < length; ++i) {
+        uint8_t byte = data[i];
+        if (byte == SLIP_END || byte == SLIP_ESC) {
+            if (size + 3 > capacity) return 0;
+            out[size++] = SLIP_ESC;
+            out[size++] = byte == SLIP_END ? SLIP_ESC_END : SLIP_ESC_ESC;
+        } else {
+            if (size + 2 > capacity) return 0;
+            out[size++] = byte;
+        }
+    }
+    out[size++] = SLIP_END;
+    return size;
+}
+
+class SlipDecoder {
+   public:
+    /**
+     * Statistics since construction
+     */
+    struct Stats {
+        uint64_t packets   = 0; /**< Packets delivered */
+        uint64_t oversized = 0; /**< Packets dropped for exceeding SLIP_MAX_PACKET */
+        uint64_t malformed = 0; /**< Packets dropped for an invalid escape sequence */
+    };
+
+    /**
+     * Process received bytes
+     * @param data Bytes as read from the serial port, may split or join packets anywhere
+     * @param length Number of bytes
+     * @param deliver Called as deliver(const uint8_t* packet, size_t length) for each complete packet
+     * @return Number of packets delivered
+     */
+    template <typename Deliver>
+    size_t push(const uint8_t* data, size_t length, Deliver&& deliver) {
+        size_t delivered = 0;
+
+        for (size_t i = 0; i < length; ++i) {
+            uint8_t byte = data[i];
+
+            if (byte == SLIP_END) {
+                // Back-to-back delimiters are empty packets and carry nothing
+                if (_size > 0 && !_dropped) {
+                    _stats.packets++;
+                    delivered++;
+                    deliver((const uint8_t*)_buffer, _size);
+                }
+                _size    = 0;
+                _escaped = false;
+                _dropped = false;
+                continue;
+            }
+
+            if (_dropped) continue;
+
+            if (_escaped) {
+                _escaped = false;
+                if (byte == SLIP_ESC_END) {
+                    byte = SLIP_END;
+                } else if (byte == SLIP_ESC_ESC) {
+                    byte = SLIP_ESC;
+                } else {
+                    _stats.malformed++;
+                    _dropped = true;
+                    continue;
+                }
+            } else if (byte == SLIP_ESC) {
+                _escaped = true;
+                continue;
+            }
+
+            if (_size >= SLIP_MAX_PACKET) {
+                _stats.oversized++;
+                _dropped = true;
+                continue;
+            }
+            _buffer[_size++] = byte;
+        }
+
+        return delivered;
+    }
+
+    /**
+     * Get the statistics
+     * @return Statistics since construction
+     */
+    const Stats& stats() const { return _stats; }
+
+   private:
+    uint8_t _buffer[SLIP_MAX_PACKET]; /**< Packet being received */
+    size_t  _size    = 0;             /**< Bytes in the buffer */
+    bool    _escaped = false;         /**< Whether the previous byte was ESC */
+    bool    _dropped = false;         /**< Whether the current packet is discarded until the next END */
+    Stats   _stats;                   /**< Statistics since construction */
+};
+
+#endif  // SLIP_H
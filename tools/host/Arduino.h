@@ -0,0 +1,275 @@
+/**
+ * @file        Arduino.h
+ * @brief       Host stand-in for the Arduino ESP32 core
+ *
+ * @details     Just enough of the core for firmware modules to build into the host tests
+ *              (tools/wiicon_test_osc.cpp, tools/wiicon_fuzz_osc.cpp). Time comes from the
+ *              host's steady clock, Serial writes to stdout and the FreeRTOS critical
+ *              sections do nothing because the tests are single-threaded. Functions the
+ *              linked modules never call are only declared, so a new call fails at link
+ *              time instead of silently doing nothing.
+ *
+ *              Use with -Ihost ahead of -I.. so these headers replace the core's.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <thread>
+
+#define PI           3.14159265358979f
+#define HIGH         1
+#define LOW          0
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define IRAM_ATTR
+
+typedef uint8_t byte;
+
+// ----------------------------------------------------------------------------
+// Time
+// ----------------------------------------------------------------------------
+
+/**
+ * Microseconds since the first call, the host's stand-in for the time since boot
+ */
+inline uint64_t hostMicros() {
+    static const auto start = std::chrono::steady_clock::now();
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+inline unsigned long millis() { return (unsigned long)(hostMicros() / 1000); }
+inline unsigned long micros() { return (unsigned long)hostMicros(); }
+inline void          delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline void          delayMicroseconds(unsigned int us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+inline void          yield() {}
+
+// ----------------------------------------------------------------------------
+// GPIO and misc
+// ----------------------------------------------------------------------------
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+int  digitalRead(int pin);
+long random(long max);
+long random(long min, long max);
+
+template <typename T>
+T constrain(T x, T low, T high) {
+    return x < low ? low : (x > high ? high : x);
+}
+
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t length = strlen(src);
+    if (size > 0) {
+        size_t n = length < size - 1 ? length : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return length;
+}
+
+inline size_t strlcat(char* dst, const char* src, size_t size) {
+    size_t used = strnlen(dst, size);
+    return used + strlcpy(dst + used, src, size - used);
+}
+
+// ----------------------------------------------------------------------------
+// FreeRTOS critical sections
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    int owner;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portMUX_INITIALIZE(mux)      ((void)(mux))
+
+inline void portENTER_CRITICAL(portMUX_TYPE*) {}
+inline void portEXIT_CRITICAL(portMUX_TYPE*) {}
+
+// ----------------------------------------------------------------------------
+// String, Print, Stream
+// ----------------------------------------------------------------------------
+
+class String {
+   public:
+    String() {}
+    String(const char* text) : _text(text ? text : "") {}
+    String(int value) : _text(std::to_string(value)) {}
+    String(unsigned int value) : _text(std::to_string(value)) {}
+    String(long value) : _text(std::to_string(value)) {}
+    String(unsigned long value) : _text(std::to_string(value)) {}
+
+    const char* c_str() const { return _text.c_str(); }
+    unsigned    length() const { return (unsigned)_text.size(); }
+    bool        isEmpty() const { return _text.empty(); }
+    int         toInt() const { return atoi(_text.c_str()); }
+    float       toFloat() const { return (float)atof(_text.c_str()); }
+    void        reserve(unsigned size) { _text.reserve(size); }
+
+    String& operator+=(const String& other) {
+        _text += other._text;
+        return *this;
+    }
+    String& operator+=(const char* other) {
+        _text += other;
+        return *this;
+    }
+    String& operator+=(char c) {
+        _text += c;
+        return *this;
+    }
+
+    bool operator==(const char* other) const { return _text == other; }
+    bool operator==(const String& other) const { return _text == other._text; }
+    bool operator!=(const char* other) const { return _text != other; }
+    char operator[](unsigned index) const { return _text[index]; }
+
+    friend String operator+(const String& a, const String& b) { return String((a._text + b._text).c_str()); }
+
+   private:
+    std::string _text;
+};
+
+class Print {
+   public:
+    virtual ~Print() = default;
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* data, size_t length) {
+        size_t n = 0;
+        while (length--) n += write(*data++);
+        return n;
+    }
+    virtual void flush() {}
+
+    size_t print(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+    size_t print(const String& text) { return print(text.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t print(unsigned int value) { return printf("%u", value); }
+    size_t print(long value) { return printf("%ld", value); }
+    size_t print(unsigned long value) { return printf("%lu", value); }
+    size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+
+    size_t println() { return print("\r\n"); }
+    template <typename T>
+    size_t println(const T& value) {
+        return print(value) + println();
+    }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        char    text[256];
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(text, sizeof(text), format, args);
+        va_end(args);
+        if (length < 0) return 0;
+        return write((const uint8_t*)text, (size_t)length < sizeof(text) ? (size_t)length : sizeof(text) - 1);
+    }
+};
+
+class Stream : public Print {
+   public:
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+    virtual int peek() { return -1; }
+    int         availableForWrite() { return 4096; }
+};
+
+/**
+ * USB serial port, written to stdout
+ */
+class HardwareSerial : public Stream {
+   public:
+    void   begin(unsigned long) {}
+    void   setTxBufferSize(size_t) {}
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t* data, size_t length) override { return fwrite(data, 1, length, stdout); }
+    void   flush() override { fflush(stdout); }
+    operator bool() const { return true; }
+};
+
+inline HardwareSerial Serial;
+
+// ----------------------------------------------------------------------------
+// IPAddress
+// ----------------------------------------------------------------------------
+
+class IPAddress {
+   public:
+    IPAddress() : _bytes{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+    IPAddress(uint32_t address) { memcpy(_bytes, &address, sizeof(_bytes)); }
+
+    uint8_t  operator[](int index) const { return _bytes[index]; }
+    uint8_t& operator[](int index) { return _bytes[index]; }
+    operator uint32_t() const {
+        uint32_t address;
+        memcpy(&address, _bytes, sizeof(address));
+        return address;
+    }
+    bool operator==(const IPAddress& other) const { return memcmp(_bytes, other._bytes, sizeof(_bytes)) == 0; }
+    bool operator!=(const IPAddress& other) const { return !(*this == other); }
+
+    bool fromString(const char* text) {
+        unsigned parts[4];
+        char     end;
+        if (sscanf(text, "%u.%u.%u.%u%c", &parts[0], &parts[1], &parts[2], &parts[3], &end) != 4) return false;
+        for (int i = 0; i < 4; ++i) {
+            if (parts[i] > 255) return false;
+            _bytes[i] = (uint8_t)parts[i];
+        }
+        return true;
+    }
+
+    String toString() const {
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+        return String(text);
+    }
+
+   private:
+    uint8_t _bytes[4];
+};
+
+// ----------------------------------------------------------------------------
+// Chip
+// ----------------------------------------------------------------------------
+
+class EspClass {
+   public:
+    void     restart();
+    uint32_t getFreeHeap() { return 0; }
+    uint32_t getMinFreeHeap() { return 0; }
+    uint64_t getEfuseMac() { return 0x2A0000000000ull; }
+};
+
+inline EspClass ESP;
+
+uint32_t getCpuFrequencyMhz();
+bool     setCpuFrequencyMhz(uint32_t mhz);
+uint32_t esp_random();
+
+#endif  // HOST_ARDUINO_H
@@ -0,0 +1,26 @@
+/**
+ * @file        DNSServer.h
+ * @brief       Host stand-in for the Arduino DNS server
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_DNSSERVER_H
+#define HOST_DNSSERVER_H
+
+#include <Arduino.h>
+
+class DNSServer {
+   public:
+    bool start(uint16_t port, const String& domain, const IPAddress& ip);
+    void processNextRequest();
+    void stop();
+};
+
+#endif  // HOST_DNSSERVER_H
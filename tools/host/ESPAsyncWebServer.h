@@ -0,0 +1,130 @@
+/**
+ * @file        ESPAsyncWebServer.h
+ * @brief       Host stand-in for the ESPAsyncWebServer library
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h. The
+ *              server and the WebSocket endpoint start but never see a client.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_ESPASYNCWEBSERVER_H
+#define HOST_ESPASYNCWEBSERVER_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include <functional>
+
+typedef enum { HTTP_GET = 1, HTTP_POST = 2, HTTP_ANY = 255 } WebRequestMethod;
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+
+class AsyncWebParameter {
+   public:
+    const String& name() const;
+    const String& value() const;
+    bool          isPost() const;
+};
+
+class AsyncWebHeader {
+   public:
+    const String& value() const;
+};
+
+class AsyncWebServerResponse {
+   public:
+    void addHeader(const char* name, const char* value);
+    void addHeader(const char* name, const String& value);
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+   public:
+    size_t write(uint8_t c) override;
+    using Print::write;
+};
+
+class AsyncWebServerRequest {
+   public:
+    int                      params() const;
+    const AsyncWebParameter* getParam(size_t index) const;
+    const AsyncWebParameter* getParam(const char* name, bool post = false) const;
+    bool                     hasParam(const char* name, bool post = false) const;
+    bool                     hasHeader(const char* name) const;
+    const AsyncWebHeader*    getHeader(const char* name) const;
+    void                     send(int code, const char* type, const String& content);
+    void                     send(fs::FS& fs, const char* path, const char* type);
+    void                     send(AsyncWebServerResponse* response);
+    void                     redirect(const String& url);
+    AsyncWebServerResponse*  beginResponse(int code, const char* type = "", const String& content = String());
+    AsyncWebServerResponse*  beginResponse(int code, const char* type, const uint8_t* content, size_t length);
+    AsyncWebServerResponse*  beginResponse(fs::FS& fs, const char* path, const char* type, bool download = false);
+    AsyncResponseStream*     beginResponseStream(const char* type, size_t bufferSize = 1460);
+    AsyncWebServerResponse*  beginChunkedResponse(const char* type,
+                                                  std::function<size_t(uint8_t*, size_t, size_t)> filler);
+};
+
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+
+class AsyncWebHandler {
+   public:
+    virtual ~AsyncWebHandler() = default;
+};
+
+class AsyncStaticWebHandler : public AsyncWebHandler {
+   public:
+    AsyncStaticWebHandler& setCacheControl(const char* value);
+};
+
+class AsyncWebServer {
+   public:
+    AsyncWebServer(uint16_t) {}
+    void begin() {}
+    void end() {}
+    void addHandler(AsyncWebHandler*) {}
+
+    void                   on(const char* uri, int method, ArRequestHandlerFunction handler);
+    void                   onNotFound(ArRequestHandlerFunction handler);
+    AsyncStaticWebHandler& serveStatic(const char* uri, fs::FS& fs, const char* path, const char* cache = nullptr);
+};
+
+class AsyncWebSocketClient {
+   public:
+    uint32_t  id() const { return 1; }
+    IPAddress remoteIP() const { return IPAddress(192, 168, 1, 10); }
+    void      close(uint16_t = 0, const char* = nullptr) {}
+};
+
+class AsyncWebSocket : public AsyncWebHandler {
+   public:
+    typedef std::function<void(AsyncWebSocket*, AsyncWebSocketClient*, AwsEventType, void*, uint8_t*, size_t)>
+        AwsEventHandler;
+
+    AsyncWebSocket(const char*) {}
+    void   onEvent(AwsEventHandler) {}
+    bool   availableForWrite(uint32_t) { return false; }
+    void   binary(uint32_t, const uint8_t*, size_t) {}
+    void   cleanupClients(uint16_t = 8) {}
+    size_t count() const { return 0; }
+};
+
+class AsyncEventSourceClient {
+   public:
+    void      close();
+    uint32_t  lastId() const;
+    IPAddress client();
+};
+
+class AsyncEventSource : public AsyncWebHandler {
+   public:
+    AsyncEventSource(const char* url);
+    void   onConnect(std::function<void(AsyncEventSourceClient*)> callback);
+    void   send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+    size_t count() const;
+    size_t avgPacketsWaiting() const;
+};
+
+#endif  // HOST_ESPASYNCWEBSERVER_H
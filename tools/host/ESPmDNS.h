@@ -0,0 +1,33 @@
+/**
+ * @file        ESPmDNS.h
+ * @brief       Host stand-in for the Arduino mDNS responder
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_ESPMDNS_H
+#define HOST_ESPMDNS_H
+
+#include <Arduino.h>
+
+#include "mdns.h"
+
+class MDNSResponder {
+   public:
+    bool begin(const char* hostName);
+    void end();
+    void setInstanceName(const String& name);
+    bool addService(const char* service, const char* proto, uint16_t port);
+    bool addServiceTxt(const char* service, const char* proto, const char* key, const char* value);
+    bool addServiceTxt(const char* service, const char* proto, const String& key, const String& value);
+};
+
+extern MDNSResponder MDNS;
+
+#endif  // HOST_ESPMDNS_H
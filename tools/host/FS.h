@@ -0,0 +1,48 @@
+/**
+ * @file        FS.h
+ * @brief       Host stand-in for the Arduino file system API
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <Arduino.h>
+
+#define FILE_READ  "r"
+#define FILE_WRITE "w"
+
+namespace fs {
+
+class File : public Stream {
+   public:
+    operator bool() const;
+    bool   isDirectory();
+    void   close();
+    size_t size();
+    size_t read(uint8_t* buffer, size_t length);
+    int    read() override;
+    size_t write(uint8_t c) override;
+    using Print::write;
+};
+
+class FS {
+   public:
+    File open(const char* path, const char* mode = FILE_READ);
+    bool exists(const char* path);
+    bool remove(const char* path);
+    bool rename(const char* from, const char* to);
+};
+
+}  // namespace fs
+
+using fs::File;
+
+#endif  // HOST_FS_H
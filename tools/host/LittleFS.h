@@ -0,0 +1,26 @@
+/**
+ * @file        LittleFS.h
+ * @brief       Host stand-in for the LittleFS library
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+#include <FS.h>
+
+class LittleFSFS : public fs::FS {
+   public:
+    bool begin(bool formatOnFail = false);
+};
+
+extern LittleFSFS LittleFS;
+
+#endif  // HOST_LITTLEFS_H
@@ -0,0 +1,33 @@
+/**
+ * @file        Preferences.h
+ * @brief       Host stand-in for the Arduino NVS library
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+
+class Preferences {
+   public:
+    bool    begin(const char* name, bool readOnly = false, const char* partition = nullptr);
+    void    end();
+    bool    clear();
+    bool    remove(const char* key);
+    bool    isKey(const char* key);
+    size_t  putBytes(const char* key, const void* value, size_t length);
+    size_t  getBytes(const char* key, void* buffer, size_t length);
+    size_t  getBytesLength(const char* key);
+    size_t  putUChar(const char* key, uint8_t value);
+    uint8_t getUChar(const char* key, uint8_t defaultValue = 0);
+};
+
+#endif  // HOST_PREFERENCES_H
@@ -0,0 +1,92 @@
+/**
+ * @file        WiFi.h
+ * @brief       Host stand-in for the Arduino WiFi library
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+#include <esp_wifi_types.h>
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED  (-2)
+
+typedef enum { WIFI_POWER_19_5dBm = 78, WIFI_POWER_8_5dBm = 34, WIFI_POWER_2dBm = 8 } wifi_power_t;
+typedef enum { WL_IDLE_STATUS, WL_CONNECTED, WL_DISCONNECTED, WL_CONNECT_FAILED } wl_status_t;
+typedef enum { WIFI_OFF, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+typedef enum { WIFI_AUTH_OPEN, WIFI_AUTH_WPA2_PSK } wifi_auth_mode_t;
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_STA_START,
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP,
+    ARDUINO_EVENT_WIFI_STA_LOST_IP,
+    ARDUINO_EVENT_WIFI_SCAN_DONE,
+    ARDUINO_EVENT_MAX,
+} arduino_event_id_t;
+
+typedef struct {
+    struct {
+        uint8_t bssid[6];
+        uint8_t channel;
+        uint8_t reason;
+    } wifi_sta_connected, wifi_sta_disconnected;
+} arduino_event_info_t;
+
+typedef void (*WiFiEventCb)(arduino_event_id_t event);
+typedef void (*WiFiEventSysCb)(arduino_event_id_t event, arduino_event_info_t info);
+
+/**
+ * Station on 192.168.1.50/24, event handlers are accepted and never called
+ */
+class WiFiClass {
+   public:
+    IPAddress localIP() { return IPAddress(192, 168, 1, 50); }
+    IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+    IPAddress gatewayIP() { return IPAddress(192, 168, 1, 1); }
+    IPAddress dnsIP(int = 0) { return IPAddress(192, 168, 1, 1); }
+    IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+    int       onEvent(WiFiEventCb, arduino_event_id_t = ARDUINO_EVENT_MAX) { return 0; }
+    int       onEvent(WiFiEventSysCb, arduino_event_id_t = ARDUINO_EVENT_MAX) { return 0; }
+
+    wl_status_t      status();
+    bool             mode(wifi_mode_t mode);
+    wifi_mode_t      getMode();
+    bool             config(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress(),
+                            IPAddress dns2 = IPAddress());
+    wl_status_t      begin(const char* ssid, const char* password, int32_t channel = 0, const uint8_t* bssid = nullptr,
+                           bool connect = true);
+    bool             softAP(const char* ssid, const char* password, int channel = 1, int hidden = 0, int clients = 4);
+    int16_t          scanNetworks(bool async = false, bool showHidden = false);
+    int16_t          scanComplete();
+    void             scanDelete();
+    String           SSID();
+    String           SSID(uint8_t index);
+    int32_t          RSSI();
+    int32_t          RSSI(uint8_t index);
+    wifi_auth_mode_t encryptionType(uint8_t index);
+    uint8_t*         BSSID();
+    int32_t          channel();
+    String           macAddress();
+    void             persistent(bool persistent);
+    bool             setSleep(bool enable);
+    bool             setSleep(wifi_ps_type_t type);
+    bool             setTxPower(wifi_power_t power);
+    bool             setAutoReconnect(bool enable);
+    bool             disconnect(bool wifiOff = false);
+    bool             reconnect();
+};
+
+inline WiFiClass WiFi;
+
+#endif  // HOST_WIFI_H
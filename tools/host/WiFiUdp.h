@@ -0,0 +1,68 @@
+/**
+ * @file        WiFiUdp.h
+ * @brief       Host stand-in for the Arduino UDP socket
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_WIFIUDP_H
+#define HOST_WIFIUDP_H
+
+#include <Arduino.h>
+
+/**
+ * Socket that accepts every packet and receives the datagrams handed to hostDeliver()
+ */
+class WiFiUDP : public Stream {
+   public:
+    /**
+     * Make a datagram the next one parsePacket() returns, on any socket
+     * @param data Datagram, must stay valid until it is read
+     * @param length Datagram length in bytes
+     */
+    static void hostDeliver(const uint8_t* data, size_t length) {
+        _pending       = data;
+        _pendingLength = length;
+    }
+
+    uint8_t   begin(uint16_t) { return 1; }
+    uint8_t   beginMulticast(IPAddress, uint16_t) { return 1; }
+    void      stop() {}
+    int       beginPacket(IPAddress, uint16_t) { return 1; }
+    int       endPacket() { return 1; }
+    size_t    write(uint8_t) override { return 1; }
+    size_t    write(const uint8_t*, size_t length) override { return length; }
+    int       read() override { return -1; }
+    void      flush() override { _current = nullptr; }
+    IPAddress remoteIP() { return IPAddress(192, 168, 1, 10); }
+    uint16_t  remotePort() { return 9000; }
+
+    int parsePacket() {
+        _current       = _pending;
+        _currentLength = _pendingLength;
+        _pending       = nullptr;
+        return _current ? (int)_currentLength : 0;
+    }
+
+    int read(uint8_t* buffer, size_t length) {
+        if (!_current) return 0;
+        size_t count = length < _currentLength ? length : _currentLength;
+        memcpy(buffer, _current, count);
+        _current = nullptr;
+        return (int)count;
+    }
+
+   private:
+    static inline const uint8_t* _pending       = nullptr; /**< Datagram parsePacket() returns next */
+    static inline size_t         _pendingLength = 0;       /**< Its length */
+    const uint8_t*               _current       = nullptr; /**< Datagram read() returns */
+    size_t                       _currentLength = 0;       /**< Its length */
+};
+
+#endif  // HOST_WIFIUDP_H
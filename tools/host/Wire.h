@@ -0,0 +1,32 @@
+/**
+ * @file        Wire.h
+ * @brief       Host stand-in for the Arduino I2C library
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+
+class TwoWire : public Stream {
+   public:
+    bool    begin(int sda, int scl, uint32_t frequency = 0);
+    void    setClock(uint32_t frequency);
+    void    beginTransmission(uint8_t address);
+    uint8_t endTransmission(bool stop = true);
+    size_t  requestFrom(int address, int length);
+    size_t  write(uint8_t c) override;
+    using Print::write;
+};
+
+extern TwoWire Wire;
+
+#endif  // HOST_WIRE_H
@@ -0,0 +1,45 @@
+/**
+ * @file        driver/gpio.h
+ * @brief       Host stand-in for the ESP-IDF GPIO driver
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_DRIVER_GPIO_H
+#define HOST_DRIVER_GPIO_H
+
+#include <stdint.h>
+
+typedef enum {
+    GPIO_NUM_0,
+    GPIO_NUM_1,
+    GPIO_NUM_2,
+    GPIO_NUM_3,
+    GPIO_NUM_4,
+    GPIO_NUM_5,
+    GPIO_NUM_6,
+    GPIO_NUM_7,
+} gpio_num_t;
+
+enum { GPIO_INTR_DISABLE };
+enum { GPIO_MODE_INPUT };
+enum { GPIO_PULLUP_DISABLE, GPIO_PULLUP_ENABLE };
+enum { GPIO_PULLDOWN_DISABLE, GPIO_PULLDOWN_ENABLE };
+
+typedef struct {
+    uint64_t pin_bit_mask;
+    int      mode;
+    int      pull_up_en;
+    int      pull_down_en;
+    int      intr_type;
+} gpio_config_t;
+
+int gpio_config(const gpio_config_t* config);
+
+#endif  // HOST_DRIVER_GPIO_H
@@ -0,0 +1,35 @@
+/**
+ * @file        esp_sleep.h
+ * @brief       Host stand-in for the ESP-IDF sleep API
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_ESP_SLEEP_H
+#define HOST_ESP_SLEEP_H
+
+#include <stdint.h>
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED,
+    ESP_SLEEP_WAKEUP_EXT1,
+    ESP_SLEEP_WAKEUP_GPIO,
+    ESP_SLEEP_WAKEUP_TIMER,
+} esp_sleep_wakeup_cause_t;
+
+enum { ESP_GPIO_WAKEUP_GPIO_LOW, ESP_GPIO_WAKEUP_GPIO_HIGH };
+enum { ESP_PD_DOMAIN_RTC_PERIPH };
+enum { ESP_PD_OPTION_OFF, ESP_PD_OPTION_ON };
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
+int                      esp_deep_sleep_enable_gpio_wakeup(uint64_t mask, int mode);
+int                      esp_sleep_pd_config(int domain, int option);
+void                     esp_deep_sleep_start();
+
+#endif  // HOST_ESP_SLEEP_H
@@ -0,0 +1,21 @@
+/**
+ * @file        esp_timer.h
+ * @brief       Host stand-in for the ESP-IDF high resolution timer
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+#include <Arduino.h>
+
+inline int64_t esp_timer_get_time() { return (int64_t)hostMicros(); }
+
+#endif  // HOST_ESP_TIMER_H
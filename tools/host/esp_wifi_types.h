@@ -0,0 +1,19 @@
+/**
+ * @file        esp_wifi_types.h
+ * @brief       Host stand-in for the ESP-IDF WiFi types
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_ESP_WIFI_TYPES_H
+#define HOST_ESP_WIFI_TYPES_H
+
+typedef enum { WIFI_PS_NONE, WIFI_PS_MIN_MODEM, WIFI_PS_MAX_MODEM } wifi_ps_type_t;
+
+#endif  // HOST_ESP_WIFI_TYPES_H
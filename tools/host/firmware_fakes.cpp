@@ -0,0 +1,43 @@
+/**
+ * @file        firmware_fakes.cpp
+ * @brief       Host stand-ins for the firmware singletons the host tests do not link
+ *
+ * @details     The configuration store and the WiFi manager pull in NVS, LittleFS and the
+ *              captive portal. The tests only need the state other modules read from them,
+ *              so both are reduced to that: an empty configuration (every default) and a
+ *              station that is connected. Tests change the configuration through
+ *              configStore.edit().
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#include "config_store.h"
+#include "wifi_manager.h"
+
+ConfigStore& configStore = ConfigStore::instance();
+WiFiManager& wifiManager = WiFiManager::instance();
+
+ConfigStore& ConfigStore::instance() {
+    static ConfigStore instance;
+    return instance;
+}
+
+ConfigStore::ConfigStore() : _config{}, _initialized(true) {}
+
+bool ConfigStore::begin() { return _config.ssid[0] != '\0'; }
+
+bool ConfigStore::write() { return true; }
+
+WiFiManager& WiFiManager::instance() {
+    static WiFiManager instance;
+    return instance;
+}
+
+// Connected station, so the UDP transport comes up like on the device
+WiFiManager::WiFiManager() : _server(80), _state(WiFiState::CONNECTED) {}
+
+void WiFiManager::reconnect() {}
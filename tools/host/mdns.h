@@ -0,0 +1,70 @@
+/**
+ * @file        mdns.h
+ * @brief       Host stand-in for the ESP-IDF mDNS component
+ *
+ * @details     Part of the host stand-in for the Arduino ESP32 core, see Arduino.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef HOST_MDNS_H
+#define HOST_MDNS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int esp_err_t;
+
+#define MDNS_TYPE_PTR      0x000C
+#define ESP_IPADDR_TYPE_V4 0
+
+typedef struct {
+    uint32_t addr;
+} esp_ip4_addr_t;
+
+typedef struct {
+    union {
+        esp_ip4_addr_t ip4;
+    } u_addr;
+    uint8_t type;
+} esp_ip_addr_t;
+
+typedef struct mdns_ip_addr_s {
+    esp_ip_addr_t          addr;
+    struct mdns_ip_addr_s* next;
+} mdns_ip_addr_t;
+
+typedef struct {
+    const char* key;
+    const char* value;
+} mdns_txt_item_t;
+
+typedef struct mdns_result_s {
+    struct mdns_result_s* next;
+    uint32_t              ttl;
+    char*                 instance_name;
+    char*                 service_type;
+    char*                 proto;
+    char*                 hostname;
+    uint16_t              port;
+    mdns_txt_item_t*      txt;
+    uint8_t*              txt_value_len;
+    size_t                txt_count;
+    mdns_ip_addr_t*       addr;
+} mdns_result_t;
+
+typedef struct mdns_search_once_s mdns_search_once_t;
+typedef void (*mdns_query_notify_t)(mdns_search_once_t* search);
+
+mdns_search_once_t* mdns_query_async_new(const char* name, const char* service, const char* proto, uint16_t type,
+                                         uint32_t timeout, size_t maxResults, mdns_query_notify_t notifier);
+bool      mdns_query_async_get_results(mdns_search_once_t* search, uint32_t timeout, mdns_result_t** results,
+                                       uint8_t* count);
+esp_err_t mdns_query_async_delete(mdns_search_once_t* search);
+void      mdns_query_results_free(mdns_result_t* results);
+
+#endif  // HOST_MDNS_H
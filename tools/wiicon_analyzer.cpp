@@ -0,0 +1,470 @@
+/**
+ * @file        wiicon_analyzer.cpp
+ * @brief       Host stream analyzer for WiiCon OSC and binary frame streams
+ *
+ * @details     Listens for WiiCon datagrams and reports, per device, the packet rate,
+ *              inter-arrival jitter distribution, loss, reordering, duplicates and
+ *              payload throughput. Sequence numbers (binary frames) and sender
+ *              timestamps (frames, OSC bundle timetags) are used when present, and
+ *              redundant frame bundles are reassembled so that loss is reported both
+ *              before and after recovery; plain
+ *              OSC streams fall back to arrival statistics. Reports are printed live
+ *              and can be appended to CSV and JSON Lines files for regression tracking.
+ *
+ *              Build: g++ -std=c++17 -O2 -I.. wiicon_analyzer.cpp -o wiicon_analyzer
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "wiicon_frame.h"
+#include "wiicon_reassembler.h"
+
+namespace {
+
+volatile sig_atomic_t stopRequested = 0;
+
+void onSignal(int) { stopRequested = 1; }
+
+double nowSeconds() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+struct Options {
+    uint16_t    listenPort = 9000;
+    const char* group      = nullptr;
+    double      interval   = 1.0;
+    double      duration   = 0.0;
+    const char* csvPath    = nullptr;
+    const char* jsonPath   = nullptr;
+    uint16_t    feedback   = 0;
+};
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s [--listen PORT] [--group ADDR] [--interval SEC] [--duration SEC] [--csv FILE] [--json FILE]\n"
+            "          [--feedback PORT]\n"
+            "  --listen PORT   UDP port to listen on (default 9000)\n"
+            "  --group ADDR    multicast group to join (e.g. 239.255.0.90)\n"
+            "  --interval SEC  report interval (default 1)\n"
+            "  --duration SEC  stop after this many seconds (default: run until Ctrl+C)\n"
+            "  --csv FILE      append one row per device and interval\n"
+            "  --json FILE     append one JSON object per device and interval\n"
+            "  --feedback PORT send each device its loss as /wiicon/feedback after every interval (device: 8000)\n",
+            argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--listen") && hasValue) {
+            options->listenPort = (uint16_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--group") && hasValue) {
+            options->group = argv[++i];
+        } else if (!strcmp(argv[i], "--interval") && hasValue) {
+            options->interval = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--duration") && hasValue) {
+            options->duration = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--csv") && hasValue) {
+            options->csvPath = argv[++i];
+        } else if (!strcmp(argv[i], "--json") && hasValue) {
+            options->jsonPath = argv[++i];
+        } else if (!strcmp(argv[i], "--feedback") && hasValue) {
+            options->feedback = (uint16_t)atoi(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return options->interval > 0.0;
+}
+
+/**
+ * Statistics of one device over one report interval
+ */
+struct Window {
+    uint64_t            packets    = 0;
+    uint64_t            bytes      = 0;
+    uint64_t            lost       = 0;
+    uint64_t            reordered  = 0;
+    uint64_t            duplicates = 0;
+    uint64_t            recovered  = 0; /**< Frames lost on the wire but recovered from a redundant bundle */
+    std::vector<double> gaps; /**< Inter-arrival times in ms */
+};
+
+/**
+ * Tracking state of one device
+ */
+struct Device {
+    std::string name;
+    sockaddr_in address{}; /**< Source of the last packet, feedback goes to its IP */
+    Window      window;
+    Window      total;
+    double      lastArrival = -1.0;
+
+    // Redundant bundles are reassembled before sequence tracking
+    FrameReassembler reassembler;
+
+    // Sequence tracking (binary frames)
+    bool     hasSequence  = false;
+    uint16_t lastSequence = 0;
+    int      stride       = 0; /**< Smallest positive sequence step seen, > 1 for decimated destinations */
+
+    // Transit jitter (RFC 3550) from sender timestamps
+    bool   hasSenderTime = false;
+    double lastTransit   = 0.0;
+    double transitJitter = 0.0;
+
+    // Device micros() wraps every ~71 minutes, frame timestamps are unwrapped into a running clock
+    bool     hasTimestamp  = false;
+    uint32_t lastTimestamp = 0;
+    double   senderClock   = 0.0;
+
+    double unwrapTimestamp(uint32_t timestamp) {
+        if (hasTimestamp) senderClock += (int32_t)(timestamp - lastTimestamp) / 1e6;
+        hasTimestamp  = true;
+        lastTimestamp = timestamp;
+        return senderClock;
+    }
+
+    void addPacket(double arrival, size_t length) {
+        for (Window* w : {&window, &total}) {
+            w->packets++;
+            w->bytes += length;
+            if (lastArrival >= 0.0) w->gaps.push_back((arrival - lastArrival) * 1000.0);
+        }
+        lastArrival = arrival;
+    }
+
+    void addSequence(uint16_t sequence) {
+        if (!hasSequence) {
+            hasSequence  = true;
+            lastSequence = sequence;
+            return;
+        }
+
+        int16_t delta = (int16_t)(sequence - lastSequence);
+        if (delta == 0) {
+            count(&Window::duplicates, 1);
+        } else if (delta < 0) {
+            // A late packet fills a gap that was already counted as lost
+            count(&Window::reordered, 1);
+            if (window.lost > 0) window.lost--;
+            if (total.lost > 0) total.lost--;
+        } else {
+            if (stride == 0 || delta < stride) stride = delta;
+            int missing = delta / stride - 1;
+            if (missing > 0) count(&Window::lost, (uint64_t)missing);
+            lastSequence = sequence;
+        }
+    }
+
+    void addSenderTime(double arrival, double senderTime) {
+        double transit = arrival - senderTime;
+        if (hasSenderTime) {
+            double d = fabs(transit - lastTransit);
+            transitJitter += (d - transitJitter) / 16.0;
+        }
+        hasSenderTime = true;
+        lastTransit   = transit;
+    }
+
+    void count(uint64_t Window::*field, uint64_t n) {
+        window.*field += n;
+        total.*field += n;
+    }
+};
+
+double percentile(std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t index = (size_t)std::min(sorted.size() - 1.0, std::floor(p * (sorted.size() - 1) + 0.5));
+    return sorted[index];
+}
+
+struct Summary {
+    double rate, throughput, mean, stddev, p50, p95, p99, max, lossPercent;
+};
+
+Summary summarize(Window& w, double seconds) {
+    Summary s{};
+    s.rate       = w.packets / seconds;
+    s.throughput = w.bytes / seconds;
+
+    std::sort(w.gaps.begin(), w.gaps.end());
+    if (!w.gaps.empty()) {
+        double sum = 0.0, sumSq = 0.0;
+        for (double g : w.gaps) {
+            sum += g;
+            sumSq += g * g;
+        }
+        s.mean   = sum / w.gaps.size();
+        s.stddev = std::sqrt(std::max(0.0, sumSq / w.gaps.size() - s.mean * s.mean));
+        s.p50    = percentile(w.gaps, 0.50);
+        s.p95    = percentile(w.gaps, 0.95);
+        s.p99    = percentile(w.gaps, 0.99);
+        s.max    = w.gaps.back();
+    }
+
+    uint64_t expected = w.packets + w.lost;
+    s.lossPercent     = expected ? 100.0 * w.lost / expected : 0.0;
+    return s;
+}
+
+/**
+ * Send each sequence-tracked device the loss fraction of the current interval as /wiicon/feedback ,f
+ * Plain OSC streams carry no sequence numbers, so loss is unknown and nothing is sent.
+ */
+void sendFeedback(std::map<std::string, Device>& devices, int sock, uint16_t port) {
+    for (auto& entry : devices) {
+        Device&       device   = entry.second;
+        const Window& w        = device.window;
+        uint64_t      expected = w.packets + w.lost;
+        if (!device.hasSequence || expected == 0) continue;
+
+        float    loss = (float)w.lost / (float)expected;
+        uint32_t bits;
+        memcpy(&bits, &loss, sizeof(bits));
+        bits = htonl(bits);
+
+        uint8_t message[28] = "/wiicon/feedback";  // 17 bytes padded to 20
+        memcpy(message + 20, ",f\0\0", 4);
+        memcpy(message + 24, &bits, sizeof(bits));
+
+        sockaddr_in target = device.address;
+        target.sin_port    = htons(port);
+        sendto(sock, message, sizeof(message), 0, (sockaddr*)&target, sizeof(target));
+    }
+}
+
+void report(std::map<std::string, Device>& devices, double elapsed, double seconds, FILE* csv, FILE* json,
+            bool final) {
+    printf("%s t=%.1fs\n", final ? "=== total" : "---", elapsed);
+
+    for (auto& entry : devices) {
+        Device& device = entry.second;
+        Window& w      = final ? device.total : device.window;
+        Summary s      = summarize(w, seconds);
+
+        printf("%-32s %7.1f pkt/s %8.0f B/s  gap ms mean %.2f sd %.2f p50 %.2f p95 %.2f p99 %.2f max %.2f",
+               device.name.c_str(), s.rate, s.throughput, s.mean, s.stddev, s.p50, s.p95, s.p99, s.max);
+        if (device.hasSequence) {
+            printf("  lost %llu (%.2f%%) recovered %llu reord %llu dup %llu", (unsigned long long)w.lost,
+                   s.lossPercent, (unsigned long long)w.recovered, (unsigned long long)w.reordered,
+                   (unsigned long long)w.duplicates);
+        }
+        if (device.hasSenderTime) printf("  jitter %.3f ms", device.transitJitter * 1000.0);
+        printf("\n");
+
+        if (csv) {
+            fprintf(csv, "%.3f,%s,%d,%llu,%llu,%.2f,%.1f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%llu,%llu,%llu,%llu,%.4f\n",
+                    elapsed, device.name.c_str(), final ? 1 : 0, (unsigned long long)w.packets,
+                    (unsigned long long)w.bytes, s.rate, s.throughput, s.mean, s.stddev, s.p50, s.p95, s.p99, s.max,
+                    (unsigned long long)w.lost, (unsigned long long)w.recovered, (unsigned long long)w.reordered,
+                    (unsigned long long)w.duplicates, device.transitJitter * 1000.0);
+            fflush(csv);
+        }
+
+        if (json) {
+            fprintf(json,
+                    "{\"t\":%.3f,\"device\":\"%s\",\"total\":%s,\"packets\":%llu,\"bytes\":%llu,\"rate\":%.2f,"
+                    "\"throughput\":%.1f,\"gap_ms\":{\"mean\":%.4f,\"stddev\":%.4f,\"p50\":%.4f,\"p95\":%.4f,"
+                    "\"p99\":%.4f,\"max\":%.4f},\"lost\":%llu,\"recovered\":%llu,\"reordered\":%llu,"
+                    "\"duplicates\":%llu,\"transit_jitter_ms\":%.4f}\n",
+                    elapsed, device.name.c_str(), final ? "true" : "false", (unsigned long long)w.packets,
+                    (unsigned long long)w.bytes, s.rate, s.throughput, s.mean, s.stddev, s.p50, s.p95, s.p99, s.max,
+                    (unsigned long long)w.lost, (unsigned long long)w.recovered, (unsigned long long)w.reordered,
+                    (unsigned long long)w.duplicates, device.transitJitter * 1000.0);
+            fflush(json);
+        }
+
+        device.window = Window();
+    }
+
+    fflush(stdout);
+}
+
+/**
+ * Read the timetag of an OSC bundle in seconds
+ * @return true if the packet is a bundle with a non-immediate timetag
+ */
+bool oscBundleTime(const uint8_t* data, size_t length, double* seconds) {
+    if (length < 16 || memcmp(data, "#bundle", 8) != 0) return false;
+
+    uint32_t secs = ((uint32_t)data[8] << 24) | (data[9] << 16) | (data[10] << 8) | data[11];
+    uint32_t frac = ((uint32_t)data[12] << 24) | (data[13] << 16) | (data[14] << 8) | data[15];
+    if (secs == 0 && frac <= 1) return false;
+
+    *seconds = secs + frac / 4294967296.0;
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    int reuse = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr{};
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port        = htons(options.listenPort);
+    if (bind(sock, (sockaddr*)&addr, sizeof(addr)) < 0) {
+        perror("bind");
+        return 1;
+    }
+
+    if (options.group) {
+        ip_mreq mreq{};
+        mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+        if (inet_pton(AF_INET, options.group, &mreq.imr_multiaddr) != 1 ||
+            setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+            fprintf(stderr, "Failed to join multicast group %s\n", options.group);
+            return 1;
+        }
+    }
+
+    FILE* csv  = options.csvPath ? fopen(options.csvPath, "a") : nullptr;
+    FILE* json = options.jsonPath ? fopen(options.jsonPath, "a") : nullptr;
+    if ((options.csvPath && !csv) || (options.jsonPath && !json)) {
+        perror("fopen");
+        return 1;
+    }
+    if (csv && ftell(csv) == 0) {
+        fprintf(csv,
+                "t,device,total,packets,bytes,rate,throughput,gap_mean_ms,gap_stddev_ms,gap_p50_ms,gap_p95_ms,"
+                "gap_p99_ms,gap_max_ms,lost,recovered,reordered,duplicates,transit_jitter_ms\n");
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    printf("Listening on UDP :%u%s%s\n", options.listenPort, options.group ? " group " : "",
+           options.group ? options.group : "");
+
+    std::map<std::string, Device> devices;
+    uint8_t                       packet[1500];
+    double                        start      = nowSeconds();
+    double                        lastReport = start;
+
+    while (!stopRequested) {
+        double now = nowSeconds();
+        if (options.duration > 0.0 && now - start >= options.duration) break;
+
+        if (now - lastReport >= options.interval) {
+            if (options.feedback) sendFeedback(devices, sock, options.feedback);
+            report(devices, now - start, now - lastReport, csv, json, false);
+            lastReport = now;
+        }
+
+        pollfd pfd = {sock, POLLIN, 0};
+        if (poll(&pfd, 1, 50) <= 0) continue;
+
+        sockaddr_in from{};
+        socklen_t   fromLength = sizeof(from);
+        ssize_t     length     = recvfrom(sock, packet, sizeof(packet), 0, (sockaddr*)&from, &fromLength);
+        if (length <= 0) continue;
+
+        double arrival = nowSeconds();
+        char   source[INET_ADDRSTRLEN];
+        inet_ntop(AF_INET, &from.sin_addr, source, sizeof(source));
+
+        WiiconFrame frame;
+        std::string key;
+        bool        isBundle = frameIsBundle(packet, (size_t)length);
+        bool        isFrame  = !isBundle && frameDecode(packet, (size_t)length, &frame);
+
+        // The newest frame of a bundle identifies the device and carries the send time
+        WiiconFrame bundle[1 + FRAME_MAX_REDUNDANCY];
+        if (isBundle) {
+            if (!frameBundleDecode(packet, (size_t)length, bundle, 1 + FRAME_MAX_REDUNDANCY)) continue;
+            frame = bundle[0];
+        }
+
+        if (isFrame || isBundle) {
+            key = "frame:" + std::to_string(frame.deviceId) + "@" + source;
+        } else {
+            key = std::string("osc@") + source + ":" + std::to_string(ntohs(from.sin_port));
+        }
+
+        Device& device = devices[key];
+        if (device.name.empty()) device.name = key;
+        device.address = from;
+        device.addPacket(arrival, (size_t)length);
+
+        double senderTime;
+        if (isBundle) {
+            device.reassembler.push(packet, (size_t)length, [&](const WiiconFrame& delivered, bool recovered) {
+                device.addSequence(delivered.sequence);
+                if (recovered) device.count(&Window::recovered, 1);
+            });
+            device.addSenderTime(arrival, device.unwrapTimestamp(frame.timestamp));
+        } else if (isFrame) {
+            device.addSequence(frame.sequence);
+            device.addSenderTime(arrival, device.unwrapTimestamp(frame.timestamp));
+        } else if (oscBundleTime(packet, (size_t)length, &senderTime)) {
+            device.addSenderTime(arrival, senderTime);
+        }
+    }
+
+    report(devices, nowSeconds() - start, nowSeconds() - start, csv, json, true);
+
+    if (csv) fclose(csv);
+    if (json) fclose(json);
+    close(sock);
+    return 0;
+}
@@ -0,0 +1,709 @@
+/**
+ * @file        wiicon_assets.cpp
+ * @brief       Host build step, stand-in server and benchmark for the WiiCon web pages
+ *
+ * @details     build   minifies the pages in data/ (HTML, CSS, JS), gzips them next to the originals
+ *                      (name.gz, uploaded to LittleFS with the rest of data/) and can write
+ *                      web_assets_data.h to embed them in flash with WEB_ASSETS_EMBEDDED.
+ *              serve   serves a data/ folder the way the firmware does (gzip, ETag, Cache-Control,
+ *                      304), or with --raw the way it did before (plain files, no cache headers),
+ *                      optionally throttled to the bandwidth and delay of the softAP link.
+ *              bench   loads a page and its assets repeatedly from the device or the stand-in and
+ *                      reports cold (empty cache) and warm (revalidated) load times and bytes.
+ *
+ *              Build: g++ -std=c++17 -O2 -I.. wiicon_assets.cpp -o wiicon_assets -lz
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */#include <arpa/inet.h>
+#include <dirent.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+volatile sig_atomic_t stopRequested = 0;
+
+void onSignal(int) { stopRequested = 1; }
+
+double nowSeconds() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+struct Options {
+    const char*              command    = nullptr;
+    std::string              data       = "../data";
+    const char*              header     = nullptr;
+    bool                     minify     = true;
+    int                      port       = 8080;
+    const char*              index      = "/wifi_manager.html";
+    bool                     raw        = false;
+    double                   kbps       = 0.0;
+    double                   delayMs    = 0.0;
+    double                   duration   = 0.0;
+    const char*              host       = nullptr;
+    const char*              hostPort   = "80";
+    std::vector<std::string> paths;
+    int                      runs       = 20;
+};
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s build [--data DIR] [--header FILE] [--no-minify]\n"
+            "       %s serve [--data DIR] [--port N] [--index PATH] [--raw] [--kbps N] [--delay-ms MS]\n"
+            "       %s bench --connect HOST[:PORT] [--path PATH]... [--runs N]\n"
+            "  --data DIR        folder with the pages (default ../data)\n"
+            "  --header FILE     also write the gzipped pages as a C++ header (web_assets_data.h)\n"
+            "  --no-minify       gzip the pages unchanged\n"
+            "  --port N          port to serve on (default 8080)\n"
+            "  --index PATH      page served for / (default /wifi_manager.html)\n"
+            "  --raw             serve plain files without cache headers, like firmware before the build step\n"
+            "  --kbps N          throttle responses to N kilobytes per second (default: unlimited)\n"
+            "  --delay-ms MS     wait MS before answering each request\n"
+            "  --duration SEC    stop serving after this many seconds (default: run until Ctrl+C)\n"
+            "  --connect HOST[:PORT] device or stand-in server (port default 80)\n"
+            "  --path PATH       resource of one page load, repeatable (default / and /style.css)\n"
+            "  --runs N          page loads per measurement (default 20)\n",
+            argv0, argv0, argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options* options) {
+    if (argc < 2) return false;
+    options->command = argv[1];
+
+    for (int i = 2; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--data") && hasValue) {
+            options->data = argv[++i];
+        } else if (!strcmp(argv[i], "--header") && hasValue) {
+            options->header = argv[++i];
+        } else if (!strcmp(argv[i], "--no-minify")) {
+            options->minify = false;
+        } else if (!strcmp(argv[i], "--port") && hasValue) {
+            options->port = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--index") && hasValue) {
+            options->index = argv[++i];
+        } else if (!strcmp(argv[i], "--raw")) {
+            options->raw = true;
+        } else if (!strcmp(argv[i], "--kbps") && hasValue) {
+            options->kbps = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--delay-ms") && hasValue) {
+            options->delayMs = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--duration") && hasValue) {
+            options->duration = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--connect") && hasValue) {
+            char* target  = argv[++i];
+            char* colon   = strrchr(target, ':');
+            options->host = target;
+            if (colon) {
+                *colon            = '\0';
+                options->hostPort = colon + 1;
+            }
+        } else if (!strcmp(argv[i], "--path") && hasValue) {
+            options->paths.push_back(argv[++i]);
+        } else if (!strcmp(argv[i], "--runs") && hasValue) {
+            options->runs = atoi(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+
+    if (options->paths.empty()) options->paths = {"/", "/style.css"};
+    if (!strcmp(options->command, "bench")) return options->host != nullptr && options->runs > 0;
+    return !strcmp(options->command, "build") || !strcmp(options->command, "serve");
+}
+
+bool readFile(const std::string& path, std::string* content) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+
+    char   chunk[4096];
+    size_t length;
+    content->clear();
+    while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0) content->append(chunk, length);
+    fclose(file);
+    return true;
+}
+
+bool writeFile(const std::string& path, const std::string& content) {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) return false;
+    bool written = fwrite(content.data(), 1, content.size(), file) == content.size();
+    return fclose(file) == 0 && written;
+}
+
+bool endsWith(const std::string& value, const char* suffix) {
+    size_t length = strlen(suffix);
+    return value.size() >= length && value.compare(value.size() - length, length, suffix) == 0;
+}
+
+/**
+ * Content type from the extension, the same table as the firmware (web_assets.cpp)
+ */
+const char* contentType(const std::string& path) {
+    if (endsWith(path, ".html")) return "text/html";
+    if (endsWith(path, ".css")) return "text/css";
+    if (endsWith(path, ".js")) return "application/javascript";
+    if (endsWith(path, ".json")) return "application/json";
+    return "text/plain";
+}
+
+/**
+ * Quoted FNV-1a hash, the ETag the firmware computes for the same bytes
+ */
+std::string etagOf(const std::string& content) {
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : content) hash = (hash ^ c) * 16777619u;
+
+    char etag[12];
+    snprintf(etag, sizeof(etag), "\"%08x\"", hash);
+    return etag;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Minification. Conservative on purpose: only comments and layout whitespace are removed, strings are kept verbatim.
+
+/**
+ * Copy a quoted string starting at position i, including the quotes
+ * @return Position after the closing quote
+ */
+size_t copyQuoted(const std::string& in, size_t i, std::string* out) {
+    char quote = in[i];
+    out->push_back(in[i++]);
+    while (i < in.size() && in[i] != quote) {
+        if (in[i] == '\\' && i + 1 < in.size()) out->push_back(in[i++]);
+        out->push_back(in[i++]);
+    }
+    if (i < in.size()) out->push_back(in[i++]);
+    return i;
+}
+
+std::string minifyCss(const std::string& in) {
+    std::string out;
+    bool        space = false;
+
+    for (size_t i = 0; i < in.size();) {
+        char c = in[i];
+
+        if (c == '/' && i + 1 < in.size() && in[i + 1] == '*') {
+            size_t end = in.find("*/", i + 2);
+            i          = end == std::string::npos ? in.size() : end + 2;
+            continue;
+        }
+        if (isspace((unsigned char)c)) {
+            space = true;
+            ++i;
+            continue;
+        }
+
+        // A space only matters between two words, e.g. "0 auto" or ".card .logo"
+        bool punctuation = strchr("{};,>", c) != nullptr;
+        if (space && !out.empty() && !punctuation && !strchr("{};,>:", out.back())) out.push_back(' ');
+        space = false;
+
+        if (c == '}' && !out.empty() && out.back() == ';') out.pop_back();
+        if (c == '"' || c == '\'') {
+            i = copyQuoted(in, i, &out);
+        } else {
+            out.push_back(c);
+            ++i;
+        }
+    }
+    return out;
+}
+
+/**
+ * Strip indentation, blank lines and whole-line // comments, line breaks are kept for automatic semicolons
+ */
+std::string minifyJs(const std::string& in) {
+    std::string out;
+    size_t      start = 0;
+
+    while (start < in.size()) {
+        size_t end  = in.find('\n', start);
+        size_t stop = end == std::string::npos ? in.size() : end;
+
+        size_t first = in.find_first_not_of(" \t\r", start);
+        if (first != std::string::npos && first < stop) {
+            size_t last = in.find_last_not_of(" \t\r", stop - 1);
+            if (in.compare(first, 2, "//") != 0) {
+                out.append(in, first, last - first + 1);
+                out.push_back('\n');
+            }
+        }
+        start = stop + 1;
+    }
+    if (!out.empty()) out.pop_back();
+    return out;
+}
+
+std::string minifyHtml(const std::string& in) {
+    std::string out;
+
+    for (size_t i = 0; i < in.size();) {
+        if (in.compare(i, 4, "<!--") == 0) {
+            size_t end = in.find("-->", i + 4);
+            i          = end == std::string::npos ? in.size() : end + 3;
+            continue;
+        }
+
+        if (in[i] == '<') {
+            // Inside a tag, attribute values are copied as they are and other whitespace becomes one space
+            size_t tagStart = out.size();
+            bool   space    = false;
+            while (i < in.size() && in[i] != '>') {
+                char c = in[i];
+                if (c == '"' || c == '\'') {
+                    if (space) out.push_back(' ');
+                    space = false;
+                    i     = copyQuoted(in, i, &out);
+                } else if (isspace((unsigned char)c)) {
+                    space = true;
+                    ++i;
+                } else {
+                    if (space && c != '/' && out.back() != '=') out.push_back(' ');
+                    space = false;
+                    out.push_back(c);
+                    ++i;
+                }
+            }
+            if (i < in.size()) out.push_back(in[i++]);
+
+            // Script and style bodies go through their own minifier
+            std::string tag = out.substr(tagStart);
+            for (const char* name : {"script", "style"}) {
+                if (tag.compare(1, strlen(name), name) != 0) continue;
+
+                std::string close = std::string("</") + name;
+                size_t      end   = in.find(close, i);
+                if (end == std::string::npos) end = in.size();
+
+                std::string body = in.substr(i, end - i);
+                out += !strcmp(name, "script") ? minifyJs(body) : minifyCss(body);
+                i = end;
+            }
+            continue;
+        }
+
+        // Text: indentation between tags disappears, other runs of whitespace become one space
+        size_t end  = in.find('<', i);
+        if (end == std::string::npos) end = in.size();
+        std::string text = in.substr(i, end - i);
+        i                = end;
+
+        if (text.find_first_not_of(" \t\r\n") == std::string::npos) {
+            if (text.find('\n') == std::string::npos && !text.empty()) out.push_back(' ');
+            continue;
+        }
+
+        bool space = false;
+        for (char c : text) {
+            if (isspace((unsigned char)c)) {
+                space = true;
+                continue;
+            }
+            if (space) out.push_back(' ');
+            space = false;
+            out.push_back(c);
+        }
+        if (space) out.push_back(' ');
+    }
+    return out;
+}
+
+bool gzip(const std::string& in, std::string* out) {
+    z_stream stream{};
+    // 15 window bits plus 16 for a gzip header, zlib leaves its timestamp at zero so the output is reproducible
+    if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) return false;
+
+    out->resize(deflateBound(&stream, in.size()) + 32);
+    stream.next_in   = (Bytef*)in.data();
+    stream.avail_in  = (uInt)in.size();
+    stream.next_out  = (Bytef*)&(*out)[0];
+    stream.avail_out = (uInt)out->size();
+
+    int result = deflate(&stream, Z_FINISH);
+    out->resize(stream.total_out);
+    deflateEnd(&stream);
+    return result == Z_STREAM_END;
+}
+
+int build(const Options& options) {
+    DIR* dir = opendir(options.data.c_str());
+    if (!dir) {
+        fprintf(stderr, "Cannot open %s\n", options.data.c_str());
+        return 1;
+    }
+
+    std::vector<std::string> names;
+    while (dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (endsWith(name, ".html") || endsWith(name, ".css") || endsWith(name, ".js")) names.push_back(name);
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+
+    std::string header =
+        "// Generated by tools/wiicon_assets build, do not edit\n"
+        "#ifndef WEB_ASSETS_DATA_H\n#define WEB_ASSETS_DATA_H\n\n#include \"web_assets.h\"\n\n";
+    std::string table = "static const WebAsset WEB_ASSETS[] = {\n";
+
+    size_t totalIn = 0, totalOut = 0;
+    for (size_t n = 0; n < names.size(); ++n) {
+        const std::string& name = names[n];
+        std::string        path = options.data + "/" + name;
+        std::string        content, minified, compressed;
+
+        if (!readFile(path, &content)) {
+            fprintf(stderr, "Cannot read %s\n", path.c_str());
+            return 1;
+        }
+
+        minified = content;
+        if (options.minify) {
+            if (endsWith(name, ".html")) minified = minifyHtml(content);
+            if (endsWith(name, ".css")) minified = minifyCss(content);
+            if (endsWith(name, ".js")) minified = minifyJs(content);
+        }
+
+        if (!gzip(minified, &compressed) || !writeFile(path + ".gz", compressed)) {
+            fprintf(stderr, "Cannot write %s.gz\n", path.c_str());
+            return 1;
+        }
+
+        printf("%-24s %7zu -> %7zu minified -> %6zu gzip (%4.1f%%)\n", name.c_str(), content.size(), minified.size(),
+               compressed.size(), 100.0 * compressed.size() / content.size());
+        totalIn += content.size();
+        totalOut += compressed.size();
+
+        char line[160];
+        header += "static const uint8_t WEB_ASSET_" + std::to_string(n) + "[] = {";
+        for (size_t i = 0; i < compressed.size(); ++i) {
+            snprintf(line, sizeof(line), "%s0x%02x,", i % 16 == 0 ? "\n    " : " ", (uint8_t)compressed[i]);
+            header += line;
+        }
+        header += "\n};\n\n";
+
+        std::string etag = etagOf(compressed);
+        snprintf(line, sizeof(line), "    {\"/%s\", \"%s\", \"\\\"%s\\\"\", WEB_ASSET_%zu, sizeof(WEB_ASSET_%zu)},\n",
+                 name.c_str(), contentType(name), etag.substr(1, etag.size() - 2).c_str(), n, n);
+        table += line;
+    }
+    table += "};\n\n#endif  // WEB_ASSETS_DATA_H\n";
+
+    printf("%zu files, %zu -> %zu bytes\n", names.size(), totalIn, totalOut);
+
+    if (options.header) {
+        if (!writeFile(options.header, header + table)) {
+            fprintf(stderr, "Cannot write %s\n", options.header);
+            return 1;
+        }
+        printf("Wrote %s\n", options.header);
+    }
+    return 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Stand-in server
+
+bool sendAll(int fd, const char* data, size_t length) {
+    while (length > 0) {
+        ssize_t sent = send(fd, data, length, MSG_NOSIGNAL);
+        if (sent <= 0) return false;
+        data += sent;
+        length -= (size_t)sent;
+    }
+    return true;
+}
+
+/**
+ * Value of a request header, empty if absent (names compared without case)
+ */
+std::string headerValue(const std::string& request, const char* name) {
+    size_t length = strlen(name);
+    size_t line   = request.find("\r\n");
+
+    while (line != std::string::npos && line + 2 < request.size()) {
+        size_t start = line + 2;
+        size_t end   = request.find("\r\n", start);
+        if (end == std::string::npos) end = request.size();
+
+        if (end - start > length && request[start + length] == ':' &&
+            strncasecmp(request.c_str() + start, name, length) == 0) {
+            size_t value = request.find_first_not_of(' ', start + length + 1);
+            return value < end ? request.substr(value, end - value) : "";
+        }
+        line = end;
+    }
+    return "";
+}
+
+void answer(int fd, const Options& options) {
+    std::string request;
+    char        chunk[2048];
+
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < 16384) {
+        pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 2000) <= 0) return;
+        ssize_t length = recv(fd, chunk, sizeof(chunk), 0);
+        if (length <= 0) return;
+        request.append(chunk, (size_t)length);
+    }
+
+    char method[16], target[512];
+    if (sscanf(request.c_str(), "%15s %511s", method, target) != 2) return;
+
+    std::string path = target;
+    if (path.find('?') != std::string::npos) path.resize(path.find('?'));
+    if (path == "/") path = options.index;
+
+    if (options.delayMs > 0.0) std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(options.delayMs));
+
+    std::string file = options.data + path;
+    std::string body, response;
+    bool        found = path.find("..") == std::string::npos && path.back() != '/';
+    bool        gzipped = false;
+
+    if (found && !options.raw && headerValue(request, "Accept-Encoding").find("gzip") != std::string::npos) {
+        gzipped = readFile(file + ".gz", &body);
+    }
+    if (found && !gzipped) found = readFile(file, &body);
+
+    if (!found) {
+        response = "HTTP/1.1 404 Not Found\r\nContent-Type: text/plain\r\nContent-Length: 9\r\nConnection: close\r\n\r\n"
+                   "Not found";
+    } else if (options.raw) {
+        response = "HTTP/1.1 200 OK\r\nContent-Type: " + std::string(contentType(path)) +
+                   "\r\nContent-Length: " + std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+    } else {
+        std::string etag  = etagOf(body);
+        std::string cache = endsWith(path, ".html") ? "no-cache" : "max-age=86400";
+        std::string common = "Cache-Control: " + cache + "\r\nETag: " + etag + "\r\nVary: Accept-Encoding\r\n";
+
+        if (headerValue(request, "If-None-Match") == etag) {
+            response = "HTTP/1.1 304 Not Modified\r\n" + common + "Connection: close\r\n\r\n";
+        } else {
+            response = "HTTP/1.1 200 OK\r\nContent-Type: " + std::string(contentType(path)) + "\r\n" + common +
+                       (gzipped ? "Content-Encoding: gzip\r\n" : "") + "Content-Length: " +
+                       std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+        }
+    }
+
+    // Throttled in 512-byte slices, roughly how a busy softAP link delivers
+    size_t slice = options.kbps > 0.0 ? 512 : response.size();
+    for (size_t sent = 0; sent < response.size(); sent += slice) {
+        size_t length = std::min(slice, response.size() - sent);
+        if (!sendAll(fd, response.data() + sent, length)) return;
+        if (options.kbps > 0.0) {
+            std::this_thread::sleep_for(std::chrono::duration<double>(length / (options.kbps * 1000.0)));
+        }
+    }
+}
+
+int serve(const Options& options) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    sockaddr_in address{};
+    address.sin_family      = AF_INET;
+    address.sin_port        = htons((uint16_t)options.port);
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+
+    if (bind(fd, (sockaddr*)&address, sizeof(address)) < 0 || listen(fd, 16) < 0) {
+        fprintf(stderr, "Cannot listen on port %d\n", options.port);
+        close(fd);
+        return 1;
+    }
+
+    printf("Serving %s on port %d (%s%s)\n", options.data.c_str(), options.port,
+           options.raw ? "raw files" : "gzip, ETag, Cache-Control", options.kbps > 0.0 ? ", throttled" : "");
+    fflush(stdout);
+
+    double start = nowSeconds();
+    while (!stopRequested) {
+        if (options.duration > 0.0 && nowSeconds() - start >= options.duration) break;
+
+        pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 100) <= 0) continue;
+
+        int client = accept(fd, nullptr, nullptr);
+        if (client < 0) continue;
+        answer(client, options);
+        close(client);
+    }
+
+    close(fd);
+    return 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Benchmark
+
+int connectTo(const char* host, const char* port) {
+    addrinfo hints{};
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* results = nullptr;
+    if (getaddrinfo(host, port, &hints, &results) != 0) return -1;
+
+    int fd = -1;
+    for (addrinfo* result = results; result && fd < 0; result = result->ai_next) {
+        fd = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+        if (fd < 0) continue;
+        if (connect(fd, result->ai_addr, result->ai_addrlen) < 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(results);
+
+    if (fd >= 0) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return fd;
+}
+
+struct Fetch {
+    int         status = 0; /**< HTTP status, 0 if the request failed */
+    size_t      bytes  = 0; /**< Bytes received, headers included */
+    std::string etag;       /**< ETag of the response */
+};
+
+/**
+ * One request on a new connection, as a browser without keep-alive would make it
+ */
+Fetch fetch(const Options& options, const std::string& path, const std::string& etag) {
+    Fetch result;
+    int   fd = connectTo(options.host, options.hostPort);
+    if (fd < 0) return result;
+
+    std::string request = "GET " + path + " HTTP/1.1\r\nHost: " + options.host +
+                          "\r\nAccept-Encoding: gzip, deflate\r\nConnection: close\r\n";
+    if (!etag.empty()) request += "If-None-Match: " + etag + "\r\n";
+    request += "\r\n";
+
+    std::string response;
+    if (sendAll(fd, request.data(), request.size())) {
+        char chunk[4096];
+        while (true) {
+            pollfd pfd = {fd, POLLIN, 0};
+            if (poll(&pfd, 1, 5000) <= 0) break;
+            ssize_t length = recv(fd, chunk, sizeof(chunk), 0);
+            if (length <= 0) break;
+            response.append(chunk, (size_t)length);
+        }
+    }
+    close(fd);
+
+    result.bytes = response.size();
+    sscanf(response.c_str(), "HTTP/%*s %d", &result.status);
+    result.etag = headerValue(response, "ETag");
+    return result;
+}
+
+double percentile(std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t index = (size_t)std::min(sorted.size() - 1.0, std::floor(p * (sorted.size() - 1) + 0.5));
+    return sorted[index];
+}
+
+int bench(const Options& options) {
+    std::vector<std::string> etags(options.paths.size());
+    bool                     failed = false;
+
+    // Cold loads have an empty cache, warm loads revalidate with the ETags of the cold load
+    for (bool warm : {false, true}) {
+        std::vector<double> times;
+        size_t              bytes = 0, requests = 0, notModified = 0;
+
+        for (int run = 0; run < options.runs && !stopRequested; ++run) {
+            double start = nowSeconds();
+            for (size_t i = 0; i < options.paths.size(); ++i) {
+                Fetch result = fetch(options, options.paths[i], warm ? etags[i] : "");
+                if (result.status != 200 && result.status != 304) {
+                    fprintf(stderr, "GET %s failed (status %d)\n", options.paths[i].c_str(), result.status);
+                    failed = true;
+                }
+                if (!warm) etags[i] = result.etag;
+                if (result.status == 304) notModified++;
+                bytes += result.bytes;
+                requests++;
+            }
+            times.push_back((nowSeconds() - start) * 1000.0);
+        }
+        if (times.empty()) break;
+
+        double sum = 0.0;
+        for (double time : times) sum += time;
+        std::sort(times.begin(), times.end());
+
+        printf("%s  %zu loads  %6.0f B/load  %zu/%zu not modified  ms mean %.2f p50 %.2f p95 %.2f max %.2f\n",
+               warm ? "warm" : "cold", times.size(), (double)bytes / times.size(), notModified, requests,
+               sum / times.size(), percentile(times, 0.50), percentile(times, 0.95), times.back());
+    }
+    return failed ? 1 : 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    if (!strcmp(options.command, "build")) return build(options);
+    if (!strcmp(options.command, "serve")) return serve(options);
+    return bench(options);
+}
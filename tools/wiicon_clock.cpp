@@ -0,0 +1,208 @@
+/**
+ * @file        wiicon_clock.cpp
+ * @brief       Host reference for the WiiCon clock synchronisation
+ *
+ * @details     Answers /wiicon/sync/ping messages (wiicon_clock.h) with the host receive
+ *              and transmit times, so controllers can express their timestamps in this
+ *              host's clock (Unix microseconds). Run one instance per network; controllers
+ *              lock onto the first host that answers. Other datagrams are ignored.
+ *
+ *              For testing, the reply can be held back after it is stamped, which adds
+ *              delay to the return path only (asymmetric delay).
+ *
+ *              Build: g++ -std=c++17 -O2 -I.. wiicon_clock.cpp -o wiicon_clock
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+
+#include "wiicon_clock.h"
+
+namespace {
+
+struct Options {
+    uint16_t    listenPort = 9000;
+    const char* group      = nullptr;
+    double      delayOut   = 0.0;
+    double      jitterOut  = 0.0;
+    double      duration   = 0.0;
+    bool        quiet      = false;
+};
+
+volatile sig_atomic_t stopRequested = 0;
+
+void onSignal(int) { stopRequested = 1; }
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s [--listen PORT] [--group ADDR] [--delay-out MS] [--jitter-out MS] [--duration SEC] [--quiet]\n"
+            "  --listen PORT     UDP port the WiiCon sends to (default 9000)\n"
+            "  --group ADDR      multicast group to join (e.g. 239.255.0.90)\n"
+            "  --delay-out MS    hold each reply after stamping it, for testing (default 0)\n"
+            "  --jitter-out MS   add a random hold of up to MS, for testing (default 0)\n"
+            "  --duration SEC    stop after SEC seconds (default: run until interrupted)\n"
+            "  --quiet           do not print each exchange\n",
+            argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--listen") && hasValue) {
+            options->listenPort = (uint16_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--group") && hasValue) {
+            options->group = argv[++i];
+        } else if (!strcmp(argv[i], "--delay-out") && hasValue) {
+            options->delayOut = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--jitter-out") && hasValue) {
+            options->jitterOut = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--duration") && hasValue) {
+            options->duration = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--quiet")) {
+            options->quiet = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Host time in microseconds since the Unix epoch
+ */
+int64_t hostMicros() {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    int reuse = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr{};
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port        = htons(options.listenPort);
+    if (bind(sock, (sockaddr*)&addr, sizeof(addr)) < 0) {
+        perror("bind");
+        return 1;
+    }
+
+    if (options.group) {
+        ip_mreq mreq{};
+        mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+        if (inet_pton(AF_INET, options.group, &mreq.imr_multiaddr) != 1 ||
+            setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+            fprintf(stderr, "Failed to join multicast group %s\n", options.group);
+            return 1;
+        }
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    printf("Answering clock sync on UDP :%u%s%s\n", options.listenPort, options.group ? " group " : "",
+           options.group ? options.group : "");
+
+    std::mt19937                           rng(std::random_device{}());
+    std::uniform_real_distribution<double> jitter(0.0, options.jitterOut);
+    uint8_t                                packet[1500];
+    uint8_t                                pong[CLOCK_MAX_SIZE];
+    uint64_t                               answered = 0;
+    auto                                   start    = std::chrono::steady_clock::now();
+
+    while (!stopRequested) {
+        if (options.duration > 0.0 &&
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() >= options.duration) {
+            break;
+        }
+
+        pollfd pfd = {sock, POLLIN, 0};
+        if (poll(&pfd, 1, 50) <= 0) continue;
+
+        sockaddr_in from{};
+        socklen_t   fromLength = sizeof(from);
+        ssize_t     length     = recvfrom(sock, packet, sizeof(packet), 0, (sockaddr*)&from, &fromLength);
+        int64_t     received   = hostMicros();
+        if (length <= 0) continue;
+
+        ClockExchange exchange;
+        if (!clockPingDecode(packet, (size_t)length, &exchange)) continue;
+
+        exchange.t2 = received;
+        exchange.t3 = hostMicros();
+
+        size_t pongLength = clockPongEncode(exchange, pong);
+
+        // Held after stamping t3, so the delay only affects the return path
+        double hold = options.delayOut + (options.jitterOut > 0.0 ? jitter(rng) : 0.0);
+        if (hold > 0.0) std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(hold));
+
+        sendto(sock, pong, pongLength, 0, (sockaddr*)&from, fromLength);
+        answered++;
+
+        if (!options.quiet) {
+            char source[INET_ADDRSTRLEN];
+            inet_ntop(AF_INET, &from.sin_addr, source, sizeof(source));
+            printf("device %u@%s  ping #%u\n", exchange.deviceId, source, exchange.sequence);
+            fflush(stdout);
+        }
+    }
+
+    printf("Answered %llu pings\n", (unsigned long long)answered);
+    close(sock);
+    return 0;
+}
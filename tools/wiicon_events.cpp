@@ -0,0 +1,279 @@
+/**
+ * @file        wiicon_events.cpp
+ * @brief       Host peer for the WiiCon reliable event channel
+ *
+ * @details     Receives /wiicon/event messages (wiicon_event.h), acknowledges each one to
+ *              the sender and delivers every event exactly once, even when the device had to
+ *              retransmit it. New events are printed and can be republished to a local OSC
+ *              port. Other datagrams are ignored, so the peer can share a multicast group with
+ *              the relay and the analyzer.
+ *
+ *              Build: g++ -std=c++17 -O2 -I.. wiicon_events.cpp -o wiicon_events
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+
+#include "wiicon_event.h"
+
+namespace {
+
+struct Options {
+    uint16_t    listenPort  = 9000;
+    const char* group       = nullptr;
+    const char* forwardHost = nullptr;
+    uint16_t    forwardPort = 0;
+    double      duration    = 0.0;
+    double      ackLoss     = 0.0;
+    bool        quiet       = false;
+};
+
+volatile sig_atomic_t stopRequested = 0;
+
+void onSignal(int) { stopRequested = 1; }
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s [--listen PORT] [--group ADDR] [--forward HOST:PORT] [--duration SEC] [--ack-loss P]\n"
+            "          [--quiet]\n"
+            "  --listen PORT       UDP port the WiiCon sends to (default 9000)\n"
+            "  --group ADDR        multicast group to join (e.g. 239.255.0.90)\n"
+            "  --forward HOST:PORT republish each new event once as OSC\n"
+            "  --duration SEC      stop after SEC seconds (default: run until interrupted)\n"
+            "  --ack-loss P        probability of dropping an acknowledgement, for testing (default 0)\n"
+            "  --quiet             do not print each event\n",
+            argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--listen") && hasValue) {
+            options->listenPort = (uint16_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--group") && hasValue) {
+            options->group = argv[++i];
+        } else if (!strcmp(argv[i], "--forward") && hasValue) {
+            char* target = argv[++i];
+            char* colon  = strrchr(target, ':');
+            if (!colon) return false;
+            *colon               = '\0';
+            options->forwardHost = target;
+            options->forwardPort = (uint16_t)atoi(colon + 1);
+        } else if (!strcmp(argv[i], "--duration") && hasValue) {
+            options->duration = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--ack-loss") && hasValue) {
+            options->ackLoss = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--quiet")) {
+            options->quiet = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Duplicate filter for one device session
+ * Remembers the last 64 sequence numbers, older retransmissions are treated as duplicates.
+ */
+struct SessionWindow {
+    bool     started = false;
+    uint16_t highest = 0;
+    uint64_t seen    = 0; /**< Bit i set when sequence (highest - i) was delivered */
+
+    /**
+     * Record a sequence number
+     * @return true if the sequence number is new
+     */
+    bool accept(uint16_t sequence) {
+        if (!started) {
+            started = true;
+            highest = sequence;
+            seen    = 1;
+            return true;
+        }
+
+        int16_t delta = (int16_t)(sequence - highest);
+        if (delta > 0) {
+            seen    = delta >= 64 ? 0 : seen << delta;
+            seen   |= 1;
+            highest = sequence;
+            return true;
+        }
+
+        if (-delta >= 64 || (seen & (1ull << -delta))) return false;
+        seen |= 1ull << -delta;
+        return true;
+    }
+};
+
+const char* typeName(uint8_t type) {
+    switch (type) {
+        case EVENT_MODE:
+            return "mode";
+        case EVENT_BUTTON:
+            return "button";
+        case EVENT_GESTURE:
+            return "gesture";
+        default:
+            return "unknown";
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    int reuse = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr{};
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port        = htons(options.listenPort);
+    if (bind(sock, (sockaddr*)&addr, sizeof(addr)) < 0) {
+        perror("bind");
+        return 1;
+    }
+
+    if (options.group) {
+        ip_mreq mreq{};
+        mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+        if (inet_pton(AF_INET, options.group, &mreq.imr_multiaddr) != 1 ||
+            setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+            fprintf(stderr, "Failed to join multicast group %s\n", options.group);
+            return 1;
+        }
+    }
+
+    sockaddr_in forwardAddr{};
+    if (options.forwardHost) {
+        forwardAddr.sin_family = AF_INET;
+        forwardAddr.sin_port   = htons(options.forwardPort);
+        if (inet_pton(AF_INET, options.forwardHost, &forwardAddr.sin_addr) != 1) {
+            fprintf(stderr, "Invalid forward address: %s\n", options.forwardHost);
+            return 1;
+        }
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    printf("Acknowledging events on UDP :%u%s%s\n", options.listenPort, options.group ? " group " : "",
+           options.group ? options.group : "");
+
+    using clock = std::chrono::steady_clock;
+
+    std::mt19937                           rng(std::random_device{}());
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    std::map<uint64_t, SessionWindow>      sessions;
+    uint8_t                                packet[1500];
+    uint8_t                                ack[EVENT_MAX_SIZE];
+    uint64_t                               delivered  = 0;
+    uint64_t                               duplicates = 0;
+    uint64_t                               acksSent   = 0;
+    uint64_t                               acksLost   = 0;
+    auto                                   start      = clock::now();
+
+    while (!stopRequested) {
+        if (options.duration > 0.0 &&
+            std::chrono::duration<double>(clock::now() - start).count() >= options.duration) {
+            break;
+        }
+
+        pollfd pfd = {sock, POLLIN, 0};
+        if (poll(&pfd, 1, 50) <= 0) continue;
+
+        sockaddr_in from{};
+        socklen_t   fromLength = sizeof(from);
+        ssize_t     length     = recvfrom(sock, packet, sizeof(packet), 0, (sockaddr*)&from, &fromLength);
+        if (length <= 0) continue;
+
+        WiiconEvent event;
+        if (!eventDecode(packet, (size_t)length, &event)) continue;
+
+        // Acknowledge every copy, the previous acknowledgement may have been lost
+        if (chance(rng) < options.ackLoss) {
+            acksLost++;
+        } else {
+            size_t ackLength = eventAckEncode(event, ack);
+            sendto(sock, ack, ackLength, 0, (sockaddr*)&from, fromLength);
+            acksSent++;
+        }
+
+        uint64_t key = ((uint64_t)event.deviceId << 32) | event.session;
+        if (!sessions[key].accept(event.sequence)) {
+            duplicates++;
+            continue;
+        }
+
+        delivered++;
+        if (!options.quiet) {
+            char source[INET_ADDRSTRLEN];
+            inet_ntop(AF_INET, &from.sin_addr, source, sizeof(source));
+            printf("device %u@%s  #%u  %s %d\n", event.deviceId, source, event.sequence, typeName(event.type),
+                   event.value);
+            fflush(stdout);
+        }
+
+        if (options.forwardHost) {
+            sendto(sock, packet, (size_t)length, 0, (sockaddr*)&forwardAddr, sizeof(forwardAddr));
+        }
+    }
+
+    printf("Delivered %llu events (%llu duplicates dropped), %llu acks sent, %llu acks dropped\n",
+           (unsigned long long)delivered, (unsigned long long)duplicates, (unsigned long long)acksSent,
+           (unsigned long long)acksLost);
+    close(sock);
+    return 0;
+}
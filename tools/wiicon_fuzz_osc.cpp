@@ -0,0 +1,366 @@
+/**
+ * @file        wiicon_fuzz_osc.cpp
+ * @brief       Fuzz target for the OSC parser and the receiver dispatch
+ *
+ * @details     Covers the OSC receive path: oscParseMessage(), every OscArgReader
+ *              accessor, and the receiver's dispatch table with its handlers, fed the same
+ *              way the receive loop gets a datagram. Build it with libFuzzer, or standalone
+ *              with any compiler, where it mutates a seed message for each route and also
+ *              replays files given on the command line (for AFL++ with @@). Run it under
+ *              AddressSanitizer and UndefinedBehaviorSanitizer so a bounds or conversion bug
+ *              aborts instead of passing unnoticed.
+ *
+ *              Flags: -std=c++20 -g -O1 -Wall -Wextra -Ihost -I..
+ *                     -fsanitize=address,undefined,float-cast-overflow
+ *              libFuzzer: clang++ <flags> -fsanitize=fuzzer -DWIICON_LIBFUZZER <sources>
+ *              Standalone: g++ <flags> <sources>
+ *              Sources: wiicon_fuzz_osc.cpp host/firmware_fakes.cpp ../osc_receiver.cpp
+ *                       ../settings_registry.cpp ../osc_manager.cpp ../rate_controller.cpp
+ *                       ../udp_transport.cpp ../serial_link.cpp ../websocket_transport.cpp
+ *                       ../boot_profiler.cpp ../logger.cpp
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "osc_receiver.h"
+#include "profile_manager.h"
+#include "settings_registry.h"
+
+// ----------------------------------------------------------------------------
+// Firmware state the handlers reach, without the modules that own it
+// ----------------------------------------------------------------------------
+
+DataMode       dataMode         = DataMode::FILTERED;
+unsigned long  sampleIntervalUs = 0;
+volatile float beta             = FILTER_BETA;
+float          sampleFreq       = 100.0f;
+bool           swapRollYaw      = false;
+int            accelMap[3]      = {0, 1, 2};
+int            accelSign[3]     = {1, 1, 1};
+int            gyroMap[3]       = {0, 1, 2};
+int            gyroSign[3]      = {1, 1, 1};
+
+void actionSetSampleRate(float) {}
+void actionSetDataMode(DataMode mode) { dataMode = mode; }
+void actionSetFilterGain(float) {}
+void printJsonString(Print&, const char*) {}
+
+ProfileManager& profileManager = ProfileManager::instance();
+
+ProfileManager& ProfileManager::instance() {
+    static ProfileManager instance;
+    return instance;
+}
+
+ProfileManager::ProfileManager() : _index(0), _latencyMs(0.0f) {}
+
+int ProfileManager::find(const char* name) {
+    for (size_t i = 0; i < PROFILE_COUNT; ++i) {
+        if (strcmp(PERFORMANCE_PROFILES[i].name, name) == 0) return (int)i;
+    }
+    return -1;
+}
+
+bool ProfileManager::select(const char* name) { return find(name) >= 0; }
+
+// ----------------------------------------------------------------------------
+// Target
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/**
+ * Read every argument of a well-formed message, alternating the accessors that accept the same tags
+ */
+void readArguments(const uint8_t* data, size_t size) {
+    OscMessageView message;
+    if (!oscParseMessage(data, size, &message)) return;
+
+    OscArgReader args(message);
+    for (size_t i = 0; args.remaining() > 0; ++i) {
+        int32_t     integer;
+        int64_t     wide;
+        float       number;
+        const char* text;
+
+        bool read = i % 2 ? args.readFloat(&number) || args.readInt64(&wide) : args.readInt(&integer);
+        read      = read || args.readInt64(&wide) || args.readString(&text);
+        if (!read) break;  // Blob, timetag or another tag no handler reads
+    }
+}
+
+bool setUp() {
+    Log::setLevel(LOG_LEVEL_ERROR);
+
+    // Starts the UDP transport, the receiver waits for it
+    oscManager.sendEulerAngles(0.0f, 0.0f, 0.0f);
+    return oscReceiver.begin();
+}
+
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    static bool ready = setUp();
+    if (!ready) abort();
+
+    readArguments(data, size);
+
+    // The dispatch table and handlers, through the receive loop like a datagram from the network
+    WiFiUDP::hostDeliver(data, size);
+    oscReceiver.loop();
+    return 0;
+}
+
+#ifndef WIICON_LIBFUZZER
+
+// ----------------------------------------------------------------------------
+// Standalone driver
+// ----------------------------------------------------------------------------
+
+namespace {
+
+using Datagram = std::vector<uint8_t>;
+
+/**
+ * Minimal OSC encoder for the seeds
+ */
+struct SeedBuilder {
+    Datagram    args;
+    std::string tags = ",";
+
+    SeedBuilder& i(int32_t value) {
+        tags += 'i';
+        word((uint32_t)value);
+        return *this;
+    }
+
+    SeedBuilder& f(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        tags += 'f';
+        word(bits);
+        return *this;
+    }
+
+    SeedBuilder& s(const char* value) {
+        tags += 's';
+        string(args, value);
+        return *this;
+    }
+
+    Datagram build(const char* address) const {
+        Datagram out;
+        string(out, address);
+        string(out, tags.c_str());
+        out.insert(out.end(), args.begin(), args.end());
+        return out;
+    }
+
+    void word(uint32_t value) {
+        for (int shift = 24; shift >= 0; shift -= 8) args.push_back((uint8_t)(value >> shift));
+    }
+
+    static void string(Datagram& out, const char* value) {
+        size_t length = strlen(value) + 1;
+        out.insert(out.end(), value, value + length);
+        while (out.size() % 4) out.push_back(0);
+    }
+};
+
+std::vector<Datagram> seeds() {
+    const float nan = NAN;
+    const float inf = INFINITY;
+
+    return {
+        SeedBuilder().f(100.0f).build("/wiicon/set/rate"),
+        SeedBuilder().f(1e-30f).build("/wiicon/set/rate"),
+        SeedBuilder().f(nan).build("/wiicon/set/rate"),
+        SeedBuilder().f(0.05f).build("/wiicon/set/beta"),
+        SeedBuilder().s("raw").build("/wiicon/set/mode"),
+        SeedBuilder().f(3e9f).build("/wiicon/set/mode"),
+        SeedBuilder().f(-inf).build("/wiicon/set/mode"),
+        SeedBuilder().f(nan).build("/wiicon/set/mode"),
+        SeedBuilder().i(9001).build("/wiicon/get/status"),
+        SeedBuilder().f(-3e9f).build("/wiicon/get/status"),
+        SeedBuilder().f(0.1f).build("/wiicon/feedback"),
+        SeedBuilder().f(30.0f).build("/wiicon/set/wsrate"),
+        SeedBuilder().s("balanced").build("/wiicon/set/profile"),
+        SeedBuilder().i(9001).build("/wiicon/get/profile"),
+        SeedBuilder().s("beta").f(0.2f).build("/wiicon/set/setting"),
+        SeedBuilder().s("accel_axes").s("+x-z+y").build("/wiicon/set/setting"),
+        SeedBuilder().s("osc_port").i(70000).build("/wiicon/set/setting"),
+        SeedBuilder().s("beta").f(inf).build("/wiicon/get/setting"),
+    };
+}
+
+/**
+ * Change a datagram the ways a broken or hostile sender would
+ */
+void mutate(Datagram& data, std::mt19937& random) {
+    static const uint32_t SPECIAL_WORDS[] = {0x7FC00000, 0x7F800000, 0xFF800000, 0x4F000000, 0xCF000000,
+                                             0x7FFFFFFF, 0x80000000, 0xFFFFFFFF, 0x00000000, 0x00000100};
+    static const char     TAGS[]          = "ifsbhtdSTFNIcrm,\0x";
+
+    int edits = 1 + (int)(random() % 4);
+    for (int e = 0; e < edits; ++e) {
+        size_t at = data.empty() ? 0 : random() % data.size();
+        switch (random() % 7) {
+            case 0:  // Bit flip
+                if (!data.empty()) data[at] ^= (uint8_t)(1u << (random() % 8));
+                break;
+            case 1:  // Another type tag or separator
+                if (!data.empty()) data[at] = (uint8_t)TAGS[random() % (sizeof(TAGS) - 1)];
+                break;
+            case 2:  // A word that is NaN, infinite or outside the int32 range as a float, or an extreme int
+                if (data.size() >= 4) {
+                    uint32_t word = SPECIAL_WORDS[random() % (sizeof(SPECIAL_WORDS) / sizeof(SPECIAL_WORDS[0]))];
+                    at &= ~(size_t)3;
+                    for (int i = 0; i < 4 && at + i < data.size(); ++i) data[at + i] = (uint8_t)(word >> (24 - 8 * i));
+                }
+                break;
+            case 3:  // Truncate
+                data.resize(at);
+                break;
+            case 4:  // Grow by a word of noise
+                for (int i = 0; i < 4; ++i) data.insert(data.begin() + (long)at, (uint8_t)random());
+                break;
+            case 5:  // Drop a word
+                data.erase(data.begin() + (long)at, data.begin() + (long)std::min(at + 4, data.size()));
+                break;
+            default:  // Remove a terminator
+                for (size_t i = at; i < data.size(); ++i) {
+                    if (data[i] == 0) {
+                        data[i] = 'x';
+                        break;
+                    }
+                }
+                break;
+        }
+    }
+}
+
+bool replay(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        return false;
+    }
+
+    Datagram data;
+    uint8_t  buffer[4096];
+    size_t   count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) data.insert(data.end(), buffer, buffer + count);
+    fclose(file);
+
+    LLVMFuzzerTestOneInput(data.data(), data.size());
+    return true;
+}
+
+bool writeCorpus(const char* directory) {
+    std::vector<Datagram> corpus = seeds();
+    for (size_t i = 0; i < corpus.size(); ++i) {
+        std::string path = std::string(directory) + "/seed" + std::to_string(i) + ".osc";
+        FILE*       file = fopen(path.c_str(), "wb");
+        if (!file) {
+            perror(path.c_str());
+            return false;
+        }
+        fwrite(corpus[i].data(), 1, corpus[i].size(), file);
+        fclose(file);
+    }
+    printf("Wrote %zu seeds to %s\n", corpus.size(), directory);
+    return true;
+}
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s [--runs N] [--seed S]\n"
+            "       %s FILE...\n"
+            "       %s --corpus DIR\n"
+            "  --runs N      mutated datagrams to run (default 200000)\n"
+            "  --seed S      random seed (default 1)\n"
+            "  FILE...       run these datagrams once each, e.g. a crash or AFL++ input (@@)\n"
+            "  --corpus DIR  write the seed datagrams to DIR as a starting corpus and exit\n",
+            argv0, argv0, argv0);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    unsigned long runs = 200000;
+    unsigned long seed = 1;
+
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--runs") && hasValue) {
+            runs = strtoul(argv[++i], nullptr, 10);
+        } else if (!strcmp(argv[i], "--seed") && hasValue) {
+            seed = strtoul(argv[++i], nullptr, 10);
+        } else if (!strcmp(argv[i], "--corpus") && hasValue) {
+            return writeCorpus(argv[++i]) ? 0 : 1;
+        } else if (argv[i][0] != '-') {
+            files.push_back(argv[i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (!files.empty()) {
+        for (const char* path : files) {
+            if (!replay(path)) return 1;
+        }
+        return 0;
+    }
+
+    std::vector<Datagram> corpus = seeds();
+    std::mt19937          random((uint32_t)seed);
+
+    for (const Datagram& datagram : corpus) LLVMFuzzerTestOneInput(datagram.data(), datagram.size());
+
+    for (unsigned long run = 0; run < runs; ++run) {
+        Datagram datagram = corpus[random() % corpus.size()];
+        mutate(datagram, random);
+        LLVMFuzzerTestOneInput(datagram.data(), datagram.size());
+    }
+
+    printf("Ran %zu seeds and %lu mutated datagrams, no failure\n", corpus.size(), runs);
+    return 0;
+}
+
+#endif  // WIICON_LIBFUZZER
@@ -0,0 +1,476 @@
+/**
+ * @file        wiicon_mdns.h
+ * @brief       Host-side mDNS / DNS-SD helpers for the WiiCon tools
+ *
+ * @details     Just enough of RFC 1035, 6762 and 6763 to browse for and announce one
+ *              service type: a message parser that follows name compression, an encoder
+ *              for PTR, SRV, TXT and A records, and a browser that collects the answers
+ *              to a query into resolved services. Replaces a system responder (Avahi,
+ *              Bonjour) for the stand-in receiver and the simulator.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ */
+
+#ifndef WIICON_MDNS_H
+#define WIICON_MDNS_H
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+constexpr uint16_t MDNS_PORT    = 5353;
+constexpr char     MDNS_GROUP[] = "224.0.0.251";
+
+constexpr uint16_t DNS_TYPE_A   = 1;
+constexpr uint16_t DNS_TYPE_PTR = 12;
+constexpr uint16_t DNS_TYPE_TXT = 16;
+constexpr uint16_t DNS_TYPE_SRV = 33;
+constexpr uint16_t DNS_TYPE_ANY = 255;
+
+constexpr uint16_t DNS_CLASS_IN    = 1;
+constexpr uint16_t DNS_CLASS_FLUSH = 0x8000; /**< Cache-flush bit of a record class (unique records) */
+constexpr uint16_t DNS_CLASS_QU    = 0x8000; /**< Unicast-response bit of a question class */
+constexpr uint16_t DNS_FLAG_QR     = 0x8000; /**< Response */
+constexpr uint16_t DNS_FLAG_AA     = 0x0400; /**< Authoritative answer */
+
+constexpr size_t DNS_MAX_SIZE = 1500;
+
+struct DnsQuestion {
+    std::string name;
+    uint16_t    type    = 0;
+    bool        unicast = false; /**< QU bit, the asker wants a unicast reply */
+};
+
+struct DnsRecord {
+    std::string              name;
+    uint16_t                 type = 0;
+    uint16_t                 cls  = DNS_CLASS_IN; /**< Class including DNS_CLASS_FLUSH */
+    uint32_t                 ttl  = 0;
+    std::string              target;              /**< PTR and SRV target */
+    uint16_t                 port = 0;            /**< SRV port */
+    uint32_t                 ipv4 = 0;            /**< A address, network order */
+    std::vector<std::string> txt;                 /**< TXT strings, "key=value" */
+};
+
+struct DnsMessage {
+    uint16_t                 id    = 0;
+    uint16_t                 flags = 0;
+    std::vector<DnsQuestion> questions;
+    std::vector<DnsRecord>   records;     /**< Answer, authority and additional sections together */
+    size_t                   answers = 0; /**< Records that came from the answer section */
+};
+
+/**
+ * A service instance resolved from PTR, SRV, TXT and A records
+ */
+struct MdnsService {
+    std::string              instance; /**< Full instance name, "Name._type._udp.local" */
+    std::string              host;     /**< SRV target */
+    uint32_t                 ipv4 = 0; /**< Network order, 0 if no A record was received */
+    uint16_t                 port = 0;
+    uint32_t                 ttl  = 0; /**< PTR TTL, 0 for a goodbye */
+    std::vector<std::string> txt;
+
+    /**
+     * Instance label without the service type
+     */
+    std::string label() const {
+        size_t dot = instance.find("._");
+        return dot == std::string::npos ? instance : instance.substr(0, dot);
+    }
+
+    /**
+     * Look up a TXT entry
+     * @return Value, nullptr if the key is missing
+     */
+    const char* txtValue(const char* key) const {
+        size_t length = strlen(key);
+        for (const std::string& entry : txt) {
+            if (entry.size() >= length && strncasecmp(entry.c_str(), key, length) == 0) {
+                if (entry.size() == length) return "";
+                if (entry[length] == '=') return entry.c_str() + length + 1;
+            }
+        }
+        return nullptr;
+    }
+};
+
+inline bool dnsNameEquals(const std::string& a, const std::string& b) {
+    return a.size() == b.size() && strcasecmp(a.c_str(), b.c_str()) == 0;
+}
+
+namespace dns_detail {
+
+inline uint16_t read16(const uint8_t* p) { return (uint16_t)(p[0] << 8 | p[1]); }
+
+inline uint32_t read32(const uint8_t* p) { return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | p[2] << 8 | p[3]; }
+
+/**
+ * Read a possibly compressed name
+ * @param offset In: start of the name, out: first byte after it in the record
+ * @return false on a malformed name or a pointer loop
+ */
+inline bool readName(const uint8_t* data, size_t length, size_t* offset, std::string* name) {
+    size_t pos   = *offset;
+    bool   moved = false;
+    name->clear();
+
+    for (int jumps = 0; jumps < 32;) {
+        if (pos >= length) return false;
+        uint8_t label = data[pos];
+        if (label == 0) {
+            if (!moved) *offset = pos + 1;
+            return true;
+        }
+        if ((label & 0xC0) == 0xC0) {
+            if (pos + 1 >= length) return false;
+            if (!moved) *offset = pos + 2;
+            moved = true;
+            pos   = (size_t)(label & 0x3F) << 8 | data[pos + 1];
+            jumps++;
+            continue;
+        }
+        if ((label & 0xC0) != 0 || pos + 1 + label > length) return false;
+        if (!name->empty()) name->push_back('.');
+        name->append((const char*)data + pos + 1, label);
+        pos += 1 + label;
+    }
+    return false;
+}
+
+/**
+ * Write a name without compression, which every decoder accepts
+ * Labels are split on dots, so instance labels must not contain one.
+ */
+inline bool writeName(std::vector<uint8_t>& out, const std::string& name) {
+    size_t start = 0;
+    while (start < name.size()) {
+        size_t end = name.find('.', start);
+        if (end == std::string::npos) end = name.size();
+        size_t label = end - start;
+        if (label == 0 || label > 63) return false;
+        out.push_back((uint8_t)label);
+        out.insert(out.end(), name.begin() + start, name.begin() + end);
+        start = end + 1;
+    }
+    out.push_back(0);
+    return true;
+}
+
+inline void write16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back((uint8_t)(value >> 8));
+    out.push_back((uint8_t)value);
+}
+
+inline void write32(std::vector<uint8_t>& out, uint32_t value) {
+    write16(out, (uint16_t)(value >> 16));
+    write16(out, (uint16_t)value);
+}
+
+}  // namespace dns_detail
+
+/**
+ * Parse a DNS message, records of other types are kept with their name, type and TTL only
+ * @return false if the message is malformed
+ */
+inline bool dnsParse(const uint8_t* data, size_t length, DnsMessage* message) {
+    using namespace dns_detail;
+    if (length < 12) return false;
+
+    message->id    = read16(data);
+    message->flags = read16(data + 2);
+    message->questions.clear();
+    message->records.clear();
+
+    size_t questions = read16(data + 4);
+    size_t records   = (size_t)read16(data + 6) + read16(data + 8) + read16(data + 10);
+    message->answers = read16(data + 6);
+    size_t offset    = 12;
+
+    for (size_t i = 0; i < questions; ++i) {
+        DnsQuestion question;
+        if (!readName(data, length, &offset, &question.name) || offset + 4 > length) return false;
+        question.type    = read16(data + offset);
+        question.unicast = (read16(data + offset + 2) & DNS_CLASS_QU) != 0;
+        offset += 4;
+        message->questions.push_back(question);
+    }
+
+    for (size_t i = 0; i < records; ++i) {
+        DnsRecord record;
+        if (!readName(data, length, &offset, &record.name) || offset + 10 > length) return false;
+        record.type     = read16(data + offset);
+        record.cls      = read16(data + offset + 2);
+        record.ttl      = read32(data + offset + 4);
+        size_t rdLength = read16(data + offset + 8);
+        offset += 10;
+        size_t rdEnd = offset + rdLength;
+        if (rdEnd > length) return false;
+
+        size_t rd = offset;
+        switch (record.type) {
+            case DNS_TYPE_PTR:
+                if (!readName(data, length, &rd, &record.target)) return false;
+                break;
+            case DNS_TYPE_SRV:
+                if (rdLength < 7) return false;
+                record.port = read16(data + rd + 4);
+                rd += 6;
+                if (!readName(data, length, &rd, &record.target)) return false;
+                break;
+            case DNS_TYPE_A:
+                if (rdLength != 4) return false;
+                memcpy(&record.ipv4, data + rd, 4);
+                break;
+            case DNS_TYPE_TXT:
+                while (rd < rdEnd) {
+                    size_t entry = data[rd++];
+                    if (rd + entry > rdEnd) return false;
+                    if (entry > 0) record.txt.emplace_back((const char*)data + rd, entry);
+                    rd += entry;
+                }
+                break;
+            default:
+                break;
+        }
+        offset = rdEnd;
+        message->records.push_back(record);
+    }
+    return true;
+}
+
+/**
+ * Encode a DNS message, every record goes in the answer section
+ * @return Encoded length, 0 if a name is invalid or the message does not fit
+ */
+inline size_t dnsEncode(const DnsMessage& message, uint8_t* out, size_t capacity) {
+    using namespace dns_detail;
+    std::vector<uint8_t> buffer;
+    write16(buffer, message.id);
+    write16(buffer, message.flags);
+    write16(buffer, (uint16_t)message.questions.size());
+    write16(buffer, (uint16_t)message.records.size());
+    write16(buffer, 0);
+    write16(buffer, 0);
+
+    for (const DnsQuestion& question : message.questions) {
+        if (!writeName(buffer, question.name)) return 0;
+        write16(buffer, question.type);
+        write16(buffer, (uint16_t)(DNS_CLASS_IN | (question.unicast ? DNS_CLASS_QU : 0)));
+    }
+
+    for (const DnsRecord& record : message.records) {
+        if (!writeName(buffer, record.name)) return 0;
+        write16(buffer, record.type);
+        write16(buffer, record.cls);
+        write32(buffer, record.ttl);
+        size_t lengthAt = buffer.size();
+        write16(buffer, 0);
+        switch (record.type) {
+            case DNS_TYPE_PTR:
+                if (!writeName(buffer, record.target)) return 0;
+                break;
+            case DNS_TYPE_SRV:
+                write16(buffer, 0);  // priority
+                write16(buffer, 0);  // weight
+                write16(buffer, record.port);
+                if (!writeName(buffer, record.target)) return 0;
+                break;
+            case DNS_TYPE_A: {
+                const uint8_t* address = (const uint8_t*)&record.ipv4;
+                buffer.insert(buffer.end(), address, address + 4);
+                break;
+            }
+            case DNS_TYPE_TXT:
+                for (const std::string& entry : record.txt) {
+                    if (entry.size() > 255) return 0;
+                    buffer.push_back((uint8_t)entry.size());
+                    buffer.insert(buffer.end(), entry.begin(), entry.end());
+                }
+                if (record.txt.empty()) buffer.push_back(0);  // a TXT record holds at least one string
+                break;
+            default:
+                break;
+        }
+        size_t rdLength      = buffer.size() - lengthAt - 2;
+        buffer[lengthAt]     = (uint8_t)(rdLength >> 8);
+        buffer[lengthAt + 1] = (uint8_t)rdLength;
+    }
+
+    if (buffer.size() > capacity) return 0;
+    memcpy(out, buffer.data(), buffer.size());
+    return buffer.size();
+}
+
+/**
+ * Open a UDP socket for mDNS
+ * @param port MDNS_PORT for a responder (shared with other responders), 0 for a browser
+ * @param interface Multicast interface, INADDR_ANY for the default route
+ * @return Socket, -1 on failure (errno set)
+ */
+inline int mdnsOpen(uint16_t port, in_addr interface) {
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) return -1;
+
+    int yes = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+#ifdef SO_REUSEPORT
+    setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes));
+#endif
+
+    sockaddr_in local{};
+    local.sin_family      = AF_INET;
+    local.sin_port        = htons(port);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(sock, (sockaddr*)&local, sizeof(local)) < 0) {
+        close(sock);
+        return -1;
+    }
+
+    // Loopback keeps a responder and a browser on the same host visible to each other
+    unsigned char loop = 1;
+    unsigned char ttl  = 255;
+    setsockopt(sock, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+    setsockopt(sock, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+    if (interface.s_addr != htonl(INADDR_ANY)) {
+        setsockopt(sock, IPPROTO_IP, IP_MULTICAST_IF, &interface, sizeof(interface));
+    }
+
+    if (port == MDNS_PORT) {
+        ip_mreq mreq{};
+        mreq.imr_interface = interface;
+        inet_pton(AF_INET, MDNS_GROUP, &mreq.imr_multiaddr);
+        if (setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+            close(sock);
+            return -1;
+        }
+    }
+    return sock;
+}
+
+/**
+ * Address of the mDNS group, or of one host for networks without multicast
+ */
+inline sockaddr_in mdnsAddress(const char* host = MDNS_GROUP) {
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port   = htons(MDNS_PORT);
+    inet_pton(AF_INET, host, &address.sin_addr);
+    return address;
+}
+
+/**
+ * Browses for one service type and resolves the answers
+ * Queries go out from an ephemeral port, so responders answer with legacy unicast replies (RFC 6762 section 6.7)
+ * and no system responder has to give up port 5353.
+ */
+class MdnsBrowser {
+   public:
+    /**
+     * @param serviceType Service type with domain, "_wiicon-sink._udp.local"
+     */
+    explicit MdnsBrowser(std::string serviceType) : _serviceType(std::move(serviceType)) {}
+
+    ~MdnsBrowser() {
+        if (_sock >= 0) close(_sock);
+    }
+
+    /**
+     * Open the socket
+     * @param interface Multicast interface, INADDR_ANY for the default route
+     * @return false on failure
+     */
+    bool open(in_addr interface) {
+        _sock = mdnsOpen(0, interface);
+        return _sock >= 0;
+    }
+
+    /**
+     * Socket to poll for answers
+     */
+    int fd() const { return _sock; }
+
+    /**
+     * Forget the answers and send a PTR query
+     * @param server Responder to ask, the mDNS group by default
+     * @return false if the query could not be sent
+     */
+    bool query(const sockaddr_in& server = mdnsAddress()) {
+        _records.clear();
+        DnsMessage  message;
+        DnsQuestion question;
+        message.id    = ++_id;
+        question.name = _serviceType;
+        question.type = DNS_TYPE_PTR;
+        message.questions.push_back(question);
+
+        uint8_t buffer[DNS_MAX_SIZE];
+        size_t  length = dnsEncode(message, buffer, sizeof(buffer));
+        return length > 0 && sendto(_sock, buffer, length, 0, (const sockaddr*)&server, sizeof(server)) > 0;
+    }
+
+    /**
+     * Read every pending answer without blocking
+     */
+    void receive() {
+        uint8_t buffer[DNS_MAX_SIZE];
+        ssize_t length;
+        while ((length = recv(_sock, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+            DnsMessage message;
+            if (!dnsParse(buffer, (size_t)length, &message) || !(message.flags & DNS_FLAG_QR)) continue;
+            _records.insert(_records.end(), message.records.begin(), message.records.end());
+        }
+    }
+
+    /**
+     * Resolve the answers received since the last query, in the order the instances were announced
+     * Instances announced with a TTL of 0 (goodbye) are returned with ttl 0.
+     */
+    std::vector<MdnsService> services() const {
+        std::vector<MdnsService> result;
+        for (const DnsRecord& ptr : _records) {
+            if (ptr.type != DNS_TYPE_PTR || !dnsNameEquals(ptr.name, _serviceType)) continue;
+            bool known = false;
+            for (const MdnsService& service : result) known = known || dnsNameEquals(service.instance, ptr.target);
+            if (known) continue;
+
+            MdnsService service;
+            service.instance = ptr.target;
+            service.ttl      = ptr.ttl;
+            for (const DnsRecord& record : _records) {
+                if (!dnsNameEquals(record.name, service.instance)) continue;
+                if (record.type == DNS_TYPE_SRV) {
+                    service.host = record.target;
+                    service.port = record.port;
+                } else if (record.type == DNS_TYPE_TXT) {
+                    service.txt = record.txt;
+                }
+            }
+            for (const DnsRecord& record : _records) {
+                if (record.type == DNS_TYPE_A && dnsNameEquals(record.name, service.host)) service.ipv4 = record.ipv4;
+            }
+            result.push_back(service);
+        }
+        return result;
+    }
+
+   private:
+    std::string            _serviceType;
+    std::vector<DnsRecord> _records;
+    int                    _sock = -1;
+    uint16_t               _id   = 0;
+};
+
+#endif  // WIICON_MDNS_H
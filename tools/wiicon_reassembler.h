@@ -0,0 +1,133 @@
+/**
+ * @file        wiicon_reassembler.h
+ * @brief       Host-side reassembler for redundant WiiCon frame bundles
+ *
+ * @details     Turns a stream of frames and redundant bundles into an in-order,
+ *              de-duplicated stream of frames per device. Frames repeated in a bundle
+ *              fill gaps left by lost datagrams (up to the bundle redundancy) and are
+ *              delivered immediately, so recovery adds no latency.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+
+#ifndef WIICON_REASSEMBLER_H
+#define WIICON_REASSEMBLER_H
+
+#include <stdint.h>
+
+#include "wiicon_frame.h"
+
+class FrameReassembler {
+   public:
+    /**
+     * Statistics since construction
+     */
+    struct Stats {
+        uint64_t delivered = 0; /**< Frames delivered */
+        uint64_t recovered = 0; /**< Frames delivered from a repeated copy (the original datagram was lost) */
+        uint64_t redundant = 0; /**< Repeated copies dropped because the frame was already delivered */
+        uint64_t late      = 0; /**< Frames dropped because a newer frame was already delivered */
+        uint64_t malformed = 0; /**< Datagrams that could not be decoded */
+    };
+
+    /**
+     * Process one datagram
+     * @param data Datagram (single frame or redundant bundle)
+     * @param length Datagram length in bytes
+     * @param deliver Called as deliver(const WiiconFrame&, bool recovered) for each new frame, oldest first
+     * @return Number of frames delivered
+     */
+    template <typename Deliver>
+    size_t push(const uint8_t* data, size_t length, Deliver&& deliver) {
+        WiiconFrame frames[1 + FRAME_MAX_REDUNDANCY];
+        size_t      count = 0;
+
+        if (frameIsBundle(data, length)) {
+            count = frameBundleDecode(data, length, frames, 1 + FRAME_MAX_REDUNDANCY);
+        } else if (frameDecode(data, length, &frames[0])) {
+            count = 1;
+        }
+
+        if (count == 0) {
+            _stats.malformed++;
+            return 0;
+        }
+
+        size_t delivered = 0;
+
+        // Bundles list the newest frame first, deliver oldest first to keep sequence order
+        for (size_t i = count; i-- > 0;) {
+            const WiiconFrame& frame = frames[i];
+            Device&            dev   = _devices[frame.deviceId];
+
+            if (dev.started) {
+                int16_t delta = (int16_t)(frame.sequence - dev.lastSequence);
+                if (delta <= 0) {
+                    if (i > 0) {
+                        _stats.redundant++;
+                    } else {
+                        _stats.late++;
+                    }
+                    continue;
+                }
+            }
+
+            // Only the newest frame of a datagram is its original transmission
+            bool recovered   = i > 0;
+            dev.started      = true;
+            dev.lastSequence = frame.sequence;
+
+            _stats.delivered++;
+            if (recovered) _stats.recovered++;
+            delivered++;
+
+            deliver(frame, recovered);
+        }
+
+        return delivered;
+    }
+
+    /**
+     * Get the statistics
+     * @return Statistics since construction
+     */
+    const Stats& stats() const { return _stats; }
+
+   private:
+    struct Device {
+        bool     started      = false;
+        uint16_t lastSequence = 0;
+    };
+
+    Device _devices[256]; /**< Tracking state per device id */
+    Stats  _stats;        /**< Statistics */
+};
+
+#endif  // WIICON_REASSEMBLER_H
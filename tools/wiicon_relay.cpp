@@ -0,0 +1,223 @@
+/**
+ * @file        wiicon_relay.cpp
+ * @brief       Host relay that republishes WiiCon binary frames as OSC
+ *
+ * @details     Listens for WiiCon datagrams, decodes compact binary frames and
+ *              redundant bundles (wiicon_frame.h, wiicon_reassembler.h) and republishes
+ *              each new frame once, in order, as the regular
+ *              /wiicon/euler, /wiicon/accel and /wiicon/gyro OSC messages, so existing
+ *              patches keep working. OSC datagrams are forwarded unchanged.
+ *
+ *              Build: g++ -std=c++17 -O2 -I.. wiicon_relay.cpp -o wiicon_relay
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include "wiicon_frame.h"
+#include "wiicon_reassembler.h"
+
+namespace {
+
+/**
+ * Minimal OSC writer for float messages
+ */
+class OscWriter {
+   public:
+    size_t size() const { return _size; }
+    const uint8_t* data() const { return _data; }
+
+    void begin(const char* address, const char* typeTags) {
+        _size = 0;
+        writeString(address);
+        writeString(typeTags);
+    }
+
+    void writeFloat(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        bits = htonl(bits);
+        memcpy(_data + _size, &bits, sizeof(bits));
+        _size += sizeof(bits);
+    }
+
+   private:
+    void writeString(const char* str) {
+        size_t len = strlen(str) + 1;
+        memcpy(_data + _size, str, len);
+        _size += len;
+        while (_size % 4 != 0) _data[_size++] = '\0';
+    }
+
+    uint8_t _data[128];
+    size_t  _size = 0;
+};
+
+struct Options {
+    uint16_t    listenPort  = 9000;
+    const char* forwardHost = "127.0.0.1";
+    uint16_t    forwardPort = 9001;
+    bool        swapRollYaw = false;
+};
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s [--listen PORT] [--forward HOST:PORT] [--swap-roll-yaw]\n"
+            "  --listen PORT       UDP port the WiiCon sends to (default 9000)\n"
+            "  --forward HOST:PORT where OSC is republished (default 127.0.0.1:9001)\n"
+            "  --swap-roll-yaw     match firmware builds with SWAP_ROLL_YAW enabled\n",
+            argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--listen") && i + 1 < argc) {
+            options->listenPort = (uint16_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--forward") && i + 1 < argc) {
+            char* target = argv[++i];
+            char* colon  = strrchr(target, ':');
+            if (!colon) return false;
+            *colon               = '\0';
+            options->forwardHost = target;
+            options->forwardPort = (uint16_t)atoi(colon + 1);
+        } else if (!strcmp(argv[i], "--swap-roll-yaw")) {
+            options->swapRollYaw = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Same conversion as getEulerAngles() in the firmware
+ */
+void quaternionToEuler(const float q[4], float* roll, float* pitch, float* yaw) {
+    const float toDeg = 180.0f / (float)M_PI;
+
+    *roll  = atan2f(2.0f * (q[0] * q[1] + q[2] * q[3]), 1.0f - 2.0f * (q[1] * q[1] + q[2] * q[2])) * toDeg;
+    *pitch = asinf(fmaxf(-1.0f, fminf(1.0f, 2.0f * (q[0] * q[2] - q[3] * q[1])))) * toDeg;
+    *yaw   = atan2f(2.0f * (q[0] * q[3] + q[1] * q[2]), 1.0f - 2.0f * (q[2] * q[2] + q[3] * q[3])) * toDeg;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int in  = socket(AF_INET, SOCK_DGRAM, 0);
+    int out = socket(AF_INET, SOCK_DGRAM, 0);
+    if (in < 0 || out < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    int reuse = 1;
+    setsockopt(in, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in listenAddr{};
+    listenAddr.sin_family      = AF_INET;
+    listenAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+    listenAddr.sin_port        = htons(options.listenPort);
+    if (bind(in, (sockaddr*)&listenAddr, sizeof(listenAddr)) < 0) {
+        perror("bind");
+        return 1;
+    }
+
+    sockaddr_in forwardAddr{};
+    forwardAddr.sin_family = AF_INET;
+    forwardAddr.sin_port   = htons(options.forwardPort);
+    if (inet_pton(AF_INET, options.forwardHost, &forwardAddr.sin_addr) != 1) {
+        fprintf(stderr, "Invalid forward address: %s\n", options.forwardHost);
+        return 1;
+    }
+
+    printf("Relaying UDP :%u -> %s:%u\n", options.listenPort, options.forwardHost, options.forwardPort);
+
+    uint8_t          packet[1500];
+    OscWriter        osc;
+    FrameReassembler reassembler;
+
+    auto publish = [&](const OscWriter& message) {
+        sendto(out, message.data(), message.size(), 0, (sockaddr*)&forwardAddr, sizeof(forwardAddr));
+    };
+
+    auto republish = [&](const WiiconFrame& frame) {
+        if (frame.flags & FRAME_HAS_QUAT) {
+            float roll, pitch, yaw;
+            quaternionToEuler(frame.quat, &roll, &pitch, &yaw);
+            if (options.swapRollYaw) std::swap(roll, yaw);
+
+            osc.begin("/wiicon/euler", ",fff");
+            osc.writeFloat(roll);
+            osc.writeFloat(pitch);
+            osc.writeFloat(yaw);
+            publish(osc);
+        }
+
+        if (frame.flags & FRAME_HAS_ACCEL) {
+            osc.begin("/wiicon/accel", ",fff");
+            for (int i = 0; i < 3; ++i) osc.writeFloat(frame.accel[i] / FRAME_ACC_LSB_PER_G);
+            publish(osc);
+        }
+
+        if (frame.flags & FRAME_HAS_GYRO) {
+            osc.begin("/wiicon/gyro", ",fff");
+            for (int i = 0; i < 3; ++i) osc.writeFloat(frame.gyro[i] / FRAME_GYR_LSB_PER_DPS);
+            publish(osc);
+        }
+    };
+
+    while (true) {
+        ssize_t length = recv(in, packet, sizeof(packet), 0);
+        if (length <= 0) continue;
+
+        if (!frameIsFrame(packet, (size_t)length) && !frameIsBundle(packet, (size_t)length)) {
+            sendto(out, packet, (size_t)length, 0, (sockaddr*)&forwardAddr, sizeof(forwardAddr));
+            continue;
+        }
+
+        reassembler.push(packet, (size_t)length, [&](const WiiconFrame& frame, bool) { republish(frame); });
+    }
+}
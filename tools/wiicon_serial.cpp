@@ -0,0 +1,258 @@
+/**
+ * @file        wiicon_serial.cpp
+ * @brief       Host bridge that republishes SLIP-framed OSC from USB serial to UDP
+ *
+ * @details     Reads the wired stream of a WiiCon built with SERIAL_OSC (serial_link.h),
+ *              decodes the SLIP framing (slip.h) and sends every OSC packet or binary frame
+ *              unchanged to a local UDP port, so existing patches, the relay and the analyzer
+ *              work over USB as they do over WiFi. /wiicon/log messages are printed to
+ *              stderr, and the port is reopened when the device is unplugged or reset.
+ *
+ *              Build: g++ -std=c++17 -O2 -I.. wiicon_serial.cpp -o wiicon_serial
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "osc_parser.h"
+#include "slip.h"
+#include "wiicon_frame.h"
+
+namespace {
+
+struct Options {
+    const char* device      = "/dev/ttyACM0";
+    long        baud        = 921600;
+    const char* forwardHost = "127.0.0.1";
+    uint16_t    forwardPort = 9000;
+    bool        quiet       = false;
+};
+
+volatile sig_atomic_t stopRequested = 0;
+
+void onSignal(int) { stopRequested = 1; }
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s [--device PATH] [--baud RATE] [--forward HOST:PORT] [--quiet]\n"
+            "  --device PATH       serial port of the WiiCon (default /dev/ttyACM0)\n"
+            "  --baud RATE         baud rate, ignored by native USB (default 921600)\n"
+            "  --forward HOST:PORT where packets are republished (default 127.0.0.1:9000)\n"
+            "  --quiet             do not print device logs\n",
+            argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--device") && hasValue) {
+            options->device = argv[++i];
+        } else if (!strcmp(argv[i], "--baud") && hasValue) {
+            options->baud = atol(argv[++i]);
+        } else if (!strcmp(argv[i], "--forward") && hasValue) {
+            char* target = argv[++i];
+            char* colon  = strrchr(target, ':');
+            if (!colon) return false;
+            *colon               = '\0';
+            options->forwardHost = target;
+            options->forwardPort = (uint16_t)atoi(colon + 1);
+        } else if (!strcmp(argv[i], "--quiet")) {
+            options->quiet = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+speed_t baudConstant(long baud) {
+    switch (baud) {
+        case 115200:
+            return B115200;
+        case 230400:
+            return B230400;
+        case 460800:
+            return B460800;
+        case 921600:
+            return B921600;
+        default:
+            return B0;
+    }
+}
+
+/**
+ * Open the serial port in raw mode
+ * @return File descriptor, -1 on failure
+ */
+int openPort(const char* device, long baud) {
+    int fd = open(device, O_RDONLY | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0) return -1;
+
+    termios tty{};
+    if (tcgetattr(fd, &tty) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    // Raw bytes, no echo or line discipline, reads return as soon as anything arrived
+    cfmakeraw(&tty);
+    tty.c_cflag |= CLOCAL | CREAD;
+    tty.c_cc[VMIN]  = 1;
+    tty.c_cc[VTIME] = 0;
+
+    speed_t speed = baudConstant(baud);
+    if (speed != B0) {
+        cfsetispeed(&tty, speed);
+        cfsetospeed(&tty, speed);
+    }
+
+    if (tcsetattr(fd, TCSANOW, &tty) < 0) {
+        close(fd);
+        return -1;
+    }
+    tcflush(fd, TCIFLUSH);
+    return fd;
+}
+
+const char* levelName(int32_t level) {
+    static const char* const NAMES[] = {"DEBUG", "INFO", "WARN", "ERROR", "CRIT"};
+    return level >= 0 && level < 5 ? NAMES[level] : "???";
+}
+
+/**
+ * Print a /wiicon/log message
+ * @return true if the packet was a log message
+ */
+bool printLog(const uint8_t* packet, size_t length, bool quiet) {
+    OscMessageView message;
+    if (!oscParseMessage(packet, length, &message) || strcmp(message.address, "/wiicon/log") != 0) return false;
+
+    OscArgReader args(message);
+    int32_t      level;
+    const char*  text;
+    if (!quiet && args.readInt(&level) && args.readString(&text)) fprintf(stderr, "[%s] %s\n", levelName(level), text);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int out = socket(AF_INET, SOCK_DGRAM, 0);
+    if (out < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    sockaddr_in forwardAddr{};
+    forwardAddr.sin_family = AF_INET;
+    forwardAddr.sin_port   = htons(options.forwardPort);
+    if (inet_pton(AF_INET, options.forwardHost, &forwardAddr.sin_addr) != 1) {
+        fprintf(stderr, "Invalid forward address: %s\n", options.forwardHost);
+        return 1;
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    printf("Bridging %s -> %s:%u\n", options.device, options.forwardHost, options.forwardPort);
+    fflush(stdout);
+
+    SlipDecoder decoder;
+    uint8_t     chunk[4096];
+    uint64_t    forwarded = 0;
+    int         fd        = -1;
+    bool        waiting   = false;
+
+    auto deliver = [&](const uint8_t* packet, size_t length) {
+        if (printLog(packet, length, options.quiet)) return;
+
+        // OSC messages and bundles start with '/' or '#', anything else that is not a frame is boot or line noise
+        if (packet[0] == '/' || packet[0] == '#' || frameIsFrame(packet, length) || frameIsBundle(packet, length)) {
+            sendto(out, packet, length, 0, (sockaddr*)&forwardAddr, sizeof(forwardAddr));
+            forwarded++;
+        } else if (!options.quiet) {
+            fprintf(stderr, "%.*s", (int)length, (const char*)packet);
+        }
+    };
+
+    while (!stopRequested) {
+        if (fd < 0) {
+            fd = openPort(options.device, options.baud);
+            if (fd < 0) {
+                if (!waiting) fprintf(stderr, "Waiting for %s...\n", options.device);
+                waiting = true;
+                usleep(500000);
+                continue;
+            }
+            fprintf(stderr, "Opened %s\n", options.device);
+            waiting = false;
+        }
+
+        pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 200) <= 0) continue;
+
+        ssize_t length = read(fd, chunk, sizeof(chunk));
+        if (length < 0 && (errno == EAGAIN || errno == EINTR)) continue;
+        if (length <= 0 || (pfd.revents & (POLLHUP | POLLERR))) {
+            if (length > 0) decoder.push(chunk, (size_t)length, deliver);
+            fprintf(stderr, "Lost %s\n", options.device);
+            close(fd);
+            fd = -1;
+            continue;
+        }
+
+        decoder.push(chunk, (size_t)length, deliver);
+    }
+
+    if (fd >= 0) close(fd);
+
+    const SlipDecoder::Stats& stats = decoder.stats();
+    printf("%llu packets forwarded, %llu oversized, %llu malformed\n", (unsigned long long)forwarded,
+           (unsigned long long)stats.oversized, (unsigned long long)stats.malformed);
+    return 0;
+}
@@ -0,0 +1,496 @@
+/**
+ * @file        wiicon_sim.cpp
+ * @brief       Host-side WiiCon stream simulator
+ *
+ * @details     Sends a synthetic WiiCon stream (OSC Euler angles or binary frames) to a
+ *              UDP target at a fixed rate, with optional random loss and reordering.
+ *              Frames can be sent as redundant bundles to exercise the reassembler, and
+ *              reliable events (wiicon_event.h) can be interleaved to exercise the event
+ *              peer, with the same loss applied to them. With --sync the simulator runs
+ *              a drifting device clock and synchronises it against wiicon_clock, then
+ *              reports the remaining error against the host clock. With --discover it
+ *              browses for a _wiicon-sink._udp receiver over mDNS on the same schedule as
+ *              the firmware and streams to it, falling back to --target when it is gone.
+ *              Lets the host tools be exercised on loopback without the device.
+ *
+ *              Build: g++ -std=c++17 -O2 -I.. wiicon_sim.cpp -o wiicon_sim
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "wiicon_clock.h"
+#include "wiicon_event.h"
+#include "wiicon_frame.h"
+#include "wiicon_mdns.h"
+
+namespace {
+
+struct Options {
+    const char* host        = "127.0.0.1";
+    uint16_t    port        = 9000;
+    double      rate        = 100.0;
+    double      duration    = 10.0;
+    bool        frames      = false;
+    double      loss        = 0.0;
+    double      reorder     = 0.0;
+    uint8_t     deviceId    = 1;
+    size_t      redundancy  = 0;
+    uint64_t    eventEvery  = 0;
+    bool        sync        = false;
+    double      clockDrift  = 40.0;
+    bool        discover    = false;
+    double      browseEvery = 15.0;
+    const char* server      = MDNS_GROUP;
+};
+
+// Same values as MDNS_BROWSE_WINDOW_MS and MDNS_SINK_MISSES in config.h
+constexpr double BROWSE_WINDOW = 1.0;
+constexpr int    SINK_MISSES   = 2;
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s [--target HOST:PORT] [--rate HZ] [--duration SEC] [--format osc|frame] [--loss P]\n"
+            "          [--reorder P] [--device ID] [--redundancy K] [--events N] [--sync] [--clock-drift PPM]\n"
+            "          [--discover] [--browse-interval SEC] [--server IP]\n"
+            "  --target HOST:PORT  destination (default 127.0.0.1:9000)\n"
+            "  --rate HZ           samples per second (default 100)\n"
+            "  --duration SEC      run time (default 10)\n"
+            "  --format osc|frame  OSC /wiicon/euler messages or binary frames (default osc)\n"
+            "  --loss P            probability of dropping a packet (default 0)\n"
+            "  --reorder P         probability of swapping a packet with the next one (default 0)\n"
+            "  --device ID         frame device id (default 1)\n"
+            "  --redundancy K      repeat the previous K frames in each packet (default 0, max 4)\n"
+            "  --events N          post a reliable event every N samples (default 0 = off)\n"
+            "  --sync              synchronise a simulated device clock against wiicon_clock at the target\n"
+            "  --clock-drift PPM   rate error of the simulated device clock (default 40)\n"
+            "  --discover          stream to a receiver found over mDNS, --target is the fallback\n"
+            "  --browse-interval SEC  time between two browses (default 15, as the firmware)\n"
+            "  --server IP         send mDNS queries to this host instead of the group\n",
+            argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--target") && hasValue) {
+            char* target = argv[++i];
+            char* colon  = strrchr(target, ':');
+            if (!colon) return false;
+            *colon        = '\0';
+            options->host = target;
+            options->port = (uint16_t)atoi(colon + 1);
+        } else if (!strcmp(argv[i], "--rate") && hasValue) {
+            options->rate = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--duration") && hasValue) {
+            options->duration = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--format") && hasValue) {
+            options->frames = !strcmp(argv[++i], "frame");
+        } else if (!strcmp(argv[i], "--loss") && hasValue) {
+            options->loss = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--reorder") && hasValue) {
+            options->reorder = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--device") && hasValue) {
+            options->deviceId = (uint8_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--redundancy") && hasValue) {
+            options->redundancy = (size_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--events") && hasValue) {
+            options->eventEvery = (uint64_t)atoll(argv[++i]);
+        } else if (!strcmp(argv[i], "--sync")) {
+            options->sync = true;
+        } else if (!strcmp(argv[i], "--clock-drift") && hasValue) {
+            options->clockDrift = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--discover")) {
+            options->discover = true;
+        } else if (!strcmp(argv[i], "--browse-interval") && hasValue) {
+            options->browseEvery = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--server") && hasValue) {
+            options->server = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return options->rate > 0.0 && options->redundancy <= FRAME_MAX_REDUNDANCY && options->browseEvery > BROWSE_WINDOW;
+}
+
+/**
+ * Same rule as the firmware: no "device" TXT entry or "*" accepts every controller, otherwise a list of ids
+ */
+bool acceptsDevice(const MdnsService& service, uint8_t deviceId) {
+    const char* list = service.txtValue("device");
+    if (!list || !strcmp(list, "*")) return true;
+    while (*list) {
+        char* end;
+        long  id = strtol(list, &end, 10);
+        if (end != list && id == deviceId) return true;
+        list = strchr(list, ',');
+        if (!list) break;
+        ++list;
+    }
+    return false;
+}
+
+size_t writeOscString(uint8_t* out, const char* str) {
+    size_t len = strlen(str) + 1;
+    memcpy(out, str, len);
+    while (len % 4 != 0) out[len++] = '\0';
+    return len;
+}
+
+size_t writeOscFloat(uint8_t* out, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bits = htonl(bits);
+    memcpy(out, &bits, sizeof(bits));
+    return sizeof(bits);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    sockaddr_in target{};
+    target.sin_family = AF_INET;
+    target.sin_port   = htons(options.port);
+    if (inet_pton(AF_INET, options.host, &target.sin_addr) != 1) {
+        fprintf(stderr, "Invalid target address: %s\n", options.host);
+        return 1;
+    }
+
+    std::mt19937                           rng(std::random_device{}());
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+    using clock = std::chrono::steady_clock;
+
+    auto     period    = std::chrono::duration<double>(1.0 / options.rate);
+    auto     next      = clock::now();
+    uint64_t samples   = (uint64_t)(options.duration * options.rate);
+    uint64_t sent      = 0;
+    uint64_t dropped   = 0;
+    uint64_t reordered = 0;
+
+    std::vector<uint8_t> held;  // packet delayed behind its successor
+
+    // Encoded frames, newest first, for redundant bundles
+    uint8_t history[1 + FRAME_MAX_REDUNDANCY][FRAME_MAX_SIZE];
+    size_t  historyLengths[1 + FRAME_MAX_REDUNDANCY] = {};
+    size_t  historyCount                             = 0;
+
+    auto send = [&](const uint8_t* data, size_t length) {
+        sendto(sock, data, length, 0, (sockaddr*)&target, sizeof(target));
+        sent++;
+    };
+
+    // Reliable events share the socket, so acknowledgements come back to it
+    EventQueue events;
+    uint64_t   eventsDropped = 0;
+    auto       start         = clock::now();
+    events.setIdentity(options.deviceId, (uint32_t)rng());
+
+    auto millisNow = [&]() {
+        return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - start).count();
+    };
+
+    // Simulated device clock: random origin and a rate error of --clock-drift ppm
+    ClockEstimator clockEstimator;
+    uint32_t       clockOrigin  = (uint32_t)rng();
+    uint16_t       pingSequence = 0;
+    uint64_t       pings        = 0;
+    uint64_t       pongs        = 0;
+    auto           lastPing     = start;
+
+    auto deviceMicros = [&]() {
+        double elapsed = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+        return clockOrigin + (uint32_t)(uint64_t)(elapsed * (1.0 + options.clockDrift * 1e-6));
+    };
+
+    auto hostMicros = []() {
+        using namespace std::chrono;
+        return (int64_t)duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+    };
+
+    // Acknowledgements and pongs both come back to the socket
+    auto receive = [&]() {
+        uint8_t reply[256];
+        ssize_t length;
+        while ((length = recv(sock, reply, sizeof(reply), MSG_DONTWAIT)) > 0) {
+            uint32_t      t4 = deviceMicros();
+            WiiconEvent   ack;
+            ClockExchange exchange;
+            if (eventAckDecode(reply, (size_t)length, &ack)) {
+                events.acknowledge(ack, millisNow());
+            } else if (clockPongDecode(reply, (size_t)length, &exchange) && exchange.sequence == pingSequence) {
+                clockEstimator.addExchange(exchange, t4);
+                pongs++;
+            }
+        }
+    };
+
+    // Same schedule as the firmware: fast until a first estimate, then once per second
+    auto serviceSync = [&]() {
+        auto interval = std::chrono::milliseconds(pongs < CLOCK_WINDOW / 4 ? 100 : 1000);
+        if (clock::now() - lastPing < interval) return;
+        lastPing = clock::now();
+        pings++;
+        pingSequence++;
+        if (chance(rng) < options.loss) return;
+
+        uint8_t ping[CLOCK_MAX_SIZE];
+        size_t  length = clockPingEncode(options.deviceId, pingSequence, deviceMicros(), ping);
+        sendto(sock, ping, length, 0, (sockaddr*)&target, sizeof(target));
+    };
+
+    // Receiver discovery, the same steps as Discovery::loop() and Discovery::collect() in the firmware
+    sockaddr_in fallback   = target;
+    bool        hasSink    = false;
+    bool        browsing   = false;
+    int         misses     = 0;
+    uint64_t    browses    = 0;
+    uint64_t    switches   = 0;
+    auto        nextBrowse = start;
+    auto        browseEnd  = start;
+    MdnsBrowser browser("_wiicon-sink._udp.local");
+    if (options.discover && !browser.open(in_addr{htonl(INADDR_ANY)})) {
+        perror("mdns socket");
+        return 1;
+    }
+
+    auto useTarget = [&](const sockaddr_in& address, const char* name) {
+        char text[INET_ADDRSTRLEN];
+        inet_ntop(AF_INET, &address.sin_addr, text, sizeof(text));
+        printf("%.1f s: streaming to %s at %s:%u\n", std::chrono::duration<double>(clock::now() - start).count(),
+               name, text, ntohs(address.sin_port));
+        fflush(stdout);
+        target = address;
+        switches++;
+    };
+
+    auto collectSinks = [&]() {
+        std::vector<MdnsService> sinks  = browser.services();
+        const MdnsService*       chosen = nullptr;
+        for (const MdnsService& sink : sinks) {
+            if (sink.port == 0 || sink.ttl == 0 || sink.ipv4 == 0 || !acceptsDevice(sink, options.deviceId)) continue;
+            if (hasSink && sink.ipv4 == target.sin_addr.s_addr && sink.port == ntohs(target.sin_port)) {
+                misses = 0;
+                return;
+            }
+            if (!chosen) chosen = &sink;
+        }
+
+        if (hasSink && ++misses < SINK_MISSES) return;
+        misses = 0;
+        if (chosen) {
+            sockaddr_in address{};
+            address.sin_family      = AF_INET;
+            address.sin_port        = htons(chosen->port);
+            address.sin_addr.s_addr = chosen->ipv4;
+            hasSink                 = true;
+            useTarget(address, ("receiver \"" + chosen->label() + "\"").c_str());
+        } else if (hasSink) {
+            hasSink = false;
+            useTarget(fallback, "the fallback target");
+        }
+    };
+
+    auto serviceDiscovery = [&]() {
+        if (browsing) {
+            browser.receive();
+            if (clock::now() < browseEnd) return;
+            browsing = false;
+            collectSinks();
+            return;
+        }
+        if (clock::now() < nextBrowse) return;
+        nextBrowse = clock::now() + std::chrono::duration_cast<clock::duration>(
+                                        std::chrono::duration<double>(options.browseEvery));
+        browseEnd  = clock::now() + std::chrono::duration_cast<clock::duration>(
+                                       std::chrono::duration<double>(BROWSE_WINDOW));
+        browsing   = browser.query(mdnsAddress(options.server));
+        browses++;
+    };
+
+    auto serviceEvents = [&]() {
+        events.service(millisNow(), [&](const WiiconEvent& event) {
+            if (chance(rng) < options.loss) {
+                eventsDropped++;
+                return;
+            }
+            uint8_t encoded[EVENT_MAX_SIZE];
+            sendto(sock, encoded, eventEncode(event, encoded), 0, (sockaddr*)&target, sizeof(target));
+        });
+    };
+
+    for (uint64_t n = 0; n < samples; ++n) {
+        uint8_t packet[FRAME_BUNDLE_HEADER_SIZE + (1 + FRAME_MAX_REDUNDANCY) * FRAME_MAX_SIZE];
+        size_t  length = 0;
+        float   t      = (float)n / (float)options.rate;
+        float   yaw    = fmodf(t * 36.0f, 360.0f) - 180.0f;
+
+        if (options.frames) {
+            float       half = yaw * 0.5f * (float)M_PI / 180.0f;
+            WiiconFrame frame{};
+            frame.flags     = FRAME_HAS_ACCEL | FRAME_HAS_GYRO | FRAME_HAS_QUAT;
+            frame.deviceId  = options.deviceId;
+            frame.sequence  = (uint16_t)n;
+            frame.timestamp = deviceMicros();
+            if (clockEstimator.synced()) {
+                frame.flags |= FRAME_HOST_TIME;
+                frame.timestamp = (uint32_t)clockEstimator.toHost(frame.timestamp);
+            }
+            frame.accel[2]  = (int16_t)FRAME_ACC_LSB_PER_G;
+            frame.gyro[2]   = frameQuantize(36.0f, FRAME_GYR_LSB_PER_DPS);
+            frame.quat[0]   = cosf(half);
+            frame.quat[3]   = sinf(half);
+            length          = frameEncode(frame, packet, sizeof(packet));
+
+            if (options.redundancy > 0) {
+                for (size_t i = historyCount < options.redundancy ? historyCount : options.redundancy; i > 0; --i) {
+                    memcpy(history[i], history[i - 1], historyLengths[i - 1]);
+                    historyLengths[i] = historyLengths[i - 1];
+                }
+                memcpy(history[0], packet, length);
+                historyLengths[0] = length;
+                if (historyCount <= options.redundancy) historyCount++;
+
+                const uint8_t* frames[1 + FRAME_MAX_REDUNDANCY];
+                for (size_t i = 0; i < historyCount; ++i) frames[i] = history[i];
+                length = frameBundleEncode(frames, historyLengths, historyCount, packet, sizeof(packet));
+            }
+        } else {
+            length += writeOscString(packet + length, "/wiicon/euler");
+            length += writeOscString(packet + length, ",fff");
+            length += writeOscFloat(packet + length, 0.0f);
+            length += writeOscFloat(packet + length, 0.0f);
+            length += writeOscFloat(packet + length, yaw);
+        }
+
+        next += std::chrono::duration_cast<clock::duration>(period);
+        if (options.eventEvery > 0 || options.sync || options.discover) {
+            // Wait on the sockets so replies are stamped when they arrive, not at the next sample
+            for (auto now = clock::now(); now < next; now = clock::now()) {
+                int    timeout = (int)std::chrono::duration_cast<std::chrono::milliseconds>(next - now).count();
+                pollfd pfds[2] = {{sock, POLLIN, 0}, {browser.fd(), POLLIN, 0}};
+                if (poll(pfds, 2, timeout) <= 0) continue;
+                if (pfds[0].revents) receive();
+                if (pfds[1].revents) browser.receive();
+            }
+        } else {
+            std::this_thread::sleep_until(next);
+        }
+
+        // Events and clock sync are serviced ahead of the sample, as on the device
+        if (options.eventEvery > 0 || options.sync) receive();
+        if (options.eventEvery > 0) {
+            if (n % options.eventEvery == 0) events.post(EVENT_BUTTON, (int32_t)(n / options.eventEvery), millisNow());
+            serviceEvents();
+        }
+        if (options.sync) serviceSync();
+        if (options.discover) serviceDiscovery();
+
+        if (chance(rng) < options.loss) {
+            dropped++;
+            continue;
+        }
+
+        if (held.empty() && chance(rng) < options.reorder) {
+            held.assign(packet, packet + length);
+            reordered++;
+            continue;
+        }
+
+        send(packet, length);
+        if (!held.empty()) {
+            send(held.data(), held.size());
+            held.clear();
+        }
+    }
+
+    if (!held.empty()) send(held.data(), held.size());
+
+    // Give outstanding events time to be acknowledged or to expire
+    auto drainEnd = clock::now() + std::chrono::seconds(2);
+    while (options.eventEvery > 0 && !events.idle() && clock::now() < drainEnd) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        receive();
+        serviceEvents();
+    }
+
+    printf("Sent %llu packets (%llu dropped, %llu reordered)", (unsigned long long)sent, (unsigned long long)dropped,
+           (unsigned long long)reordered);
+    if (options.discover) {
+        printf(", %llu browses, %llu target switches\n", (unsigned long long)browses, (unsigned long long)switches);
+    } else {
+        printf(" to %s:%u\n", options.host, options.port);
+    }
+    if (options.eventEvery > 0) {
+        const EventQueue::Stats& stats = events.stats();
+        printf("Events: %lu posted, %lu acked, %lu retransmits, %lu fast retransmits, %lu expired, %lu overflows, "
+               "%llu transmissions dropped\n",
+               (unsigned long)stats.posted, (unsigned long)stats.acked, (unsigned long)stats.retransmits,
+               (unsigned long)stats.fastRetransmits, (unsigned long)stats.expired, (unsigned long)stats.overflows,
+               (unsigned long long)eventsDropped);
+    }
+    if (options.sync) {
+        receive();
+        uint32_t device = deviceMicros();
+        int64_t  error  = clockEstimator.toHost(device) - hostMicros();
+        printf("Clock: %llu pings, %s, error %lld us, drift %.2f ppm (true %.2f), min rtt %lld us\n",
+               (unsigned long long)pings, clockEstimator.synced() ? "synced" : "not synced", (long long)error,
+               clockEstimator.driftPpm(), -options.clockDrift / (1.0 + options.clockDrift * 1e-6),
+               (long long)clockEstimator.minRtt());
+    }
+    close(sock);
+    return 0;
+}
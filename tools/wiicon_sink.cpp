@@ -0,0 +1,460 @@
+/**
+ * @file        wiicon_sink.cpp
+ * @brief       Host-side WiiCon receiver advertised over mDNS
+ *
+ * @details     Announces a _wiicon-sink._udp service with its own minimal mDNS responder,
+ *              so controllers without a configured OSC IP find it and stream to it unicast,
+ *              and counts the packets that arrive on the advertised port per sender. The
+ *              responder answers multicast queries and legacy unicast queries, announces
+ *              the service at start and sends a goodbye when stopped. With --group it also
+ *              joins the multicast group of the default target, and --expect makes the exit
+ *              status report whether enough packets arrived. With --browse it lists the
+ *              controllers advertising _osc._udp instead.
+ *              Stands in for a system responder (Avahi, Bonjour) in tests on one host.
+ *
+ *              Build: g++ -std=c++17 -O2 -I.. wiicon_sink.cpp -o wiicon_sink
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "wiicon_mdns.h"
+
+namespace {
+
+constexpr char     SINK_SERVICE[] = "_wiicon-sink._udp.local";
+constexpr char     OSC_SERVICE[]  = "_osc._udp.local";
+constexpr char     SERVICES[]     = "_services._dns-sd._udp.local";
+constexpr uint32_t RECORD_TTL     = 120;  // RFC 6762 recommends 120 s for records naming a host
+constexpr uint32_t LEGACY_TTL     = 10;   // RFC 6762 section 6.7 caps legacy unicast answers
+
+struct Options {
+    uint16_t    port      = 9000;
+    const char* name      = "WiiCon sink";
+    const char* address   = nullptr;
+    const char* interface = nullptr;
+    const char* devices   = nullptr;
+    const char* group     = nullptr;
+    const char* server    = MDNS_GROUP;
+    double      duration  = 0.0;
+    uint64_t    expect    = 0;
+    double      window    = 1.5;
+    bool        browse    = false;
+    bool        quiet     = false;
+};
+
+volatile sig_atomic_t stopRequested = 0;
+
+void onSignal(int) { stopRequested = 1; }
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s [--port PORT] [--name NAME] [--address IP] [--interface IP] [--device LIST] [--duration SEC]\n"
+            "          [--group ADDR] [--expect N] [--quiet]\n"
+            "       %s --browse [--window SEC] [--server IP] [--interface IP]\n"
+            "  --port PORT     port the stream is received on and advertised (default 9000)\n"
+            "  --name NAME     instance name (default \"WiiCon sink\")\n"
+            "  --address IP    address announced in the A record (default: address of the multicast route)\n"
+            "  --interface IP  interface for mDNS multicast (default: the default route)\n"
+            "  --device LIST   only accept these device ids, e.g. 3,17 (TXT \"device\", default all)\n"
+            "  --duration SEC  stop after SEC seconds (default 0 = until Ctrl-C)\n"
+            "  --group ADDR    also receive the stream sent to this multicast group (e.g. 239.255.0.90)\n"
+            "  --expect N      exit with status 2 if fewer than N packets arrived\n"
+            "  --quiet         only print the total at exit\n"
+            "  --browse        list the controllers advertising _osc._udp and exit\n"
+            "  --window SEC    time answers are collected for with --browse (default 1.5)\n"
+            "  --server IP     ask this host instead of the mDNS group, for networks without multicast\n",
+            argv0, argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--port") && hasValue) {
+            options->port = (uint16_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--name") && hasValue) {
+            options->name = argv[++i];
+        } else if (!strcmp(argv[i], "--address") && hasValue) {
+            options->address = argv[++i];
+        } else if (!strcmp(argv[i], "--interface") && hasValue) {
+            options->interface = argv[++i];
+        } else if (!strcmp(argv[i], "--device") && hasValue) {
+            options->devices = argv[++i];
+        } else if (!strcmp(argv[i], "--group") && hasValue) {
+            options->group = argv[++i];
+        } else if (!strcmp(argv[i], "--expect") && hasValue) {
+            options->expect = strtoull(argv[++i], nullptr, 10);
+        } else if (!strcmp(argv[i], "--server") && hasValue) {
+            options->server = argv[++i];
+        } else if (!strcmp(argv[i], "--duration") && hasValue) {
+            options->duration = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--window") && hasValue) {
+            options->window = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--browse")) {
+            options->browse = true;
+        } else if (!strcmp(argv[i], "--quiet")) {
+            options->quiet = true;
+        } else {
+            return false;
+        }
+    }
+    return options->port > 0 && options->name[0] != '\0' && !strchr(options->name, '.');
+}
+
+/**
+ * Address the host would send multicast from, the one receivers on the network can reach
+ */
+uint32_t routeAddress(in_addr interface) {
+    if (interface.s_addr != htonl(INADDR_ANY)) return interface.s_addr;
+
+    int         sock  = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in group = mdnsAddress();
+    sockaddr_in local{};
+    socklen_t   size  = sizeof(local);
+    uint32_t    ip    = htonl(INADDR_LOOPBACK);
+    if (sock >= 0 && connect(sock, (sockaddr*)&group, sizeof(group)) == 0 &&
+        getsockname(sock, (sockaddr*)&local, &size) == 0 && local.sin_addr.s_addr != htonl(INADDR_ANY)) {
+        ip = local.sin_addr.s_addr;
+    }
+    if (sock >= 0) close(sock);
+    return ip;
+}
+
+std::string addressString(const sockaddr_in& address) {
+    char text[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &address.sin_addr, text, sizeof(text));
+    return std::string(text) + ":" + std::to_string(ntohs(address.sin_port));
+}
+
+/**
+ * The records of the advertised service
+ */
+struct Service {
+    std::string instance;
+    std::string host;
+    uint32_t    ipv4;
+    uint16_t    port;
+    std::string devices;
+
+    DnsRecord ptr(uint32_t ttl) const {
+        DnsRecord record;
+        record.name   = SINK_SERVICE;
+        record.type   = DNS_TYPE_PTR;
+        record.ttl    = ttl;
+        record.target = instance;
+        return record;
+    }
+
+    DnsRecord srv(uint32_t ttl) const {
+        DnsRecord record;
+        record.name   = instance;
+        record.type   = DNS_TYPE_SRV;
+        record.cls    = DNS_CLASS_IN | DNS_CLASS_FLUSH;
+        record.ttl    = ttl;
+        record.target = host;
+        record.port   = port;
+        return record;
+    }
+
+    DnsRecord txt(uint32_t ttl) const {
+        DnsRecord record;
+        record.name = instance;
+        record.type = DNS_TYPE_TXT;
+        record.cls  = DNS_CLASS_IN | DNS_CLASS_FLUSH;
+        record.ttl  = ttl;
+        record.txt.push_back("format=osc,frame");
+        if (!devices.empty()) record.txt.push_back("device=" + devices);
+        return record;
+    }
+
+    DnsRecord a(uint32_t ttl) const {
+        DnsRecord record;
+        record.name = host;
+        record.type = DNS_TYPE_A;
+        record.cls  = DNS_CLASS_IN | DNS_CLASS_FLUSH;
+        record.ttl  = ttl;
+        record.ipv4 = ipv4;
+        return record;
+    }
+
+    /**
+     * Add the records answering a question, the whole service for a browse so no follow-up query is needed
+     * @return Whether the question is about this service
+     */
+    bool answer(const DnsQuestion& question, uint32_t ttl, std::vector<DnsRecord>* records) const {
+        bool any = question.type == DNS_TYPE_ANY;
+        if (dnsNameEquals(question.name, SERVICES) && (any || question.type == DNS_TYPE_PTR)) {
+            DnsRecord record = ptr(ttl);
+            record.name      = SERVICES;
+            record.target    = SINK_SERVICE;
+            records->push_back(record);
+            return true;
+        }
+        if (dnsNameEquals(question.name, SINK_SERVICE) && (any || question.type == DNS_TYPE_PTR)) {
+            records->push_back(ptr(ttl));
+            records->push_back(srv(ttl));
+            records->push_back(txt(ttl));
+            records->push_back(a(ttl));
+            return true;
+        }
+        if (dnsNameEquals(question.name, instance) &&
+            (any || question.type == DNS_TYPE_SRV || question.type == DNS_TYPE_TXT)) {
+            records->push_back(srv(ttl));
+            records->push_back(txt(ttl));
+            records->push_back(a(ttl));
+            return true;
+        }
+        if (dnsNameEquals(question.name, host) && (any || question.type == DNS_TYPE_A)) {
+            records->push_back(a(ttl));
+            return true;
+        }
+        return false;
+    }
+};
+
+int browse(const Options& options, in_addr interface) {
+    MdnsBrowser browser(OSC_SERVICE);
+    if (!browser.open(interface)) {
+        perror("mdns socket");
+        return 1;
+    }
+    if (!browser.query(mdnsAddress(options.server))) {
+        perror("mdns query");
+        return 1;
+    }
+
+    auto end = std::chrono::steady_clock::now() + std::chrono::duration<double>(options.window);
+    for (auto now = std::chrono::steady_clock::now(); now < end; now = std::chrono::steady_clock::now()) {
+        int    timeout = (int)std::chrono::duration_cast<std::chrono::milliseconds>(end - now).count();
+        pollfd pfd     = {browser.fd(), POLLIN, 0};
+        if (poll(&pfd, 1, timeout) > 0) browser.receive();
+    }
+
+    std::vector<MdnsService> services = browser.services();
+    for (const MdnsService& service : services) {
+        in_addr ip;
+        ip.s_addr = service.ipv4;
+        printf("%s  %s (%s) port %u\n", service.label().c_str(), service.host.c_str(), inet_ntoa(ip), service.port);
+        for (const std::string& entry : service.txt) printf("    %s\n", entry.c_str());
+    }
+    printf("%zu controller(s) found\n", services.size());
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    in_addr interface;
+    interface.s_addr = htonl(INADDR_ANY);
+    if (options.interface && inet_pton(AF_INET, options.interface, &interface) != 1) {
+        fprintf(stderr, "Invalid interface address: %s\n", options.interface);
+        return 1;
+    }
+    if (options.browse) return browse(options, interface);
+
+    Service service;
+    service.instance = std::string(options.name) + "." + SINK_SERVICE;
+    service.host     = "wiicon-sink-" + std::to_string(options.port) + ".local";
+    service.ipv4     = routeAddress(interface);
+    service.port     = options.port;
+    service.devices  = options.devices ? options.devices : "";
+    if (options.address && inet_pton(AF_INET, options.address, &service.ipv4) != 1) {
+        fprintf(stderr, "Invalid address: %s\n", options.address);
+        return 1;
+    }
+
+    int mdns = mdnsOpen(MDNS_PORT, interface);
+    if (mdns < 0) {
+        perror("mdns socket");
+        return 1;
+    }
+
+    int data = socket(AF_INET, SOCK_DGRAM, 0);
+    if (data < 0) {
+        perror("socket");
+        return 1;
+    }
+    sockaddr_in local{};
+    local.sin_family      = AF_INET;
+    local.sin_port        = htons(options.port);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(data, (sockaddr*)&local, sizeof(local)) < 0) {
+        perror("bind");
+        return 1;
+    }
+    if (options.group) {
+        ip_mreq mreq{};
+        mreq.imr_interface = interface;
+        if (inet_pton(AF_INET, options.group, &mreq.imr_multiaddr) != 1 ||
+            setsockopt(data, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+            fprintf(stderr, "Failed to join multicast group %s\n", options.group);
+            return 1;
+        }
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    sockaddr_in group = mdnsAddress();
+    auto        send  = [&](const DnsMessage& message, const sockaddr_in& to) {
+        uint8_t buffer[DNS_MAX_SIZE];
+        size_t  length = dnsEncode(message, buffer, sizeof(buffer));
+        if (length > 0) sendto(mdns, buffer, length, 0, (const sockaddr*)&to, sizeof(to));
+    };
+
+    // Unsolicited announcement of every record, repeated once a second later (RFC 6762 section 8.3)
+    auto announce = [&](uint32_t ttl) {
+        DnsMessage message;
+        message.flags   = DNS_FLAG_QR | DNS_FLAG_AA;
+        message.records = {service.ptr(ttl), service.srv(ttl), service.txt(ttl), service.a(ttl)};
+        send(message, group);
+    };
+
+    using clock = std::chrono::steady_clock;
+
+    auto start         = clock::now();
+    auto nextAnnounce  = start;
+    int  announcements = 0;
+    auto nextReport    = start + std::chrono::seconds(1);
+
+    std::map<std::string, uint64_t> interval;  // packets per sender since the last report
+    std::map<std::string, uint64_t> total;
+    uint64_t                        queries = 0;
+
+    in_addr announced;
+    announced.s_addr = service.ipv4;
+    printf("Advertising \"%s\" on %s:%u as %s\n", options.name, inet_ntoa(announced), options.port,
+           service.host.c_str());
+    fflush(stdout);
+
+    while (!stopRequested) {
+        auto now = clock::now();
+        if (options.duration > 0 && now - start >= std::chrono::duration<double>(options.duration)) break;
+
+        if (announcements < 2 && now >= nextAnnounce) {
+            announce(RECORD_TTL);
+            announcements++;
+            nextAnnounce = now + std::chrono::seconds(1);
+        }
+
+        if (now >= nextReport) {
+            if (!options.quiet) {
+                for (const auto& entry : interval) {
+                    printf("%s: %llu packets\n", entry.first.c_str(), (unsigned long long)entry.second);
+                }
+                fflush(stdout);
+            }
+            interval.clear();
+            nextReport += std::chrono::seconds(1);
+        }
+
+        pollfd pfds[2] = {{mdns, POLLIN, 0}, {data, POLLIN, 0}};
+        if (poll(pfds, 2, 50) <= 0) continue;
+
+        uint8_t     buffer[DNS_MAX_SIZE];
+        sockaddr_in from{};
+        socklen_t   fromSize = sizeof(from);
+        ssize_t     length;
+
+        while ((length = recvfrom(data, buffer, sizeof(buffer), MSG_DONTWAIT, (sockaddr*)&from, &fromSize)) >= 0) {
+            std::string sender = addressString(from);
+            interval[sender]++;
+            total[sender]++;
+            fromSize = sizeof(from);
+        }
+
+        fromSize = sizeof(from);
+        while ((length = recvfrom(mdns, buffer, sizeof(buffer), MSG_DONTWAIT, (sockaddr*)&from, &fromSize)) >= 0) {
+            fromSize = sizeof(from);
+            DnsMessage query;
+            if (!dnsParse(buffer, (size_t)length, &query) || (query.flags & DNS_FLAG_QR)) continue;
+
+            // A query from another port than 5353 comes from a simple resolver that only listens for a direct reply
+            bool legacy  = ntohs(from.sin_port) != MDNS_PORT;
+            bool unicast = legacy;
+
+            DnsMessage reply;
+            reply.flags = DNS_FLAG_QR | DNS_FLAG_AA;
+            for (const DnsQuestion& question : query.questions) {
+                if (!service.answer(question, legacy ? LEGACY_TTL : RECORD_TTL, &reply.records)) continue;
+                unicast = unicast || question.unicast;
+                if (legacy) reply.questions.push_back(question);
+            }
+            if (reply.records.empty()) continue;
+
+            if (legacy) {
+                // Legacy replies echo the query id and carry no cache-flush bits (RFC 6762 section 6.7)
+                reply.id = query.id;
+                for (DnsRecord& record : reply.records) record.cls &= (uint16_t)~DNS_CLASS_FLUSH;
+            }
+            send(reply, unicast ? from : group);
+            queries++;
+        }
+    }
+
+    // Goodbye (TTL 0), so caching browsers such as Avahi forget this receiver at once
+    announce(0);
+
+    uint64_t packets = 0;
+    for (const auto& entry : total) {
+        printf("Total from %s: %llu packets\n", entry.first.c_str(), (unsigned long long)entry.second);
+        packets += entry.second;
+    }
+    printf("Received %llu packets from %zu sender(s), answered %llu queries\n", (unsigned long long)packets,
+           total.size(), (unsigned long long)queries);
+    close(data);
+    close(mdns);
+
+    if (packets < options.expect) {
+        fprintf(stderr, "Expected at least %llu packets\n", (unsigned long long)options.expect);
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file        wiicon_test_clock.cpp
+ * @brief       Host test of the clock synchronisation estimator
+ *
+ * @details     Feeds ClockEstimator with synthetic ping/pong exchanges between a device clock and a
+ *              host clock with a known offset and drift, starting just before the micros() rollover.
+ *              Checks that the drift converges within tolerance under delay jitter, that an asymmetric
+ *              path biases the offset by exactly half the asymmetry, and that exchanges delayed more
+ *              than CLOCK_RTT_REJECT_US above the minimum round trip are left out of the estimate.
+ *              Exits non-zero on failure.
+ *
+ *              Build: g++ -std=c++17 -O2 -Wall -Wextra -I.. wiicon_test_clock.cpp -o wiicon_test_clock
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include <cstdio>
+#include <cstdlib>
+
+#include "wiicon_clock.h"
+
+namespace {
+
+const uint32_t DEVICE_START  = 0xFFFFFFFFu - 10000000u; /**< Device micros 10 s before the rollover */
+const int64_t  HOST_START    = 1790000000000000;        /**< Host Unix micros at the first ping */
+const int64_t  PROCESSING_US = 50;                      /**< Host time between receiving a ping and answering */
+const int64_t  INTERVAL_US   = 500000;                  /**< Device time between pings */
+
+int failures = 0; /**< Failed checks */
+
+void check(bool condition, const char* name) {
+    printf("%s %s\n", condition ? "PASS" : "FAIL", name);
+    if (!condition) failures++;
+}
+
+/**
+ * Two clocks and the path between them
+ * The host runs (1 + drift) times as fast as the device, device time is kept as 64-bit micros since the start.
+ */
+class Link {
+   public:
+    explicit Link(double drift) : _drift(drift), _elapsed(0), _last(0), _sequence(0), _seed(12345) {}
+
+    /**
+     * Host time at a device time since the start
+     */
+    int64_t host(int64_t elapsed) const { return HOST_START + elapsed + (int64_t)(_drift * (double)elapsed); }
+
+    /**
+     * Run one exchange and advance to the next ping
+     * @param up Device to host delay in microseconds
+     * @param down Host to device delay in microseconds
+     * @return What addExchange() returned
+     */
+    bool exchange(ClockEstimator& estimator, int64_t up, int64_t down) {
+        ClockExchange exchange{};
+        exchange.deviceId = 1;
+        exchange.sequence = _sequence++;
+        exchange.t1       = (uint32_t)(DEVICE_START + _elapsed);
+        exchange.t2       = host(_elapsed + up);
+        exchange.t3       = exchange.t2 + PROCESSING_US;
+
+        _last = _elapsed + up + PROCESSING_US + down;
+        bool accepted = estimator.addExchange(exchange, (uint32_t)(DEVICE_START + _last));
+        _elapsed += INTERVAL_US;
+        return accepted;
+    }
+
+    /**
+     * Pseudo-random queueing delay, deterministic across runs
+     */
+    int64_t jitter(int64_t max) {
+        _seed = _seed * 1103515245u + 12345u;
+        return (int64_t)((_seed >> 8) % (uint32_t)(max + 1));
+    }
+
+    /**
+     * Error of the estimate at the device time of the last pong
+     */
+    int64_t offsetError(const ClockEstimator& estimator) const {
+        return estimator.toHost((uint32_t)(DEVICE_START + _last)) - host(_last);
+    }
+
+   private:
+    double   _drift;    /**< Host rate relative to the device, minus one */
+    int64_t  _elapsed;  /**< Device micros since the start at the next ping */
+    int64_t  _last;     /**< Device micros since the start when the last pong arrived */
+    uint16_t _sequence; /**< Next ping sequence */
+    uint32_t _seed;     /**< Jitter generator state */
+};
+
+/**
+ * A 40 ppm drift is found through jitter on both legs, across the micros() rollover
+ */
+void testDrift() {
+    ClockEstimator estimator;
+    Link           link(40e-6);
+
+    for (int i = 0; i < 120; ++i) link.exchange(estimator, 1000 + link.jitter(400), 1000 + link.jitter(400));
+
+    printf("     drift %.2f ppm, offset error %lld us\n", estimator.driftPpm(), (long long)link.offsetError(estimator));
+    check(estimator.synced(), "synced");
+    check(std::abs(estimator.driftPpm() - 40.0) < 2.0, "drift converges within 2 ppm");
+    check(std::abs(link.offsetError(estimator)) < 200, "offset within the jitter after the rollover");
+}
+
+/**
+ * The exchange cannot see which leg is slower, so the offset is off by half the difference
+ */
+void testAsymmetry() {
+    ClockEstimator estimator;
+    Link           link(0.0);
+
+    for (int i = 0; i < 40; ++i) link.exchange(estimator, 3000, 1000);
+
+    check(std::abs(link.offsetError(estimator) - 1000) <= 1, "offset error is half the 2 ms asymmetry");
+    check(estimator.minRtt() == 4000, "round trip excludes host processing");
+}
+
+/**
+ * Exchanges stuck in a queue for more than CLOCK_RTT_REJECT_US above the best round trip do not count at all,
+ * even when they fill the window
+ */
+void testOutliers() {
+    ClockEstimator estimator;
+    Link           link(0.0);
+
+    link.exchange(estimator, 1000, 1000);
+    size_t accepted = 0;
+    for (size_t i = 1; i < CLOCK_WINDOW; ++i) {
+        if (link.exchange(estimator, 1000 + CLOCK_RTT_REJECT_US + 5000, 1000)) accepted++;
+    }
+
+    check(accepted == 0, "delayed exchanges are reported as not accepted");
+    check(estimator.minRtt() == 2000, "delayed exchanges leave the minimum round trip alone");
+    check(std::abs(link.offsetError(estimator)) <= 1, "a window of delayed exchanges does not move the offset");
+
+    // Just under the limit they are only down-weighted, enough of them still pull the offset
+    ClockEstimator weighted;
+    Link           near(0.0);
+    near.exchange(weighted, 1000, 1000);
+    for (size_t i = 1; i < CLOCK_WINDOW; ++i) near.exchange(weighted, 1000 + CLOCK_RTT_REJECT_US - 1000, 1000);
+
+    check(near.offsetError(weighted) > 50, "exchanges under the limit are weighted, not dropped");
+}
+
+}  // namespace
+
+int main() {
+    testDrift();
+    testAsymmetry();
+    testOutliers();
+
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
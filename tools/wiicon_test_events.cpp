@@ -0,0 +1,204 @@
+/**
+ * @file        wiicon_test_events.cpp
+ * @brief       Host test of the reliable event queue
+ *
+ * @details     Drives EventQueue from wiicon_event.h through the same encoder and decoder the
+ *              firmware and wiicon_events use, with a simulated host that drops chosen
+ *              acknowledgements. Checks that an event posted before the identity is set is
+ *              still acknowledged, that a lost acknowledgement leads to a retransmission after
+ *              the timeout, that a later acknowledgement triggers a fast retransmit, and that
+ *              an event is given up after EVENT_MAX_ATTEMPTS. Exits non-zero on failure.
+ *
+ *              Build: g++ -std=c++17 -O2 -Wall -Wextra -I.. wiicon_test_events.cpp \
+ *                         -o wiicon_test_events
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include <cstdio>
+
+#include "wiicon_event.h"
+
+namespace {
+
+const uint8_t  DEVICE_ID = 42;         /**< Identity set on the queues under test */
+const uint32_t SESSION   = 0x5EED1234; /**< Session set on the queues under test */
+
+int failures = 0; /**< Failed checks */
+
+void check(bool condition, const char* name) {
+    printf("%s %s\n", condition ? "PASS" : "FAIL", name);
+    if (!condition) failures++;
+}
+
+/**
+ * Host side of the channel: decodes what the queue sends and answers unless told to drop
+ */
+struct Host {
+    WiiconEvent last{};           /**< Last event received */
+    size_t      received = 0;     /**< Events received, retransmissions included */
+    bool        drop     = false; /**< Whether acknowledgements are lost */
+
+    /**
+     * Run one service pass and feed the acknowledgements back
+     * @return Number of transmissions
+     */
+    size_t exchange(EventQueue& queue, uint32_t now) {
+        WiiconEvent acks[EVENT_QUEUE_SIZE];
+        size_t      ackCount = 0;
+
+        size_t sent = queue.service(now, [&](const WiiconEvent& event) {
+            uint8_t datagram[EVENT_MAX_SIZE];
+            uint8_t reply[EVENT_MAX_SIZE];
+            size_t  length = eventEncode(event, datagram);
+
+            if (!eventDecode(datagram, length, &last)) return;
+            received++;
+            if (drop) return;
+
+            size_t replyLength = eventAckEncode(last, reply);
+            if (eventAckDecode(reply, replyLength, &acks[ackCount])) ackCount++;
+        });
+
+        for (size_t i = 0; i < ackCount; ++i) queue.acknowledge(acks[i], now);
+        return sent;
+    }
+};
+
+/**
+ * An event posted before the identity is known carries it once sent, so the host's acknowledgement matches
+ */
+void testPostBeforeIdentity() {
+    EventQueue queue;
+    Host       host;
+
+    queue.post(EVENT_MODE, 1, 0);
+    queue.setIdentity(DEVICE_ID, SESSION);
+    host.exchange(queue, 0);
+
+    check(host.last.deviceId == DEVICE_ID && host.last.session == SESSION,
+          "an event posted before begin carries the identity");
+    check(queue.idle() && queue.stats().acked == 1, "its acknowledgement is accepted");
+}
+
+/**
+ * A lost acknowledgement is recovered by a retransmission once the timeout passes, not before
+ */
+void testRetransmit() {
+    EventQueue queue;
+    Host       host;
+    queue.setIdentity(DEVICE_ID, SESSION);
+
+    host.drop = true;
+    queue.post(EVENT_MODE, 0, 0);
+    host.exchange(queue, 0);
+    uint16_t sequence = host.last.sequence;
+
+    size_t early = host.exchange(queue, EVENT_RTO_MS - 1);
+    host.drop    = false;
+    size_t due   = host.exchange(queue, EVENT_RTO_MS);
+
+    check(early == 0, "no retransmission before the timeout");
+    check(due == 1 && host.last.sequence == sequence, "the event is retransmitted after the timeout");
+    check(queue.idle() && queue.stats().retransmits == 1, "the retransmission is acknowledged");
+}
+
+/**
+ * An acknowledgement for a later event makes an earlier unacknowledged one due at once
+ */
+void testFastRetransmit() {
+    EventQueue queue;
+    Host       host;
+    queue.setIdentity(DEVICE_ID, SESSION);
+
+    // The first event is lost on the way back, the second is acknowledged
+    host.drop = true;
+    queue.post(EVENT_MODE, 0, 0);
+    host.exchange(queue, 0);
+    uint16_t lost = host.last.sequence;
+
+    host.drop = false;
+    queue.post(EVENT_MODE, 1, 1);
+    host.exchange(queue, 1);
+
+    check(queue.stats().fastRetransmits == 1, "a later acknowledgement triggers a fast retransmit");
+
+    // Well before the timeout of the first event
+    size_t sent = host.exchange(queue, 2);
+    check(sent == 1 && host.last.sequence == lost, "the earlier event is resent before its timeout");
+    check(queue.idle() && queue.stats().retransmits == 0, "the fast retransmit is acknowledged");
+}
+
+/**
+ * An event nobody acknowledges is sent EVENT_MAX_ATTEMPTS times and then given up
+ */
+void testExpiry() {
+    EventQueue queue;
+    Host       host;
+    queue.setIdentity(DEVICE_ID, SESSION);
+
+    host.drop = true;
+    queue.post(EVENT_MODE, 0, 0);
+    for (uint32_t now = 0; now <= EVENT_MAX_ATTEMPTS * EVENT_RTO_MAX_MS; now += EVENT_RTO_MAX_MS / 4) {
+        host.exchange(queue, now);
+    }
+
+    check(host.received == EVENT_MAX_ATTEMPTS, "an unacknowledged event is sent EVENT_MAX_ATTEMPTS times");
+    check(queue.idle() && queue.stats().expired == 1, "then it expires");
+}
+
+/**
+ * Acknowledgements from another device or an earlier boot are ignored
+ */
+void testForeignAck() {
+    EventQueue queue;
+    Host       host;
+    queue.setIdentity(DEVICE_ID, SESSION);
+
+    host.drop = true;
+    queue.post(EVENT_MODE, 0, 0);
+    host.exchange(queue, 0);
+
+    WiiconEvent ack = host.last;
+    ack.session++;
+    check(!queue.acknowledge(ack, 0) && !queue.idle(), "an acknowledgement from another session is ignored");
+}
+
+}  // namespace
+
+int main() {
+    testPostBeforeIdentity();
+    testRetransmit();
+    testFastRetransmit();
+    testExpiry();
+    testForeignAck();
+
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,293 @@
+/**
+ * @file        wiicon_test_osc.cpp
+ * @brief       Host test of the OSC send path
+ *
+ * @details     Builds the firmware's OSC manager for the host and streams samples through
+ *              LoopbackTransport destinations next to the primary UDP target. Every heap
+ *              allocation is counted (operator new, and malloc on glibc), and the test fails
+ *              if a sample allocates once the transports are up. The captured packets are
+ *              compared byte for byte with osc::Message and frameEncode() output, and the
+ *              data mode and decimation of a destination are checked, as is the primary
+ *              destination other senders read after a target change. Exits non-zero on
+ *              failure.
+ *
+ *              Build: g++ -std=c++20 -O2 -Wall -Wextra -Ihost -I.. wiicon_test_osc.cpp \
+ *                         host/firmware_fakes.cpp ../osc_manager.cpp ../rate_controller.cpp \
+ *                         ../udp_transport.cpp ../loopback_transport.cpp ../serial_link.cpp \
+ *                         ../websocket_transport.cpp ../boot_profiler.cpp ../logger.cpp \
+ *                         -o wiicon_test_osc
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <new>
+
+#include "loopback_transport.h"
+#include "osc_manager.h"
+#include "osc_message.h"
+#include "wiicon_frame.h"
+
+// ----------------------------------------------------------------------------
+// Counting allocator
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool   countAllocations = false; /**< Whether allocations are counted now */
+size_t allocations      = 0;     /**< Allocations counted */
+
+void recordAllocation() {
+    if (countAllocations) allocations++;
+}
+
+}  // namespace
+
+#if defined(__GLIBC__)
+// Catches C allocations too; operator new below goes through malloc and is counted here
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+
+void* malloc(size_t size) {
+    recordAllocation();
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    recordAllocation();
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size) {
+    recordAllocation();
+    return __libc_realloc(pointer, size);
+}
+}
+#define MALLOC_COUNTED 1
+#else
+#define MALLOC_COUNTED 0
+#endif
+
+void* operator new(size_t size) {
+    if (!MALLOC_COUNTED) recordAllocation();
+    void* pointer = malloc(size > 0 ? size : 1);
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void  operator delete(void* pointer) noexcept { free(pointer); }
+void  operator delete[](void* pointer) noexcept { free(pointer); }
+void  operator delete(void* pointer, size_t) noexcept { free(pointer); }
+void  operator delete[](void* pointer, size_t) noexcept { free(pointer); }
+
+// ----------------------------------------------------------------------------
+// Test
+// ----------------------------------------------------------------------------
+
+namespace {
+
+const size_t   WARMUP_SAMPLES = 8;    /**< Samples sent before counting, they start the transports */
+const size_t   TEST_SAMPLES   = 2000; /**< Samples counted */
+const uint16_t LOOPBACK_PORT  = 9100; /**< Port of the destination subscribed to every stream */
+const uint16_t MODE_PORT      = 9200; /**< Port of the destination following the data mode */
+
+using EulerMessage = osc::Message<OSC_ADDRESS_EULER, float, float, float>;
+using AccelMessage = osc::Message<OSC_ADDRESS_ACCEL, float, float, float>;
+using GyroMessage  = osc::Message<OSC_ADDRESS_GYRO, float, float, float>;
+
+int failures = 0; /**< Failed checks */
+
+void check(bool condition, const char* name) {
+    printf("%s %s\n", condition ? "PASS" : "FAIL", name);
+    if (!condition) failures++;
+}
+
+OscSample makeSample(size_t index) {
+    float     t = (float)index * 0.01f;
+    OscSample sample{};
+    for (int i = 0; i < 3; ++i) {
+        sample.euler[i] = 30.0f * sinf(t + (float)i);
+        sample.accel[i] = 0.5f * cosf(t + (float)i);
+        sample.gyro[i]  = 100.0f * sinf(2.0f * t + (float)i);
+    }
+    sample.quat[0]   = 1.0f;
+    sample.timestamp = (uint32_t)(index * 10000);
+    return sample;
+}
+
+/**
+ * Every sample reaches the loopback destination without touching the heap
+ */
+void testNoAllocation(LoopbackTransport& loopback) {
+    for (size_t i = 0; i < WARMUP_SAMPLES; ++i) oscManager.sendSample(makeSample(i), DataMode::FILTERED);
+    loopback.clear();
+
+    uint32_t failuresBefore = oscManager.getTotalFailures();
+
+    allocations      = 0;
+    countAllocations = true;
+    for (size_t i = 0; i < TEST_SAMPLES; ++i) {
+        // Both data modes, and a target change halfway as after a WiFi IP event
+        if (i == TEST_SAMPLES / 2) oscManager.invalidateTarget();
+        oscManager.sendSample(makeSample(i), i % 2 ? DataMode::RAW : DataMode::FILTERED);
+    }
+    countAllocations = false;
+
+    // Euler, accelerometer, gyroscope and a frame per sample
+    printf("     %zu samples, %lu packets, %zu allocations\n", TEST_SAMPLES, (unsigned long)loopback.count(),
+           allocations);
+    check(allocations == 0, "sendSample() does not allocate");
+    check(loopback.count() == TEST_SAMPLES * 4, "every stream reaches the loopback destination");
+    check(oscManager.getTotalFailures() == failuresBefore, "no send failed");
+}
+
+/**
+ * Whether a captured packet holds exactly the expected bytes
+ */
+bool samePacket(const LoopbackTransport::Packet& packet, uint16_t port, const uint8_t* expected, size_t length) {
+    return length > 0 && packet.port == port && packet.length == length && memcmp(packet.data, expected, length) == 0;
+}
+
+/**
+ * Whether a captured packet is the three-float message of a stream
+ */
+template <typename Message>
+bool sameMessage(const LoopbackTransport::Packet& packet, uint16_t port, const float (&values)[3]) {
+    uint8_t expected[OSCManager::BUFFER_SIZE];
+    size_t  length = Message::encode(expected, values[0], values[1], values[2]);
+    return samePacket(packet, port, expected, length);
+}
+
+/**
+ * Whether a captured packet is the frame of a sample
+ */
+bool sameFrame(const LoopbackTransport::Packet& packet, uint16_t port, const OscSample& sample, uint16_t sequence) {
+    WiiconFrame frame;
+    frame.flags     = FRAME_HAS_ACCEL | FRAME_HAS_GYRO | FRAME_HAS_QUAT;
+    frame.deviceId  = oscManager.getDeviceId();
+    frame.sequence  = sequence;
+    frame.timestamp = sample.timestamp;
+    for (int i = 0; i < 3; ++i) {
+        frame.accel[i] = frameQuantize(sample.accel[i], FRAME_ACC_LSB_PER_G);
+        frame.gyro[i]  = frameQuantize(sample.gyro[i], FRAME_GYR_LSB_PER_DPS);
+    }
+    for (int i = 0; i < 4; ++i) frame.quat[i] = sample.quat[i];
+
+    uint8_t expected[FRAME_MAX_SIZE];
+    return samePacket(packet, port, expected, frameEncode(frame, expected, sizeof(expected)));
+}
+
+/**
+ * The bytes on the wire are the ones osc::Message and frameEncode() produce for the sample
+ */
+void testEncoding(LoopbackTransport& loopback) {
+    OscSample first  = makeSample(TEST_SAMPLES + 1);
+    OscSample second = makeSample(TEST_SAMPLES + 2);
+
+    // The sequence is internal, take it from the first frame and expect the next one on the second
+    loopback.clear();
+    oscManager.sendSample(first, DataMode::FILTERED);
+    const LoopbackTransport::Packet& last = loopback.packet(0);
+    WiiconFrame                      frame{};
+    bool                             decoded  = loopback.count() == 4 && frameDecode(last.data, last.length, &frame);
+    uint16_t                         sequence = frame.sequence;
+
+    check(decoded, "one sample sends four packets, the last a frame");
+    check(sameMessage<EulerMessage>(loopback.packet(3), LOOPBACK_PORT, first.euler), "euler matches osc::Message");
+    check(sameMessage<AccelMessage>(loopback.packet(2), LOOPBACK_PORT, first.accel), "accel matches osc::Message");
+    check(sameMessage<GyroMessage>(loopback.packet(1), LOOPBACK_PORT, first.gyro), "gyro matches osc::Message");
+    check(sameFrame(loopback.packet(0), LOOPBACK_PORT, first, sequence), "frame matches frameEncode()");
+
+    loopback.clear();
+    oscManager.sendSample(second, DataMode::RAW);
+    check(loopback.count() == 4 && sameFrame(loopback.packet(0), LOOPBACK_PORT, second, (uint16_t)(sequence + 1)),
+          "the next frame takes the next sequence number");
+}
+
+/**
+ * A destination following the data mode gets euler in FILTERED and accel/gyro in RAW, every other sample
+ */
+void testModeAndDecimation(LoopbackTransport& modeLoopback) {
+    OscSample filtered = makeSample(TEST_SAMPLES + 3);
+    OscSample raw      = makeSample(TEST_SAMPLES + 4);
+
+    // Two samples per mode, exactly one of each pair passes a decimation of 2 whatever the counter was
+    modeLoopback.clear();
+    oscManager.sendSample(filtered, DataMode::FILTERED);
+    oscManager.sendSample(filtered, DataMode::FILTERED);
+    oscManager.sendSample(raw, DataMode::RAW);
+    oscManager.sendSample(raw, DataMode::RAW);
+
+    check(modeLoopback.count() == 3, "decimation of 2 keeps one sample in two");
+    check(modeLoopback.count() == 3 && sameMessage<EulerMessage>(modeLoopback.packet(2), MODE_PORT, filtered.euler),
+          "FILTERED mode sends euler");
+    check(modeLoopback.count() == 3 && sameMessage<AccelMessage>(modeLoopback.packet(1), MODE_PORT, raw.accel) &&
+              sameMessage<GyroMessage>(modeLoopback.packet(0), MODE_PORT, raw.gyro),
+          "RAW mode sends accel and gyro");
+}
+
+/**
+ * Senders other than sendSample() see a target change right away
+ */
+void testPrimaryDestination() {
+    IPAddress receiver(192, 168, 1, 77);
+
+    oscManager.setDiscoveredTarget(receiver, 9300);
+    const OscDestination& primary = oscManager.getPrimaryDestination();
+    check(primary.ip == receiver && primary.port == 9300, "getPrimaryDestination() resolves a changed target");
+}
+
+}  // namespace
+
+int main() {
+    Log::setLevel(LOG_LEVEL_WARNING);
+
+    LoopbackTransport loopback;
+    LoopbackTransport modeLoopback;
+    oscManager.begin();
+    oscManager.addDestination(IPAddress(127, 0, 0, 1), LOOPBACK_PORT,
+                              OSC_STREAM_EULER | OSC_STREAM_RAW | OSC_STREAM_FRAME, 1, &loopback);
+    oscManager.addDestination(IPAddress(127, 0, 0, 1), MODE_PORT, OSC_STREAM_MODE, 2, &modeLoopback);
+
+    testNoAllocation(loopback);
+    testEncoding(loopback);
+    testModeAndDecimation(modeLoopback);
+    testPrimaryDestination();
+
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file        wiicon_test_reassembler.cpp
+ * @brief       Host test of the redundant frame reassembler
+ *
+ * @details     Encodes a frame stream the way the firmware does with OSC_FRAME_REDUNDANCY = K
+ *              (each datagram a bundle of the new frame and the previous K), drops a run of
+ *              consecutive datagrams and feeds the rest to FrameReassembler. For every K up to
+ *              FRAME_MAX_REDUNDANCY, losing 1 to K datagrams in a row must deliver every frame
+ *              once, in order, with no gap; losing K + 1 must leave exactly one gap of one
+ *              frame. The stream crosses the 16-bit sequence wrap. Exits non-zero on failure.
+ *
+ *              Build: g++ -std=c++17 -O2 -Wall -Wextra -I.. wiicon_test_reassembler.cpp \
+ *                         -o wiicon_test_reassembler
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include <cstdio>
+
+#include "wiicon_reassembler.h"
+
+namespace {
+
+const size_t   STREAM_FRAMES  = 40;    /**< Frames sent per run */
+const size_t   FIRST_DROPPED  = 12;    /**< Index of the first lost datagram */
+const uint16_t FIRST_SEQUENCE = 65520; /**< Start close to the wrap so it falls inside the run */
+
+int failures = 0; /**< Failed checks */
+
+void check(bool condition, const char* name, size_t redundancy, size_t dropped) {
+    printf("%s K=%zu, %zu lost: %s\n", condition ? "PASS" : "FAIL", redundancy, dropped, name);
+    if (!condition) failures++;
+}
+
+/**
+ * Sender side, keeps the last frames and bundles them like OSCManager::encodeFrame()
+ */
+class Sender {
+   public:
+    explicit Sender(size_t redundancy) : _redundancy(redundancy), _count(0), _head(0), _lengths{} {}
+
+    /**
+     * Encode the next datagram
+     * @return Datagram length
+     */
+    size_t next(uint16_t sequence, uint8_t* out, size_t capacity) {
+        WiiconFrame frame{};
+        frame.flags     = FRAME_HAS_ACCEL | FRAME_HAS_GYRO;
+        frame.deviceId  = 7;
+        frame.sequence  = sequence;
+        frame.timestamp = (uint32_t)sequence * 10000u;
+
+        if (_redundancy == 0) return frameEncode(frame, out, capacity);
+
+        _head           = (_head + 1) % HISTORY;
+        _lengths[_head] = frameEncode(frame, _history[_head], FRAME_MAX_SIZE);
+        if (_count < _redundancy + 1) _count++;
+
+        const uint8_t* frames[HISTORY];
+        size_t         lengths[HISTORY];
+        for (size_t i = 0; i < _count; ++i) {
+            size_t slot = (_head + HISTORY - i) % HISTORY;
+            frames[i]   = _history[slot];
+            lengths[i]  = _lengths[slot];
+        }
+        return frameBundleEncode(frames, lengths, _count, out, capacity);
+    }
+
+   private:
+    static constexpr size_t HISTORY = 1 + FRAME_MAX_REDUNDANCY; /**< Frames kept */
+
+    size_t  _redundancy;                       /**< Previous frames repeated per datagram */
+    size_t  _count;                            /**< Frames in the history */
+    size_t  _head;                             /**< Slot of the newest frame */
+    uint8_t _history[HISTORY][FRAME_MAX_SIZE]; /**< Encoded frames */
+    size_t  _lengths[HISTORY];                 /**< Length of each encoded frame */
+};
+
+/**
+ * What the receiver saw in one run
+ */
+struct Result {
+    size_t delivered  = 0; /**< Frames delivered */
+    size_t duplicates = 0; /**< Frames delivered more than once */
+    size_t gaps       = 0; /**< Places where the delivered sequence skips */
+    size_t missing    = 0; /**< Frames never delivered */
+    size_t outOfOrder = 0; /**< Frames delivered after a newer one */
+};
+
+/**
+ * Send a stream with redundancy K and lose a run of consecutive datagrams
+ */
+Result run(size_t redundancy, size_t dropped) {
+    Sender           sender(redundancy);
+    FrameReassembler reassembler;
+    Result           result;
+    bool             seen[STREAM_FRAMES] = {};
+    bool             started             = false;
+    uint16_t         last                = 0;
+
+    for (size_t i = 0; i < STREAM_FRAMES; ++i) {
+        uint8_t datagram[FRAME_BUNDLE_HEADER_SIZE + (1 + FRAME_MAX_REDUNDANCY) * FRAME_MAX_SIZE];
+        size_t  length = sender.next((uint16_t)(FIRST_SEQUENCE + i), datagram, sizeof(datagram));
+        if (i >= FIRST_DROPPED && i < FIRST_DROPPED + dropped) continue;
+
+        reassembler.push(datagram, length, [&](const WiiconFrame& frame, bool) {
+            size_t index = (uint16_t)(frame.sequence - FIRST_SEQUENCE);
+            if (index < STREAM_FRAMES && seen[index]) result.duplicates++;
+            if (index < STREAM_FRAMES) seen[index] = true;
+
+            int16_t step = (int16_t)(frame.sequence - last);
+            if (started && step > 1) result.gaps++;
+            if (started && step <= 0) result.outOfOrder++;
+            started = true;
+            last    = frame.sequence;
+            result.delivered++;
+        });
+    }
+
+    for (bool delivered : seen) {
+        if (!delivered) result.missing++;
+    }
+    return result;
+}
+
+}  // namespace
+
+int main() {
+    for (size_t redundancy = 0; redundancy <= FRAME_MAX_REDUNDANCY; ++redundancy) {
+        // Every run the bundle can cover is recovered without a trace
+        for (size_t dropped = 1; dropped <= redundancy; ++dropped) {
+            Result result = run(redundancy, dropped);
+            check(result.gaps == 0 && result.missing == 0, "no gap", redundancy, dropped);
+            check(result.duplicates == 0 && result.outOfOrder == 0 && result.delivered == STREAM_FRAMES,
+                  "every frame once, in order", redundancy, dropped);
+        }
+
+        // One more and the oldest lost frame is gone for good
+        Result result = run(redundancy, redundancy + 1);
+        check(result.gaps == 1 && result.missing == 1, "exactly one gap of one frame", redundancy, redundancy + 1);
+        check(result.duplicates == 0 && result.outOfOrder == 0, "no duplicate", redundancy, redundancy + 1);
+    }
+
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,432 @@
+/**
+ * @file        wiicon_ws.cpp
+ * @brief       Host WebSocket client for the WiiCon binary frame stream
+ *
+ * @details     Connects to the /ws endpoint of a controller in station mode, decodes the
+ *              binary frames (wiicon_frame.h) and prints the received rate, the arrival gaps,
+ *              the sequence numbers skipped by the rate limit or by drops, and the current
+ *              orientation. Run several instances to try the client limit.
+ *
+ *              Build: g++ -std=c++17 -O2 -I.. wiicon_ws.cpp -o wiicon_ws
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "wiicon_frame.h"
+
+namespace {
+
+const uint8_t WS_OPCODE_CONTINUATION = 0x0;
+const uint8_t WS_OPCODE_TEXT         = 0x1;
+const uint8_t WS_OPCODE_BINARY       = 0x2;
+const uint8_t WS_OPCODE_CLOSE        = 0x8;
+const uint8_t WS_OPCODE_PING         = 0x9;
+const uint8_t WS_OPCODE_PONG         = 0xA;
+
+volatile sig_atomic_t stopRequested = 0;
+
+void onSignal(int) { stopRequested = 1; }
+
+double nowSeconds() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+struct Options {
+    const char* host     = nullptr;
+    const char* port     = "80";
+    const char* path     = "/ws";
+    double      interval = 1.0;
+    double      duration = 0.0;
+};
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s --connect HOST[:PORT] [--path PATH] [--interval SEC] [--duration SEC]\n"
+            "  --connect HOST[:PORT] controller address (port default 80)\n"
+            "  --path PATH           WebSocket endpoint (default /ws)\n"
+            "  --interval SEC        report interval (default 1)\n"
+            "  --duration SEC        stop after this many seconds (default: run until Ctrl+C)\n",
+            argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--connect") && hasValue) {
+            char* target  = argv[++i];
+            char* colon   = strrchr(target, ':');
+            options->host = target;
+            if (colon) {
+                *colon        = '\0';
+                options->port = colon + 1;
+            }
+        } else if (!strcmp(argv[i], "--path") && hasValue) {
+            options->path = argv[++i];
+        } else if (!strcmp(argv[i], "--interval") && hasValue) {
+            options->interval = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--duration") && hasValue) {
+            options->duration = atof(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return options->host != nullptr && options->interval > 0.0;
+}
+
+std::string base64(const uint8_t* data, size_t length) {
+    static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string out;
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t chunk = (uint32_t)data[i] << 16;
+        if (i + 1 < length) chunk |= (uint32_t)data[i + 1] << 8;
+        if (i + 2 < length) chunk |= data[i + 2];
+
+        out += ALPHABET[(chunk >> 18) & 0x3F];
+        out += ALPHABET[(chunk >> 12) & 0x3F];
+        out += i + 1 < length ? ALPHABET[(chunk >> 6) & 0x3F] : '=';
+        out += i + 2 < length ? ALPHABET[chunk & 0x3F] : '=';
+    }
+    return out;
+}
+
+int connectTo(const char* host, const char* port) {
+    addrinfo hints{};
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* results = nullptr;
+    if (getaddrinfo(host, port, &hints, &results) != 0) return -1;
+
+    int fd = -1;
+    for (addrinfo* result = results; result && fd < 0; result = result->ai_next) {
+        fd = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+        if (fd < 0) continue;
+        if (connect(fd, result->ai_addr, result->ai_addrlen) < 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(results);
+
+    if (fd >= 0) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return fd;
+}
+
+bool sendAll(int fd, const uint8_t* data, size_t length) {
+    while (length > 0) {
+        ssize_t sent = send(fd, data, length, MSG_NOSIGNAL);
+        if (sent <= 0) return false;
+        data += sent;
+        length -= (size_t)sent;
+    }
+    return true;
+}
+
+/**
+ * Send the HTTP upgrade request and wait for 101 Switching Protocols
+ * Bytes received after the response headers are left in buffer.
+ */
+bool handshake(int fd, const Options& options, std::vector<uint8_t>* buffer) {
+    std::random_device random;
+    uint8_t            nonce[16];
+    for (uint8_t& byte : nonce) byte = (uint8_t)random();
+
+    std::string request = std::string("GET ") + options.path + " HTTP/1.1\r\n" + "Host: " + options.host + ":" +
+                          options.port + "\r\n" +
+                          "Upgrade: websocket\r\n"
+                          "Connection: Upgrade\r\n"
+                          "Sec-WebSocket-Key: " +
+                          base64(nonce, sizeof(nonce)) +
+                          "\r\n"
+                          "Sec-WebSocket-Version: 13\r\n\r\n";
+    if (!sendAll(fd, (const uint8_t*)request.data(), request.size())) return false;
+
+    std::string response;
+    uint8_t     chunk[1024];
+    size_t      end;
+
+    while ((end = response.find("\r\n\r\n")) == std::string::npos) {
+        ssize_t length = recv(fd, chunk, sizeof(chunk), 0);
+        if (length <= 0 || response.size() > 8192) return false;
+        response.append((const char*)chunk, (size_t)length);
+    }
+
+    std::string status = response.substr(0, response.find("\r\n"));
+    if (status.find(" 101") == std::string::npos) {
+        fprintf(stderr, "Upgrade refused: %s\n", status.c_str());
+        return false;
+    }
+
+    buffer->assign(response.begin() + end + 4, response.end());
+    return true;
+}
+
+/**
+ * Send a control frame, masked as every client frame must be
+ */
+bool sendControl(int fd, uint8_t opcode, const uint8_t* payload, size_t length) {
+    if (length > 125) return false;
+
+    uint8_t frame[2 + 4 + 125];
+    frame[0] = 0x80 | opcode;
+    frame[1] = 0x80 | (uint8_t)length;
+
+    std::random_device random;
+    for (int i = 0; i < 4; ++i) frame[2 + i] = (uint8_t)random();
+    for (size_t i = 0; i < length; ++i) frame[6 + i] = payload[i] ^ frame[2 + (i % 4)];
+
+    return sendAll(fd, frame, 6 + length);
+}
+
+/**
+ * Split the next complete WebSocket frame off the front of buffer
+ * @return Frame size in bytes, 0 if buffer does not hold a complete frame yet
+ */
+size_t parseFrame(const std::vector<uint8_t>& buffer, uint8_t* opcode, bool* fin, size_t* payloadStart,
+                  size_t* payloadLength) {
+    if (buffer.size() < 2) return 0;
+
+    *fin          = buffer[0] & 0x80;
+    *opcode       = buffer[0] & 0x0F;
+    bool     mask = buffer[1] & 0x80;
+    uint64_t size = buffer[1] & 0x7F;
+    size_t   i    = 2;
+
+    if (size == 126) {
+        if (buffer.size() < i + 2) return 0;
+        size = (uint64_t)buffer[i] << 8 | buffer[i + 1];
+        i += 2;
+    } else if (size == 127) {
+        if (buffer.size() < i + 8) return 0;
+        size = 0;
+        for (int b = 0; b < 8; ++b) size = size << 8 | buffer[i + b];
+        i += 8;
+    }
+
+    // Servers never mask, a masked frame is skipped as a whole
+    if (mask) i += 4;
+    if (buffer.size() < i + size) return 0;
+
+    *payloadStart  = i;
+    *payloadLength = mask ? 0 : (size_t)size;
+    return i + (size_t)size;
+}
+
+/**
+ * Same conversion as getEulerAngles() in the firmware
+ */
+void quaternionToEuler(const float q[4], float* roll, float* pitch, float* yaw) {
+    const float toDeg = 180.0f / (float)M_PI;
+
+    *roll  = atan2f(2.0f * (q[0] * q[1] + q[2] * q[3]), 1.0f - 2.0f * (q[1] * q[1] + q[2] * q[2])) * toDeg;
+    *pitch = asinf(fmaxf(-1.0f, fminf(1.0f, 2.0f * (q[0] * q[2] - q[3] * q[1])))) * toDeg;
+    *yaw   = atan2f(2.0f * (q[0] * q[3] + q[1] * q[2]), 1.0f - 2.0f * (q[2] * q[2] + q[3] * q[3])) * toDeg;
+}
+
+/**
+ * Frames received over one report interval
+ */
+struct Interval {
+    uint64_t    frames   = 0;
+    uint64_t    bytes    = 0;
+    uint64_t    skipped  = 0;
+    uint64_t    invalid  = 0;
+    double      gapSum   = 0.0;
+    double      gapMax   = 0.0;
+    WiiconFrame last     = {};
+    bool        hasFrame = false;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    int fd = connectTo(options.host, options.port);
+    if (fd < 0) {
+        fprintf(stderr, "Cannot connect to %s:%s\n", options.host, options.port);
+        return 1;
+    }
+
+    std::vector<uint8_t> buffer;
+    if (!handshake(fd, options, &buffer)) {
+        close(fd);
+        return 1;
+    }
+    printf("Connected to ws://%s:%s%s\n", options.host, options.port, options.path);
+    fflush(stdout);
+
+    std::vector<uint8_t> message;
+    uint8_t              messageOpcode = 0;
+    Interval             interval;
+    uint64_t             totalFrames  = 0;
+    uint64_t             totalSkipped = 0;
+    bool                 hasSequence  = false;
+    uint16_t             lastSequence = 0;
+    double               lastArrival  = 0.0;
+    double               start        = nowSeconds();
+    double               lastReport   = start;
+    bool                 connected    = true;
+
+    auto onBinary = [&](const uint8_t* data, size_t length, double arrival) {
+        WiiconFrame frame;
+        if (!frameDecode(data, length, &frame)) {
+            interval.invalid++;
+            return;
+        }
+
+        // Gaps in the sequence are samples the rate limit skipped or frames dropped for this client
+        if (hasSequence) interval.skipped += (uint16_t)(frame.sequence - lastSequence - 1);
+        if (lastArrival > 0.0) {
+            double gap = arrival - lastArrival;
+            interval.gapSum += gap;
+            if (gap > interval.gapMax) interval.gapMax = gap;
+        }
+
+        hasSequence       = true;
+        lastSequence      = frame.sequence;
+        lastArrival       = arrival;
+        interval.last     = frame;
+        interval.hasFrame = true;
+        interval.frames++;
+        interval.bytes += length;
+    };
+
+    while (!stopRequested && connected) {
+        double now = nowSeconds();
+        if (options.duration > 0.0 && now - start >= options.duration) break;
+
+        if (now - lastReport >= options.interval) {
+            double elapsed = now - lastReport;
+            if (interval.hasFrame) {
+                float roll, pitch, yaw;
+                quaternionToEuler(interval.last.quat, &roll, &pitch, &yaw);
+                printf("device %3u  %6.1f frames/s  %7.0f B/s  gap mean %5.1f max %6.1f ms  skipped %4llu  "
+                       "roll %7.1f pitch %6.1f yaw %7.1f\n",
+                       interval.last.deviceId, interval.frames / elapsed, interval.bytes / elapsed,
+                       interval.frames > 1 ? interval.gapSum / (interval.frames - 1) * 1000.0 : 0.0,
+                       interval.gapMax * 1000.0, (unsigned long long)interval.skipped, roll, pitch, yaw);
+            } else {
+                printf("no frames\n");
+            }
+            if (interval.invalid) printf("  %llu invalid messages\n", (unsigned long long)interval.invalid);
+            fflush(stdout);
+
+            totalFrames += interval.frames;
+            totalSkipped += interval.skipped;
+            interval   = Interval();
+            lastReport = now;
+        }
+
+        // Bytes that arrived with the handshake response are parsed before waiting for more
+        double  arrival = nowSeconds();
+        uint8_t opcode;
+        bool    fin;
+        size_t  payloadStart, payloadLength, size;
+
+        while ((size = parseFrame(buffer, &opcode, &fin, &payloadStart, &payloadLength)) > 0) {
+            const uint8_t* payload = buffer.data() + payloadStart;
+
+            if (opcode == WS_OPCODE_PING) {
+                sendControl(fd, WS_OPCODE_PONG, payload, payloadLength);
+            } else if (opcode == WS_OPCODE_CLOSE) {
+                unsigned code = payloadLength >= 2 ? (unsigned)(payload[0] << 8 | payload[1]) : 0;
+                fprintf(stderr, "Closed by the device (%u%s%.*s)\n", code, payloadLength > 2 ? ": " : "",
+                        payloadLength > 2 ? (int)payloadLength - 2 : 0, (const char*)payload + 2);
+                sendControl(fd, WS_OPCODE_CLOSE, payload, payloadLength >= 2 ? 2 : 0);
+                connected = false;
+            } else if (opcode == WS_OPCODE_BINARY || opcode == WS_OPCODE_TEXT || opcode == WS_OPCODE_CONTINUATION) {
+                // Fragments are joined before decoding, frames from the device normally fit in one
+                if (opcode != WS_OPCODE_CONTINUATION) {
+                    message.clear();
+                    messageOpcode = opcode;
+                }
+                message.insert(message.end(), payload, payload + payloadLength);
+                if (fin && messageOpcode == WS_OPCODE_BINARY) onBinary(message.data(), message.size(), arrival);
+            }
+
+            buffer.erase(buffer.begin(), buffer.begin() + size);
+        }
+        if (!connected) break;
+
+        pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 100) <= 0) continue;
+
+        uint8_t chunk[4096];
+        ssize_t length = recv(fd, chunk, sizeof(chunk), 0);
+        if (length <= 0) {
+            fprintf(stderr, "Connection closed by the device\n");
+            break;
+        }
+        buffer.insert(buffer.end(), chunk, chunk + length);
+    }
+
+    if (connected) {
+        const uint8_t goingAway[] = {0x03, 0xE9};  // 1001
+        sendControl(fd, WS_OPCODE_CLOSE, goingAway, sizeof(goingAway));
+    }
+    close(fd);
+
+    totalFrames += interval.frames;
+    totalSkipped += interval.skipped;
+    printf("%llu frames received, %llu sequence numbers skipped\n", (unsigned long long)totalFrames,
+           (unsigned long long)totalSkipped);
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file        udp_transport.cpp
+ * @brief       UDP output transport implementation for the Wiicon Remote project
+ *
+ * @details     Implements the UdpTransport class declared in udp_transport.h.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "udp_transport.h"
+
+#include "wifi_manager.h"
+
+UdpTransport::UdpTransport()
+    :
+#if OSC_USE_LWIP_TX
+      _acquired(nullptr),
+#endif
+      _started(false) {
+}
+
+bool UdpTransport::begin() {
+    if (_started) return isReady();
+    if (!wifiManager.isConnected()) return false;
+
+#if OSC_USE_LWIP_TX
+    if (!_lwip.begin()) {
+        Log::error("OSC: failed to initialize lwIP sender");
+        return false;
+    }
+#endif
+
+    _started = true;
+    return isReady();
+}
+
+bool UdpTransport::isReady() const { return _started && wifiManager.isConnected() && !wifiManager.isInAPMode(); }
+
+uint8_t* UdpTransport::acquire(uint8_t* fallback) {
+#if OSC_USE_LWIP_TX
+    // Before the sender is up the packet may still be meant for another transport
+    if (!_started) return fallback;
+    _acquired = _lwip.acquire();
+    return _acquired;
+#else
+    return fallback;
+#endif
+}
+
+bool UdpTransport::send(const OscDestination& destination, const uint8_t* data, size_t length) {
+#if OSC_USE_LWIP_TX
+    // A packet encoded elsewhere is copied into a pbuf first
+    if (data != _acquired) {
+        uint8_t* buffer = _lwip.acquire();
+        if (!buffer || length > LwipUdpSender::CAPACITY) return false;
+        memcpy(buffer, data, length);
+        _acquired = buffer;
+    }
+    return _lwip.send(destination.ip, destination.port, length);
+#else
+    return _udp.beginPacket(destination.ip, destination.port) && _udp.write(data, length) == length &&
+           _udp.endPacket();
+#endif
+}
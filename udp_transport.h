@@ -0,0 +1,98 @@
+/**
+ * @file        udp_transport.h
+ * @brief       UDP output transport for the Wiicon Remote project
+ *
+ * @details     Sends OSC packets over WiFi, either through WiFiUDP or, with OSC_USE_LWIP_TX,
+ *              from preallocated lwIP pbufs that the packet is encoded into directly.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef UDP_TRANSPORT_H
+#define UDP_TRANSPORT_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+#include "config.h"
+#include "logger.h"
+#include "osc_transport.h"
+
+#if OSC_USE_LWIP_TX
+#include "lwip_udp_sender.h"
+#endif
+
+class UdpTransport : public OscTransport {
+   public:
+    /**
+     * Constructor
+     */
+    UdpTransport();
+
+    const char* name() const override { return OSC_USE_LWIP_TX ? "lwIP" : "WiFiUDP"; }
+
+    /**
+     * Start the transport once WiFi is connected
+     * @return true if ready to send
+     */
+    bool begin() override;
+
+    /**
+     * Check whether the transport was started and WiFi is connected in station mode
+     * @return true if ready
+     */
+    bool isReady() const override;
+
+    /**
+     * With lwIP, hand out a free pbuf so the packet is encoded straight into it
+     * @param fallback Caller's buffer, used by WiFiUDP
+     * @return Buffer to encode into, nullptr if every pbuf is still in flight
+     */
+    uint8_t* acquire(uint8_t* fallback) override;
+
+    /**
+     * Send one datagram
+     * @param destination Target IP address and port
+     * @param data Datagram
+     * @param length Datagram length in bytes
+     * @return true if the network stack accepted the datagram
+     */
+    bool send(const OscDestination& destination, const uint8_t* data, size_t length) override;
+
+   private:
+#if OSC_USE_LWIP_TX
+    LwipUdpSender _lwip;     /**< Raw lwIP sender, encodes into its pbufs */
+    uint8_t*      _acquired; /**< Payload of the pbuf handed out by acquire() */
+#else
+    WiFiUDP       _udp;      /**< UDP instance for OSC communication */
+#endif
+    bool          _started;  /**< Whether begin() succeeded */
+};
+
+#endif  // UDP_TRANSPORT_H
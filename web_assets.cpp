@@ -0,0 +1,191 @@
+/**
+ * @file        web_assets.cpp
+ * @brief       Compressed, cacheable web assets for the Wiicon Remote project
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "web_assets.h"
+
+#include <LittleFS.h>
+
+#if WEB_ASSETS_EMBEDDED
+#if !__has_include("web_assets_data.h")
+#error "WEB_ASSETS_EMBEDDED needs web_assets_data.h, generate it with tools/wiicon_assets build --header"
+#endif
+#include "web_assets_data.h"
+#endif
+
+namespace {
+
+/**
+ * Content type of a path from its extension
+ */
+const char* contentType(const char* path) {
+    const char* extension = strrchr(path, '.');
+    if (!extension) return "text/plain";
+    if (strcmp(extension, ".html") == 0) return "text/html";
+    if (strcmp(extension, ".css") == 0) return "text/css";
+    if (strcmp(extension, ".js") == 0) return "application/javascript";
+    if (strcmp(extension, ".json") == 0) return "application/json";
+    return "text/plain";
+}
+
+/**
+ * Add the cache headers shared by full and 304 responses
+ */
+void addCacheHeaders(AsyncWebServerResponse* response, const char* type, const char* etag) {
+    char cacheControl[40];
+
+    // Pages are small and must show a firmware update at once, the conditional request keeps the reload cheap
+    if (strcmp(type, "text/html") == 0) {
+        strlcpy(cacheControl, "no-cache", sizeof(cacheControl));
+    } else {
+        snprintf(cacheControl, sizeof(cacheControl), "max-age=%lu", (unsigned long)WEB_ASSET_MAX_AGE_S);
+    }
+
+    response->addHeader("Cache-Control", cacheControl);
+    response->addHeader("ETag", etag);
+    response->addHeader("Vary", "Accept-Encoding");
+}
+
+/**
+ * Answer with 304 if the browser's copy has this ETag
+ * @return true if the request was answered
+ */
+bool sendIfNotModified(AsyncWebServerRequest* request, const char* type, const char* etag) {
+    if (!request->hasHeader("If-None-Match") || request->getHeader("If-None-Match")->value() != etag) return false;
+
+    AsyncWebServerResponse* response = request->beginResponse(304);
+    addCacheHeaders(response, type, etag);
+    request->send(response);
+    return true;
+}
+
+#if !WEB_ASSETS_EMBEDDED
+/**
+ * Quoted FNV-1a hash of a file, the same ETag tools/wiicon_assets gives embedded assets
+ * @return false if the file cannot be read
+ */
+bool fileEtag(const char* path, char* etag, size_t size) {
+    File file = LittleFS.open(path);
+    if (!file || file.isDirectory()) return false;
+
+    uint32_t hash = 2166136261u;
+    uint8_t  chunk[256];
+    size_t   length;
+
+    while ((length = file.read(chunk, sizeof(chunk))) > 0) {
+        for (size_t i = 0; i < length; ++i) hash = (hash ^ chunk[i]) * 16777619u;
+    }
+    file.close();
+
+    snprintf(etag, size, "\"%08lx\"", (unsigned long)hash);
+    return true;
+}
+
+/**
+ * ETags of the LittleFS files of an asset, which only change with a filesystem upload and the restart after it
+ */
+struct FileEtags {
+    char path[32];  /**< Request path */
+    bool hasPlain;  /**< Whether the uncompressed file exists */
+    bool hasGzip;   /**< Whether the .gz copy exists */
+    char plain[12]; /**< ETag of the uncompressed file */
+    char gzip[12];  /**< ETag of the .gz copy */
+};
+
+const size_t FILE_ETAG_SLOTS = 4; /**< Asset paths remembered, the portal and the dashboard serve three */
+
+FileEtags fileEtags[FILE_ETAG_SLOTS]; /**< Hashed assets */
+size_t    fileEtagCount = 0;          /**< Used slots */
+FileEtags uncachedEtags;              /**< Paths that do not fit the table, hashed on every request */
+
+/**
+ * Get the ETags of an asset, hashing its files on the first request only
+ * Requests are handled in the async TCP task, so the table needs no lock.
+ */
+const FileEtags& etagsOf(const char* path) {
+    for (size_t i = 0; i < fileEtagCount; ++i) {
+        if (strcmp(fileEtags[i].path, path) == 0) return fileEtags[i];
+    }
+
+    bool       cacheable = fileEtagCount < FILE_ETAG_SLOTS && strlen(path) < sizeof(FileEtags::path);
+    FileEtags& entry     = cacheable ? fileEtags[fileEtagCount++] : uncachedEtags;
+    char       gzipPath[48];
+
+    strlcpy(entry.path, path, sizeof(entry.path));
+    snprintf(gzipPath, sizeof(gzipPath), "%s.gz", path);
+    entry.hasPlain = fileEtag(path, entry.plain, sizeof(entry.plain));
+    entry.hasGzip  = fileEtag(gzipPath, entry.gzip, sizeof(entry.gzip));
+    return entry;
+}
+#endif
+
+}  // namespace
+
+void sendWebAsset(AsyncWebServerRequest* request, const char* path) {
+    const char* type = contentType(path);
+
+#if WEB_ASSETS_EMBEDDED
+    for (const WebAsset& asset : WEB_ASSETS) {
+        if (strcmp(asset.path, path) != 0) continue;
+        if (sendIfNotModified(request, type, asset.etag)) return;
+
+        // Every browser accepts gzip, there is no uncompressed copy in flash
+        AsyncWebServerResponse* response = request->beginResponse(200, asset.type, asset.data, asset.length);
+        response->addHeader("Content-Encoding", "gzip");
+        addCacheHeaders(response, type, asset.etag);
+        request->send(response);
+        return;
+    }
+#else
+    const FileEtags& etags = etagsOf(path);
+    char             gzipPath[48];
+    snprintf(gzipPath, sizeof(gzipPath), "%s.gz", path);
+
+    bool acceptsGzip = request->hasHeader("Accept-Encoding") &&
+                       strstr(request->getHeader("Accept-Encoding")->value().c_str(), "gzip") != nullptr;
+    bool gzip        = etags.hasGzip && (acceptsGzip || !etags.hasPlain);
+
+    if (gzip || etags.hasPlain) {
+        const char* etag = gzip ? etags.gzip : etags.plain;
+        if (sendIfNotModified(request, type, etag)) return;
+
+        AsyncWebServerResponse* response = request->beginResponse(LittleFS, gzip ? gzipPath : path, type);
+        if (gzip) response->addHeader("Content-Encoding", "gzip");
+        addCacheHeaders(response, type, etag);
+        request->send(response);
+        return;
+    }
+#endif
+
+    Log::warning("Web asset not found: %s", path);
+    request->send(404, "text/plain", "Not found");
+}
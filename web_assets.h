@@ -0,0 +1,68 @@
+/**
+ * @file        web_assets.h
+ * @brief       Compressed, cacheable web assets for the Wiicon Remote project
+ *
+ * @details     Serves the portal and dashboard pages gzip-compressed with an ETag and Cache-Control, and
+ *              answers 304 when the browser already has the current version. The compressed copies are made
+ *              by tools/wiicon_assets, either as .gz files next to the originals in LittleFS or, with
+ *              WEB_ASSETS_EMBEDDED, as arrays in flash (web_assets_data.h) that skip the filesystem.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#include "config.h"
+#include "logger.h"
+
+/**
+ * Asset compiled into the firmware, generated by tools/wiicon_assets
+ */
+struct WebAsset {
+    const char*    path;   /**< Request path, e.g. "/style.css" */
+    const char*    type;   /**< Content type */
+    const char*    etag;   /**< Quoted ETag of the compressed data */
+    const uint8_t* data;   /**< Gzip-compressed content */
+    size_t         length; /**< Length of the compressed content */
+};
+
+/**
+ * Send a web asset, or 404 if it does not exist
+ * The gzip copy is preferred when the browser accepts it, and pages are revalidated on every load while other
+ * assets are cached for WEB_ASSET_MAX_AGE_S. Files in LittleFS are hashed for their ETag on the first request only.
+ * @param request Request to answer
+ * @param path Asset path, e.g. "/wifi_manager.html"
+ */
+void sendWebAsset(AsyncWebServerRequest* request, const char* path);
+
+#endif  // WEB_ASSETS_H
@@ -0,0 +1,201 @@
+/**
+ * @file        websocket_transport.cpp
+ * @brief       Binary WebSocket stream for browser clients for the Wiicon Remote project
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#include "websocket_transport.h"
+
+#include "wifi_manager.h"
+
+WebSocketTransport& webSocketTransport = WebSocketTransport::instance();
+
+WebSocketTransport& WebSocketTransport::instance() {
+    static WebSocketTransport instance;
+    return instance;
+}
+
+WebSocketTransport::WebSocketTransport()
+    : _server(WS_PORT),
+      _socket(WS_PATH),
+      _clients{},
+      _clientCount(0),
+      _started(false),
+      _intervalUs((uint32_t)(1000000.0f / WS_RATE_HZ)),
+      _nextFrameUs(0),
+      _lastCleanup(0) {
+    portMUX_INITIALIZE(&_lock);
+}
+
+bool WebSocketTransport::begin() {
+    if (_started) return true;
+    if (!WS_ENABLED || !wifiManager.isConnected() || wifiManager.isInAPMode()) return false;
+
+    _socket.onEvent([this](AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg,
+                           uint8_t* data, size_t length) { onEvent(server, client, type, arg, data, length); });
+    _server.addHandler(&_socket);
+    _server.begin();
+    _started = true;
+
+    Log::info("WebSocket stream ready -> ws://%s:%d%s (%.0f Hz, up to %d clients)",
+              WiFi.localIP().toString().c_str(), WS_PORT, WS_PATH, getRate(), (int)WS_MAX_CLIENTS);
+    return true;
+}
+
+void WebSocketTransport::loop() {
+    if (!_started && !begin()) return;
+
+    flush();
+
+    // The web server keeps closed clients around until they are cleaned up
+    if (millis() - _lastCleanup >= CLEANUP_INTERVAL_MS) {
+        _lastCleanup = millis();
+        _socket.cleanupClients(WS_MAX_CLIENTS);
+    }
+}
+
+void WebSocketTransport::setRate(float hz) {
+    hz          = constrain(hz, WS_RATE_MIN_HZ, SAMPLE_RATE_MAX_HZ);
+    _intervalUs = (uint32_t)(1000000.0f / hz);
+    Log::info("WebSocket rate set to %.1f Hz", hz);
+}
+
+bool WebSocketTransport::send(const OscDestination&, const uint8_t* data, size_t length) {
+    if (!_started) return false;
+
+    // Bundles carry the newest frame first, right after the header
+    if (frameIsBundle(data, length)) {
+        if (length < FRAME_BUNDLE_HEADER_SIZE + FRAME_HEADER_SIZE) return false;
+        size_t size = frameEncodedSize(data[FRAME_BUNDLE_HEADER_SIZE + 2]);
+        if (FRAME_BUNDLE_HEADER_SIZE + size > length) return false;
+        data += FRAME_BUNDLE_HEADER_SIZE;
+        length = size;
+    }
+    if (!frameIsFrame(data, length) || length > FRAME_MAX_SIZE) return false;
+
+    // Schedule on a fixed grid so the average rate holds when it does not divide the sample rate
+    uint32_t now = micros();
+    if ((int32_t)(now - _nextFrameUs) < 0) return true;
+    _nextFrameUs += _intervalUs;
+    if ((int32_t)(now - _nextFrameUs) >= 0) _nextFrameUs = now + _intervalUs;
+
+    portENTER_CRITICAL(&_lock);
+    for (Client& client : _clients) {
+        if (client.id == 0) continue;
+
+        // A client that fell behind wants the newest orientation, not the backlog
+        if (client.count == WS_QUEUE_DEPTH) {
+            client.head = (client.head + 1) % WS_QUEUE_DEPTH;
+            client.count--;
+            client.dropped++;
+        }
+
+        size_t slot = (client.head + client.count) % WS_QUEUE_DEPTH;
+        memcpy(client.frames[slot], data, length);
+        client.lengths[slot] = (uint8_t)length;
+        client.count++;
+    }
+    portEXIT_CRITICAL(&_lock);
+
+    flush();
+    return true;
+}
+
+void WebSocketTransport::flush() {
+    for (Client& client : _clients) {
+        while (true) {
+            portENTER_CRITICAL(&_lock);
+            uint32_t id = client.count > 0 ? client.id : 0;
+            portEXIT_CRITICAL(&_lock);
+
+            // The web server queues the frame and sends it from its own task, this never waits for the network
+            if (id == 0 || !_socket.availableForWrite(id)) break;
+
+            uint8_t frame[FRAME_MAX_SIZE];
+            size_t  length = 0;
+
+            portENTER_CRITICAL(&_lock);
+            if (client.id == id && client.count > 0) {
+                length = client.lengths[client.head];
+                memcpy(frame, client.frames[client.head], length);
+                client.head = (client.head + 1) % WS_QUEUE_DEPTH;
+                client.count--;
+            }
+            portEXIT_CRITICAL(&_lock);
+
+            if (length == 0) break;
+            _socket.binary(id, frame, length);
+        }
+    }
+}
+
+void WebSocketTransport::onEvent(AsyncWebSocket*, AsyncWebSocketClient* client, AwsEventType type, void*,
+                                 uint8_t*, size_t) {
+    unsigned id = (unsigned)client->id();
+
+    if (type == WS_EVT_CONNECT) {
+        Client* slot = nullptr;
+
+        portENTER_CRITICAL(&_lock);
+        for (Client& candidate : _clients) {
+            if (candidate.id != 0) continue;
+            slot     = &candidate;
+            *slot    = Client{};
+            slot->id = client->id();
+            _clientCount++;
+            break;
+        }
+        portEXIT_CRITICAL(&_lock);
+
+        if (!slot) {
+            Log::warning("WebSocket: refusing client #%u from %s, %d clients connected", id,
+                         client->remoteIP().toString().c_str(), (int)WS_MAX_CLIENTS);
+            client->close(1013, "Too many clients");  // Try again later
+            return;
+        }
+        Log::info("WebSocket client #%u connected from %s", id, client->remoteIP().toString().c_str());
+    } else if (type == WS_EVT_DISCONNECT) {
+        bool     found   = false;
+        uint32_t dropped = 0;
+
+        portENTER_CRITICAL(&_lock);
+        for (Client& candidate : _clients) {
+            if (candidate.id != client->id()) continue;
+            dropped      = candidate.dropped;
+            candidate.id = 0;
+            _clientCount--;
+            found = true;
+            break;
+        }
+        portEXIT_CRITICAL(&_lock);
+
+        if (found) Log::info("WebSocket client #%u disconnected, %u frames dropped", id, (unsigned)dropped);
+    }
+}
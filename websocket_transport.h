@@ -0,0 +1,171 @@
+/**
+ * @file        websocket_transport.h
+ * @brief       Binary WebSocket stream for browser clients for the Wiicon Remote project
+ *
+ * @details     Serves a /ws WebSocket endpoint in station mode and pushes the compact binary
+ *              frames (wiicon_frame.h) to every connected client at WS_RATE_HZ. Each client has
+ *              a short queue in front of the web server; when a client falls behind its oldest
+ *              frame is dropped, so a slow browser never blocks the sampler.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef WEBSOCKET_TRANSPORT_H
+#define WEBSOCKET_TRANSPORT_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#include "config.h"
+#include "logger.h"
+#include "osc_transport.h"
+#include "wiicon_frame.h"
+
+class WebSocketTransport : public OscTransport {
+   public:
+    /**
+     * Get the singleton instance of the WebSocket transport
+     * @return Reference to the WebSocket transport instance
+     */
+    static WebSocketTransport& instance();
+
+    const char* name() const override { return "websocket"; }
+
+    /**
+     * Start the web server with the /ws endpoint
+     * Only succeeds in station mode with WiFi connected; the portal owns port 80 in AP mode.
+     * @return true if the endpoint is running
+     */
+    bool begin() override;
+
+    /**
+     * Check whether any client is connected
+     * @return true if frames have somewhere to go
+     */
+    bool isReady() const override { return _started && _clientCount > 0; }
+
+    /**
+     * Queue one frame for every client
+     * Frames arriving faster than the configured rate are skipped. A redundant bundle is reduced to its newest frame,
+     * TCP already retransmits.
+     * @param destination Ignored, every connected client receives the frame
+     * @param data Binary frame or redundant bundle
+     * @param length Packet length in bytes
+     * @return false if the packet is not a binary frame
+     */
+    bool send(const OscDestination& destination, const uint8_t* data, size_t length) override;
+
+    /**
+     * Start the endpoint once WiFi is up, hand queued frames to the web server and drop closed clients
+     */
+    void loop();
+
+    /**
+     * Set the rate frames are pushed to clients
+     * @param hz Frames per second, clamped to WS_RATE_MIN_HZ..SAMPLE_RATE_MAX_HZ
+     */
+    void setRate(float hz);
+
+    /**
+     * Get the rate frames are pushed to clients
+     * @return Frames per second
+     */
+    float getRate() const { return 1000000.0f / _intervalUs; }
+
+    /**
+     * Get the number of connected clients
+     * @return Connected clients
+     */
+    uint8_t getClientCount() const { return _clientCount; }
+
+    /**
+     * Whether the web server is running
+     * @return true once begin() has succeeded
+     */
+    bool isStarted() const { return _started; }
+
+    /**
+     * Get the station mode web server, shared with the dashboard
+     * @return Web server on WS_PORT
+     */
+    AsyncWebServer& getServer() { return _server; }
+
+    WebSocketTransport(const WebSocketTransport&)            = delete;
+    WebSocketTransport& operator=(const WebSocketTransport&) = delete;
+
+   private:
+    /**
+     * Per-client queue of frames not yet handed to the web server
+     */
+    struct Client {
+        uint32_t id;                                     /**< Web server client id, 0 = free slot */
+        uint8_t  head;                                   /**< Slot of the oldest frame */
+        uint8_t  count;                                  /**< Queued frames */
+        uint8_t  lengths[WS_QUEUE_DEPTH];                /**< Length of each queued frame */
+        uint8_t  frames[WS_QUEUE_DEPTH][FRAME_MAX_SIZE]; /**< Queued frames, ring buffer */
+        uint32_t dropped;                                /**< Frames dropped because the client fell behind */
+    };
+
+    /**
+     * Constructor
+     */
+    WebSocketTransport();
+    ~WebSocketTransport() = default;
+
+    static constexpr unsigned long CLEANUP_INTERVAL_MS = 1000; /**< Interval between cleanups of closed clients */
+
+    /**
+     * Handle connects and disconnects, runs in the web server task
+     */
+    void onEvent(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data,
+                 size_t length);
+
+    /**
+     * Hand queued frames to the web server while each client can take them
+     */
+    void flush();
+
+    AsyncWebServer _server; /**< Web server in station mode */
+    AsyncWebSocket _socket; /**< /ws endpoint */
+    portMUX_TYPE   _lock;   /**< Guards the client table against the web server task */
+
+    Client           _clients[WS_MAX_CLIENTS]; /**< Client table */
+    uint8_t          _clientCount;             /**< Occupied slots */
+    bool             _started;                 /**< Whether the server is running */
+    uint32_t         _intervalUs;              /**< Minimum time between frames */
+    uint32_t         _nextFrameUs;             /**< Time the next frame is due */
+    unsigned long    _lastCleanup;             /**< Last cleanup of closed clients (millis) */
+};
+
+/**
+ * Global instance of the WebSocket transport
+ */
+extern WebSocketTransport& webSocketTransport;
+
+#endif  // WEBSOCKET_TRANSPORT_H
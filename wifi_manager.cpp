@@ -18,109 +18,350 @@
 
 #include "wifi_manager.h"
 
+#include "profile_manager.h"
+#include "scan_cache.h"
+#include "settings_registry.h"
+#include "web_assets.h"
+
 WiFiManager& wifiManager = WiFiManager::instance();
 
+namespace {
+
+const uint32_t LINK_CACHE_MAGIC = 0x57434C31;  // "WCL1"
+
+/**
+ * Access point and lease of the last successful connection
+ * Kept in RTC memory, so it survives deep sleep but not a power cycle.
+ */
+struct LinkCache {
+    uint32_t magic;       /**< LINK_CACHE_MAGIC when valid */
+    uint32_t credentials; /**< Hash of the SSID and password the entry belongs to */
+    time_t   leasedAt;    /**< System time the lease was obtained, keeps counting through deep sleep */
+    uint8_t  bssid[6];    /**< Access point */
+    int32_t  channel;     /**< Channel of the access point */
+    uint32_t ip;          /**< Leased address */
+    uint32_t gateway;     /**< Gateway */
+    uint32_t subnet;      /**< Subnet mask */
+    uint32_t dns;         /**< DNS server */
+};
+
+RTC_DATA_ATTR LinkCache linkCache;
+
+/**
+ * FNV-1a over the SSID and password, terminators included so the boundary between them counts
+ */
+uint32_t credentialHash(const char* ssid, const char* password) {
+    const char* parts[] = {ssid, password};
+    uint32_t    hash    = 2166136261u;
+
+    for (const char* c : parts) {
+        do hash = (hash ^ (uint8_t)*c) * 16777619u;
+        while (*c++);
+    }
+    return hash;
+}
+
+}  // namespace
+
 WiFiManager& WiFiManager::instance() {
     static WiFiManager instance;
     return instance;
 }
 
-WiFiManager::WiFiManager() : _localSubnet(255, 255, 255, 0), _server(80), _isAPMode(false), _shouldRestart(false) {}
+WiFiManager::WiFiManager()
+    : _localSubnet(255, 255, 255, 0),
+      _server(80),
+      _state(WiFiState::IDLE),
+      _stateSince(0),
+      _attemptStart(0),
+      _retryDelay(WIFI_RETRY_MIN_MS),
+      _failedAttempts(0),
+      _cachedAttempt(false),
+      _cachedLease(false),
+      _renewing(false),
+      _everConnected(false),
+      _gotIP(false),
+      _linkLost(false),
+      _disconnectReason(0),
+      _shouldRestart(false) {}
 
 void WiFiManager::begin() {
-    loadCredentials();
+    configStore.begin();
 
-    if (connect()) {
-        Log::info("WiFi connected successfully");
+    const StoredConfig& config = configStore.get();
+    if (config.ssid[0] == '\0' || config.password[0] == '\0') {
+        Log::warning("SSID or password is empty");
+        startAccessPoint();
         return;
     }
 
-    startAccessPoint();
+    // Credentials come from the config store, letting the driver copy them to its own NVS on every begin only costs
+    // time. Reconnects are driven by loop() with backoff instead of the driver's immediate retries.
+    WiFi.persistent(false);
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(false);
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_LOST_IP);
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+
+    startAttempt();
 }
 
 void WiFiManager::loop() {
-    if (_isAPMode) {
-        _dnsServer.processNextRequest();
-        LedManager::signalAPMode();
+    switch (_state) {
+        case WiFiState::CONNECTING: {
+            if (_gotIP) {
+                onConnected();
+                break;
+            }
+
+            LedManager::signalWifiConnecting();
+
+            // A disconnect ends the attempt at once (access point gone, credentials refused), waiting for the timeout
+            // would only delay the next one. The leave caused by our own WiFi.disconnect() can arrive late, skip it.
+            bool          rejected = _linkLost && _disconnectReason != WIFI_REASON_ASSOC_LEAVE;
+            unsigned long timeout  = _cachedAttempt ? FAST_CONNECT_TIMEOUT : CONNECTION_TIMEOUT;
+            if (!rejected && millis() - _attemptStart < timeout) break;
+
+            if (rejected) Log::warning("WiFi attempt rejected (reason %d)", _disconnectReason);
+            if (_cachedAttempt) {
+                Log::warning("Fast reconnect failed, scanning for %s", configStore.get().ssid);
+                linkCache.magic = 0;
+                WiFi.disconnect();
+                startAttempt();
+            } else {
+                onAttemptFailed();
+            }
+            break;
+        }
+
+        case WiFiState::CONNECTED:
+            if (_linkLost) {
+                Log::warning("WiFi connection lost (reason %d), reconnecting", _disconnectReason);
+                _retryDelay = WIFI_RETRY_MIN_MS;
+                setState(WiFiState::BACKOFF);
+                break;
+            }
+
+            // The cached lease is held as a static address, so nothing renews it with the server
+            if (_cachedLease && time(nullptr) - linkCache.leasedAt > WIFI_LEASE_MAX_AGE_S) {
+                renewLease();
+            } else if (_renewing && _gotIP) {
+                _renewing = false;
+                saveLinkCache(true);
+                Log::info("Lease renewed, IP address: %s", WiFi.localIP().toString().c_str());
+            }
+            break;
+
+        case WiFiState::BACKOFF:
+            if (millis() - _stateSince >= _retryDelay) startAttempt();
+            break;
+
+        case WiFiState::AP_MODE:
+            _dnsServer.processNextRequest();
+            scanCache.loop();
+            LedManager::signalAPMode();
+            break;
+
+        case WiFiState::IDLE:
+            break;
     }
 
     if (_shouldRestart) {
+        settingsRegistry.flush();
         Log::info("Restarting in 2 seconds...");
         delay(DELAY_BEFORE_RESTART_MS * 2);
         ESP.restart();
     }
 }
 
+void WiFiManager::reconnect() {
+    if (_state == WiFiState::IDLE || _state == WiFiState::AP_MODE) return;
+
+    Log::info("Network settings changed, reconnecting");
+
+    // The cached access point and lease belong to the old settings
+    linkCache.magic = 0;
+    WiFi.disconnect();
+
+    // Once connected the station web server holds port 80, so failures retry with backoff instead of opening the
+    // portal, and the serial console can correct the settings
+    _failedAttempts = 0;
+    _retryDelay     = WIFI_RETRY_MIN_MS;
+    startAttempt();
+}
+
 void WiFiManager::clearCredentials() {
-    writeFile(LittleFS, SSID_PATH, "");
-    writeFile(LittleFS, PASSWORD_PATH, "");
-    writeFile(LittleFS, IP_PATH, "");
-    writeFile(LittleFS, GATEWAY_PATH, "");
-    writeFile(LittleFS, OSC_IP_PATH, "");
+    configStore.clear();
     Log::info("WiFi credentials cleared");
 }
 
-void WiFiManager::loadCredentials() {
-    _ssid     = readFile(LittleFS, SSID_PATH);
-    _password = readFile(LittleFS, PASSWORD_PATH);
-    _ip       = readFile(LittleFS, IP_PATH);
-    _gateway  = readFile(LittleFS, GATEWAY_PATH);
-    _oscIP    = readFile(LittleFS, OSC_IP_PATH);
+bool WiFiManager::hasStaticIP() const {
+    const StoredConfig& config = configStore.get();
+    return config.ip[0] != '\0' && config.gateway[0] != '\0';
 }
 
-void WiFiManager::saveCredential(const char* path, const String& value) { writeFile(LittleFS, path, value.c_str()); }
+void WiFiManager::setState(WiFiState state) {
+    _state      = state;
+    _stateSince = millis();
+}
 
-bool WiFiManager::connect() {
-    if (_ssid.isEmpty() || _password.isEmpty()) {
-        Log::warning("SSID or password is empty");
+void WiFiManager::startAttempt() {
+    const StoredConfig& config = configStore.get();
+
+    // Events of the previous attempt must not complete or abort this one
+    _gotIP            = false;
+    _linkLost         = false;
+    _disconnectReason = 0;
+    _renewing         = false;
+    _attemptStart     = millis();
+    _cachedAttempt    = beginCached();
+
+    if (!_cachedAttempt) {
+        if (!configureAddress()) {
+            onAttemptFailed();
+            return;
+        }
+
+        WiFi.begin(config.ssid, config.password);
+        Log::info("Connecting to WiFi: %s", config.ssid);
+    }
+
+    setState(WiFiState::CONNECTING);
+}
+
+bool WiFiManager::beginCached() {
+    const StoredConfig& config      = configStore.get();
+    uint32_t            credentials = credentialHash(config.ssid, config.password);
+    time_t              age         = time(nullptr) - linkCache.leasedAt;
+
+    if (!WIFI_FAST_RECONNECT || linkCache.magic != LINK_CACHE_MAGIC || linkCache.credentials != credentials) {
         return false;
     }
 
-    WiFi.mode(WIFI_STA);
+    // An old lease may have been handed to another device in the meantime
+    bool useLease = !hasStaticIP();
+    if (useLease && (linkCache.ip == 0 || age < 0 || age > WIFI_LEASE_MAX_AGE_S)) {
+        linkCache.magic = 0;
+        return false;
+    }
+
+    if (useLease) {
+        if (!WiFi.config(IPAddress(linkCache.ip), IPAddress(linkCache.gateway), IPAddress(linkCache.subnet),
+                         IPAddress(linkCache.dns))) {
+            return false;
+        }
+    } else if (!configureAddress()) {
+        return false;
+    }
+
+    // Directed at the cached access point on its channel, which skips the scan of every channel
+    WiFi.begin(config.ssid, config.password, linkCache.channel, linkCache.bssid);
+    Log::info("Reconnecting to WiFi: %s (channel %d%s)", config.ssid, (int)linkCache.channel,
+              useLease ? ", cached lease" : "");
+    return true;
+}
+
+void WiFiManager::onConnected() {
+    saveLinkCache(!_cachedAttempt && !hasStaticIP());
+
+    _cachedLease    = _cachedAttempt && !hasStaticIP();
+    _everConnected  = true;
+    _failedAttempts = 0;
+    _retryDelay     = WIFI_RETRY_MIN_MS;
+    _linkLost       = false;
+    setState(WiFiState::CONNECTED);
+    profileManager.applyRadio();
 
-    if (!_ip.isEmpty() && !_gateway.isEmpty()) {
-        _localIP.fromString(_ip.c_str());
-        _localGateway.fromString(_gateway.c_str());
+    // The connecting blink stops here, a one-shot signal still showing ends by itself
+    if (!LedManager::isBusy()) LedManager::off();
+    Log::info("Connected to WiFi in %lu ms!", millis() - _attemptStart);
+    Log::info("IP address: %s", WiFi.localIP().toString().c_str());
+}
+
+void WiFiManager::renewLease() {
+    Log::info("Cached lease expired, renewing with DHCP");
+
+    // Dropping the static address starts the DHCP client, GOT_IP follows once it is bound
+    _cachedLease = false;
+    _renewing    = true;
+    _gotIP       = false;
+    configureAddress();
+}
+
+void WiFiManager::onAttemptFailed() {
+    WiFi.disconnect();
+    _failedAttempts++;
+
+    // Until the credentials have worked once, repeated failures most likely mean they are wrong
+    if (!_everConnected && _failedAttempts >= WIFI_BOOT_ATTEMPTS) {
+        Log::error("WiFi connection failed %d times, opening the configuration portal", _failedAttempts);
+        LedManager::signalErrorGeneral();
+        startAccessPoint();
+        return;
+    }
+
+    Log::warning("WiFi connection failed, retrying in %lu ms", _retryDelay);
+    setState(WiFiState::BACKOFF);
+    _retryDelay = _retryDelay * 2 < WIFI_RETRY_MAX_MS ? _retryDelay * 2 : WIFI_RETRY_MAX_MS;
+}
+
+void WiFiManager::onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+    // Runs in the WiFi event task, loop() acts on the flags
+    WiFiManager& manager = instance();
+
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        manager._gotIP = true;
+    } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        manager._disconnectReason = info.wifi_sta_disconnected.reason;
+        manager._linkLost         = true;
+    } else if (event == ARDUINO_EVENT_WIFI_STA_LOST_IP) {
+        manager._linkLost = true;
+    }
+}
+
+bool WiFiManager::configureAddress() {
+    const StoredConfig& config = configStore.get();
+
+    if (hasStaticIP()) {
+        _localIP.fromString(config.ip);
+        _localGateway.fromString(config.gateway);
 
         if (!WiFi.config(_localIP, _localGateway, _localSubnet)) {
             Log::error("Failed to configure static IP");
             return false;
         }
-        Log::info("Using static IP: %s", _ip.c_str());
+        Log::info("Using static IP: %s", config.ip);
     } else {
         WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
         Log::info("Using DHCP for automatic IP assignment");
     }
+    return true;
+}
 
-    WiFi.begin(_ssid.c_str(), _password.c_str());
-    Log::info("Connecting to WiFi: %s", _ssid.c_str());
-
-    unsigned long startTime = millis();
-
-    while (WiFi.status() != WL_CONNECTED) {
-        if (millis() - startTime >= CONNECTION_TIMEOUT) {
-            Log::error("WiFi connection timeout");
-            LedManager::signalErrorGeneral();
-            return false;
-        }
-        LedManager::signalWifiConnecting();
-        delay(10);
+void WiFiManager::saveLinkCache(bool newLease) {
+    linkCache.magic       = LINK_CACHE_MAGIC;
+    linkCache.credentials = credentialHash(configStore.get().ssid, configStore.get().password);
+    linkCache.channel     = WiFi.channel();
+
+    // The age counts from the DHCP exchange, reusing the lease does not extend it with the server
+    if (newLease) {
+        linkCache.leasedAt = time(nullptr);
+        linkCache.ip       = (uint32_t)WiFi.localIP();
+        linkCache.gateway  = (uint32_t)WiFi.gatewayIP();
+        linkCache.subnet   = (uint32_t)WiFi.subnetMask();
+        linkCache.dns      = (uint32_t)WiFi.dnsIP();
     }
 
-    LedManager::signalSuccess();
-    delay(1000);
-    LedManager::off();
-
-    Log::info("Connected to WiFi!");
-    Log::info("IP address: %s", WiFi.localIP().toString().c_str());
-
-    return true;
+    const uint8_t* bssid = WiFi.BSSID();
+    if (bssid) memcpy(linkCache.bssid, bssid, sizeof(linkCache.bssid));
 }
 
 void WiFiManager::startAccessPoint() {
     Log::info("Starting WiFi Manager AP...");
 
-    _isAPMode = true;
+    WiFi.disconnect();
+    setState(WiFiState::AP_MODE);
     WiFi.softAP("WiiCon Setup", NULL, 1, false, 1);
 
     IPAddress apIP = WiFi.softAPIP();
@@ -128,6 +369,7 @@ void WiFiManager::startAccessPoint() {
 
     setupCaptivePortal();
     setupWebServer();
+    scanCache.refresh();
 
     _server.begin();
     Log::info("WiFi Manager server started");
@@ -164,64 +406,38 @@ void WiFiManager::setupCaptivePortal() {
 
 void WiFiManager::setupWebServer() {
     // Main page
-    _server.on("/", HTTP_GET,
-               [](AsyncWebServerRequest* request) { request->send(LittleFS, "/wifi_manager.html", "text/html"); });
-
-    // WiFi network scan
-    _server.on("/scan", HTTP_GET, [](AsyncWebServerRequest* request) {
-        int    n    = WiFi.scanNetworks();
-        String json = "[";
-
-        for (int i = 0; i < n; i++) {
-            if (i > 0) json += ",";
-            json += "{\"ssid\":\"" + WiFi.SSID(i) + "\",";
-            json += "\"rssi\":" + String(WiFi.RSSI(i)) + ",";
-            json += "\"secure\":" + String(WiFi.encryptionType(i) != WIFI_AUTH_OPEN) + "}";
-        }
+    _server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) { sendWebAsset(request, "/wifi_manager.html"); });
 
-        json += "]";
-        WiFi.scanDelete();
-        request->send(200, "application/json", json);
-    });
+    // WiFi network scan, answered from the cache while a background scan refreshes it
+    _server.on("/scan", HTTP_GET, [](AsyncWebServerRequest* request) { scanCache.respond(request); });
 
-    // Form submission
+    // Form submission, the field names are setting names
     _server.on("/", HTTP_POST, [this](AsyncWebServerRequest* request) {
         int params = request->params();
 
+        // Nothing is queued unless every field is valid
         for (int i = 0; i < params; i++) {
             const AsyncWebParameter* p = request->getParam(i);
-
             if (!p->isPost()) continue;
 
-            if (p->name() == PARAM_SSID) {
-                _ssid = p->value();
-                saveCredential(SSID_PATH, _ssid);
-                Log::info("SSID saved: %s", _ssid.c_str());
-            } else if (p->name() == PARAM_PASSWORD) {
-                _password = p->value();
-                saveCredential(PASSWORD_PATH, _password);
-                Log::info("Password saved");
-            } else if (p->name() == PARAM_IP) {
-                _ip = p->value();
-                saveCredential(IP_PATH, _ip);
-                Log::info("IP saved: %s", _ip.c_str());
-            } else if (p->name() == PARAM_GATEWAY) {
-                _gateway = p->value();
-                saveCredential(GATEWAY_PATH, _gateway);
-                Log::info("Gateway saved: %s", _gateway.c_str());
-            } else if (p->name() == PARAM_OSC_IP) {
-                _oscIP = p->value();
-                saveCredential(OSC_IP_PATH, _oscIP);
-                Log::info("OSC IP saved: %s", _oscIP.c_str());
+            SettingResult result = SettingsRegistry::check(p->name().c_str(), p->value().c_str(), SettingSource::LOCAL);
+            if (result != SettingResult::OK) {
+                request->send(400, "text/plain", p->name() + ": " + SettingsRegistry::describe(result));
+                return;
             }
         }
+        for (int i = 0; i < params; i++) {
+            const AsyncWebParameter* p = request->getParam(i);
+            if (p->isPost()) settingsRegistry.set(p->name().c_str(), p->value().c_str(), SettingSource::LOCAL);
+        }
 
+        // The fields are applied and written together by the main loop before the restart
         request->send(200, "text/plain", "Credentials saved. Restarting...");
         _shouldRestart = true;
     });
 
-    // Static files
-    _server.serveStatic("/", LittleFS, "/");
+    // Stylesheet, compressed and cached like the page
+    _server.on("/style.css", HTTP_GET, [](AsyncWebServerRequest* request) { sendWebAsset(request, "/style.css"); });
 }
 
 void WiFiManager::redirectToCaptivePortal(AsyncWebServerRequest* request) {
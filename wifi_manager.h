@@ -25,10 +25,22 @@
 #include <LittleFS.h>
 #include <WiFi.h>
 
+#include "config_store.h"
 #include "helpers.h"
 #include "led_manager.h"
 #include "logger.h"
 
+/**
+ * Connection state of the WiFi manager
+ */
+enum class WiFiState : uint8_t {
+    IDLE,       /**< Not started */
+    CONNECTING, /**< An attempt is waiting for an address */
+    CONNECTED,  /**< Station has an address */
+    BACKOFF,    /**< Waiting before the next attempt */
+    AP_MODE,    /**< Configuration portal */
+};
+
 class WiFiManager {
    public:
     /**
@@ -38,15 +50,25 @@ class WiFiManager {
     static WiFiManager& instance();
 
     /**
-     * Initialize the WiFi manager
+     * Initialize the WiFi manager and start the first connection attempt
+     * Returns right away; the connection completes in loop(). Opens the portal when no credentials are stored.
      */
     void begin();
 
     /**
-     * Loop the WiFi manager
+     * Advance the connection state machine, never blocks
+     * Retries with exponential backoff after a failed attempt or a lost connection.
      */
     void loop();
 
+    /**
+     * Drop the current connection and connect again with the stored network settings
+     * Called by the settings registry when they change. Does nothing in AP mode, where the portal restarts the
+     * device after saving. Once a connection has worked since boot the portal stays closed, since the
+     * station web server holds its port.
+     */
+    void reconnect();
+
     /**
      * Clear the WiFi credentials
      */
@@ -56,19 +78,31 @@ class WiFiManager {
      * Check if the WiFi manager is in AP mode
      * @return true if in AP mode, false otherwise
      */
-    bool isInAPMode() const { return _isAPMode; }
+    bool isInAPMode() const { return _state == WiFiState::AP_MODE; }
 
     /**
      * Check if the WiFi manager is connected
      * @return true if connected, false otherwise
      */
-    bool isConnected() const { return WiFi.status() == WL_CONNECTED; }
+    bool isConnected() const { return _state == WiFiState::CONNECTED; }
+
+    /**
+     * Get the connection state
+     * @return Current state
+     */
+    WiFiState getState() const { return _state; }
 
     /**
      * Get the OSC IP address
-     * @return OSC IP address
+     * @return OSC IP address, empty if not configured
      */
-    String getOscIP() const { return _oscIP; } /**< OSC IP address */
+    const char* getOscIP() const { return configStore.get().oscIP; }
+
+    /**
+     * Get the OSC port
+     * @return OSC port, 0 if not configured
+     */
+    uint16_t getOscPort() const { return configStore.get().oscPort; }
 
     WiFiManager(const WiFiManager&)            = delete; /**< Delete copy constructor */
     WiFiManager& operator=(const WiFiManager&) = delete; /**< Delete assignment operator */
@@ -85,108 +119,109 @@ class WiFiManager {
     ~WiFiManager() = default;
 
     /**
-     * Connect to the WiFi network
-     * @return true if connected, false otherwise
+     * Enter a state and note when
+     * @param state New state
      */
-    bool connect();
+    void setState(WiFiState state);
 
     /**
-     * Start the access point
+     * Start a connection attempt, to the cached access point if possible, otherwise with a scan
      */
-    void startAccessPoint();
+    void startAttempt();
 
     /**
-     * Setup the captive portal
+     * Start a reconnect to the access point of the last connection, on its channel and with its lease
+     * Only used within WIFI_LEASE_MAX_AGE_S of that connection; a static IP from the portal takes precedence over the
+     * cached lease. The lease is handed back to DHCP by renewLease() once it reaches that age.
+     * @return true if the attempt was started, false if there is no usable cache entry
      */
-    void setupCaptivePortal();
+    bool beginCached();
 
     /**
-     * Setup the web server
+     * Enter CONNECTED after an attempt got an address
      */
-    void setupWebServer();
+    void onConnected();
 
     /**
-     * Load the WiFi credentials
+     * Hand the address from the link cache back to DHCP
+     * Called in CONNECTED once the cached lease is WIFI_LEASE_MAX_AGE_S old; the station stays associated while the
+     * DHCP client obtains a lease of its own.
      */
-    void loadCredentials();
+    void renewLease();
 
     /**
-     * Save the WiFi credential
+     * Schedule the next attempt with backoff, or open the portal if the credentials never worked
      */
-    void saveCredential(const char* path, const String& value);
+    void onAttemptFailed();
 
     /**
-     * Redirect to the captive portal
-     * @param request Request to redirect
+     * WiFi event handler, sets the flags loop() acts on
+     * @param event WiFi event identifier
+     * @param info Event details
      */
-    void redirectToCaptivePortal(AsyncWebServerRequest* request);
-
-    String _ssid;     /**< SSID of the WiFi network */
-    String _password; /**< Password of the WiFi network */
-    String _ip;       /**< IP address of the WiFi network */
-    String _gateway;  /**< Gateway of the WiFi network */
-    String _oscIP;    /**< OSC IP address */
-
-    IPAddress _localIP;      /**< Local IP address */
-    IPAddress _localGateway; /**< Local gateway */
-    IPAddress _localSubnet;  /**< Local subnet */
-
-    AsyncWebServer _server;    /**< Web server */
-    DNSServer      _dnsServer; /**< DNS server */
-
-    bool _isAPMode; /**< Whether the WiFi manager is in AP mode */
-
-    bool _shouldRestart = false; /**< Whether the WiFi manager should restart */
+    static void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info);
 
     /**
-     * Path to the SSID file
+     * Apply the static IP from the portal, or switch back to DHCP
+     * @return false if the static IP was rejected
      */
-    static constexpr const char* SSID_PATH = "/ssid.txt";
+    bool configureAddress();
 
     /**
-     * Path to the password file
+     * Remember the access point, channel and lease of the current connection for the next connect
+     * @param newLease Whether the address was just obtained from DHCP, rather than reused from the cache or static
      */
-    static constexpr const char* PASSWORD_PATH = "/password.txt";
+    void saveLinkCache(bool newLease);
 
     /**
-     * Path to the IP file
+     * Start the access point
      */
-    static constexpr const char* IP_PATH = "/ip.txt";
+    void startAccessPoint();
 
     /**
-     * Path to the gateway file
+     * Setup the captive portal
      */
-    static constexpr const char* GATEWAY_PATH = "/gateway.txt";
+    void setupCaptivePortal();
 
     /**
-     * Path to the OSC IP file
+     * Setup the web server
      */
-    static constexpr const char* OSC_IP_PATH = "/osc_ip.txt";
+    void setupWebServer();
 
     /**
-     * Parameter for the SSID
+     * Check if a static IP is configured
+     * @return true if both the IP and the gateway are set
      */
-    static constexpr const char* PARAM_SSID = "ssid";
+    bool hasStaticIP() const;
 
     /**
-     * Parameter for the password
+     * Redirect to the captive portal
+     * @param request Request to redirect
      */
-    static constexpr const char* PARAM_PASSWORD = "password";
+    void redirectToCaptivePortal(AsyncWebServerRequest* request);
 
-    /**
-     * Parameter for the IP
-     */
-    static constexpr const char* PARAM_IP = "ip";
+    IPAddress _localIP;      /**< Local IP address */
+    IPAddress _localGateway; /**< Local gateway */
+    IPAddress _localSubnet;  /**< Local subnet */
 
-    /**
-     * Parameter for the gateway
-     */
-    static constexpr const char* PARAM_GATEWAY = "gateway";
+    AsyncWebServer _server;    /**< Web server */
+    DNSServer      _dnsServer; /**< DNS server */
 
-    /**
-     * Parameter for the OSC IP
-     */
-    static constexpr const char* PARAM_OSC_IP = "osc_ip";
+    WiFiState     _state;          /**< Connection state */
+    unsigned long _stateSince;     /**< Time the state was entered (millis) */
+    unsigned long _attemptStart;   /**< Start of the current attempt (millis) */
+    unsigned long _retryDelay;     /**< Wait before the next attempt, doubles up to WIFI_RETRY_MAX_MS */
+    uint8_t       _failedAttempts; /**< Failed attempts since the last connection */
+    bool          _cachedAttempt;  /**< Whether the current attempt uses the link cache */
+    bool          _cachedLease;    /**< Whether the address is the cached lease, applied as a static config */
+    bool          _renewing;       /**< Whether DHCP is renewing an expired cached lease */
+    bool          _everConnected;  /**< Whether the credentials have worked since boot */
+
+    volatile bool    _gotIP;            /**< Set by the event task when an address was assigned */
+    volatile bool    _linkLost;         /**< Set by the event task when the station disconnected */
+    volatile uint8_t _disconnectReason; /**< Reason code of the last disconnect */
+
+    bool _shouldRestart = false; /**< Whether the WiFi manager should restart */
 
     /**
      * Port for the DNS server
@@ -197,6 +232,11 @@ class WiFiManager {
      * Connection timeout
      */
     static constexpr unsigned long CONNECTION_TIMEOUT = 10000;
+
+    /**
+     * Timeout of the reconnect to the cached access point before falling back to a scan
+     */
+    static constexpr unsigned long FAST_CONNECT_TIMEOUT = 2000;
 };
 
 /**
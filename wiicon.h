@@ -6,14 +6,25 @@
 
 #include "actions.h"
 #include "bmi160.h"
+#include "boot_profiler.h"
 #include "button_manager.h"
+#include "clock_sync.h"
 #include "config.h"
+#include "dashboard.h"
+#include "discovery.h"
+#include "event_channel.h"
 #include "helpers.h"
 #include "led_manager.h"
 #include "logger.h"
 #include "madgwick.h"
 #include "osc_manager.h"
+#include "osc_receiver.h"
+#include "profile_manager.h"
+#include "serial_console.h"
+#include "serial_link.h"
+#include "settings_registry.h"
 #include "sleep_manager.h"
+#include "websocket_transport.h"
 #include "wifi_manager.h"
 
 /**
@@ -28,9 +39,10 @@ void loop();
 
 extern unsigned long lastTime;
 
-extern int accelMap[3];  /**< Accelerometer map */
-extern int accelSign[3]; /**< Accelerometer sign */
-extern int gyroMap[3];   /**< Gyroscope map */
-extern int gyroSign[3]; /**< Gyroscope sign */
+extern bool swapRollYaw;  /**< Send yaw as roll and roll as yaw */
+extern int  accelMap[3];  /**< Accelerometer map */
+extern int  accelSign[3]; /**< Accelerometer sign */
+extern int  gyroMap[3];   /**< Gyroscope map */
+extern int  gyroSign[3];  /**< Gyroscope sign */
 
 #endif  // WIICON_H
@@ -39,76 +39,76 @@
 
 unsigned long lastTime = 0;
 
-int accelMap[3]  = {0, 1, 2};
-int accelSign[3] = {1, 1, 1};
-int gyroMap[3]   = {0, 1, 2};
-int gyroSign[3]  = {1, 1, 1};
+const char* const BOOT_PHASE_WIFI = "WiFi association";
+
+bool swapRollYaw  = SWAP_ROLL_YAW;
+int  accelMap[3]  = {0, 1, 2};
+int  accelSign[3] = {1, 1, 1};
+int  gyroMap[3]   = {0, 1, 2};
+int  gyroSign[3]  = {1, 1, 1};
 
 void setup() {
+    bootProfiler.begin();
+
     Serial.begin(SERIAL_BAUD);
 
     LedManager::begin();
     LedManager::signalStartup();
 
+    // A press held from the wake-up is ignored until released, so no delay is needed to avoid going back to sleep
     ButtonManager::begin();
     ButtonManager::onSingleClick = actionToggleDataMode;
     ButtonManager::onDoubleClick = actionResetCalibration;
     ButtonManager::onTripleClick = actionResetWifiConfig;
     ButtonManager::onLongPress   = actionSleep;
 
-    delay(DELAY_STARTUP_SAFETY_MS);
-
     Log::init(LOG_LEVEL_DEBUG);
+    serialLink.begin();
     Log::info("WiiCon Remote Project - Starting setup...");
 
     initSleepManager();
     initLittleFS();
+    bootProfiler.mark("serial, LED, LittleFS");
 
-    wifiManager.begin();
-
-    Log::info("Waiting for WiFi connection...");
-    while (!wifiManager.isConnected() && !wifiManager.isInAPMode()) {
-        wifiManager.loop();
-        ButtonManager::loop();
-        yield();
-    }
+    // Loads the stored settings and applies the axis mapping and filter gain before calibration uses them
+    settingsRegistry.begin();
+    bootProfiler.mark("settings");
 
-    if (wifiManager.isConnected()) {
-        Log::info("WiFi connected. Starting sensor initialization...");
+    // Connecting continues in the background while the sensor is set up and calibrated
+    wifiManager.begin();
+    bootProfiler.mark("WiFi start");
+    bootProfiler.start(BOOT_PHASE_WIFI);
 
-        Wire.begin(SDA_PIN, SCL_PIN);
+    Log::info("Starting sensor initialization...");
 
-        Log::info("Starting BMI160 reader. Initializing sensor...");
+    Wire.begin(SDA_PIN, SCL_PIN);
+    Wire.setClock(I2C_CLOCK_HZ);
 
+    if (I2C_SCAN_AT_BOOT) {
         I2CScanner();
+        bootProfiler.mark("I2C scan");
+    }
+
+    Log::info("Starting BMI160 reader. Initializing sensor...");
 
-        if (!initBMI160Sensor()) {
-            Log::error("Failed to init BMI160 (I2C read/write). Check wiring and I2C address.");
-            LedManager::signalErrorSensor();
-        } else {
-            Log::info("BMI160 initialized successfully (chip id: 0x%02X).", BMI160_CHIP_ID);
-            autoCalibrateAccelerometer();
-            LedManager::signalSuccess();
-        }
-
-        Log::info("Starting gyroscope calibration. Keep the device stationary...");
-
-        if (!calibrateGyro(CALIB_SAMPLES, CALIB_DELAY_MS)) {
-            Log::error("Gyroscope calibration failed. Continuing without bias correction.");
-            LedManager::signalErrorGeneral();
-        } else {
-            float mappedBias[3];
-            for (int i = 0; i < 3; ++i) mappedBias[i] = gyroBiasRaw[gyroMap[i]] * (float)gyroSign[i];
-
-            Log::info("Gyroscope calibration successful. Raw biases (deg/s): %.4f, %.4f, %.4f", gyroBiasRaw[0],
-                      gyroBiasRaw[1], gyroBiasRaw[2]);
-            Log::info("Gyroscope calibration successful. Mapped biases (deg/s): %.4f, %.4f, %.4f", mappedBias[0],
-                      mappedBias[1], mappedBias[2]);
-            LedManager::signalSuccess();
-        }
+    if (!initBMI160Sensor()) {
+        Log::error("Failed to init BMI160 (I2C read/write). Check wiring and I2C address.");
+        LedManager::signalErrorSensor();
     } else {
-        Log::info("Device in AP mode. Calibration will start after WiFi connection.");
+        Log::info("BMI160 initialized successfully (chip id: 0x%02X).", BMI160_CHIP_ID);
     }
+    bootProfiler.mark("BMI160 init");
+
+    autoCalibrateAccelerometer();
+    bootProfiler.mark("accel offsets");
+
+    // Averaged over the first streamed samples, the bias from before deep sleep is used until then
+    if (gyroBiasValid) Log::info("Using the gyroscope bias from before sleep until the calibration ends");
+    Log::info("Starting gyroscope calibration. Keep the device stationary...");
+    beginGyroCalibration(configStore.get().calibSamples);
+
+    profileManager.begin();
+    bootProfiler.mark("profile");
 
     lastTime = micros();
 }
@@ -116,16 +116,32 @@ void setup() {
 void loop() {
     wifiManager.loop();
     ButtonManager::loop();
+    LedManager::loop();
+
+    // Changes from the dashboard, OSC and the serial console take effect here, between two samples
+    serialConsole.loop();
+    settingsRegistry.loop();
 
     if (wifiManager.isConnected()) {
-        unsigned long now = micros();
-        float         dt  = (now - lastTime) / 1000000.0f;
-        if (dt > 0) {
-            float measuredHz = 1.0f / dt;
-            sampleFreq       = 0.95f * sampleFreq + 0.05f * measuredHz;
-            lastTime         = now;
-            sendEulerAngles();
-        }
+        bootProfiler.finish(BOOT_PHASE_WIFI);
+
+        // Events go out ahead of the sample stream, remote settings are applied between samples
+        eventChannel.loop();
+        oscReceiver.loop();
+        clockSync.loop();
+        webSocketTransport.loop();
+        dashboard.loop();
+        discovery.loop();
+    }
+
+    // Fusion runs whether or not a link is up, so the orientation is current the moment one comes up
+    unsigned long now = micros();
+    float         dt  = (now - lastTime) / 1000000.0f;
+    if (dt > 0 && now - lastTime >= sampleIntervalUs) {
+        float measuredHz = 1.0f / dt;
+        sampleFreq       = 0.95f * sampleFreq + 0.05f * measuredHz;
+        lastTime         = now;
+        sendEulerAngles();
     }
 
     yield();
@@ -0,0 +1,346 @@
+/**
+ * @file        wiicon_clock.h
+ * @brief       Host-device clock synchronisation for the Wiicon Remote project
+ *
+ * @details     NTP-style exchange over OSC: the device sends a ping stamped with its own
+ *              micros(), a host answers with its receive and transmit times, and the device
+ *              stamps the reply on arrival. ClockEstimator turns these exchanges into an
+ *              offset and drift estimate, keeping only low round-trip samples so queueing
+ *              delay does not bias the result. Header-only and free of Arduino dependencies
+ *              so the firmware and host tools share the same estimator.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+#ifndef WIICON_CLOCK_H
+#define WIICON_CLOCK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "osc_parser.h"
+
+/**
+ * Messages (plain OSC):
+ *
+ *   /wiicon/sync/ping ,iii    device id, sequence, t1                          device -> host
+ *   /wiicon/sync/pong ,iiihh  device id, sequence, t1 (echoed), t2, t3         host -> device
+ *
+ * t1 is the device micros() when the ping is sent. t2 and t3 are the host receive and transmit times in
+ * microseconds since the Unix epoch. The device stamps t4 with micros() when the pong arrives. The pong goes back
+ * to the source address and port of the ping.
+ */
+const char CLOCK_PING_ADDRESS[] = "/wiicon/sync/ping";
+const char CLOCK_PONG_ADDRESS[] = "/wiicon/sync/pong";
+
+const size_t  CLOCK_MAX_SIZE      = 64;      /**< Size of an encoded ping or pong */
+const size_t  CLOCK_WINDOW        = 32;      /**< Exchanges kept for the estimate */
+const int64_t CLOCK_RTT_MARGIN_US = 500;     /**< Round trip excess that cuts an exchange's weight to 1/4 */
+const int64_t CLOCK_RTT_REJECT_US = 20000;   /**< Round trip excess above which an exchange is ignored */
+const int64_t CLOCK_MIN_SPAN_US   = 5000000; /**< Device time spanned by the window before drift is estimated */
+const double  CLOCK_MAX_DRIFT     = 200e-6;  /**< Drift estimates are clamped to this (crystals are within ±50 ppm) */
+
+/**
+ * One ping/pong exchange
+ */
+struct ClockExchange {
+    uint8_t  deviceId; /**< Device id */
+    uint16_t sequence; /**< Ping sequence number */
+    uint32_t t1;       /**< Device time when the ping was sent (micros) */
+    int64_t  t2;       /**< Host time when the ping arrived (Unix micros) */
+    int64_t  t3;       /**< Host time when the pong was sent (Unix micros) */
+};
+
+/**
+ * Write an OSC string with padding
+ * @return Number of bytes written
+ */
+inline size_t clockWriteString(uint8_t* out, const char* str) {
+    size_t length = strlen(str) + 1;
+    memcpy(out, str, length);
+    while (length % 4 != 0) out[length++] = '\0';
+    return length;
+}
+
+/**
+ * Write a big-endian integer of 4 or 8 bytes
+ * @return Number of bytes written
+ */
+inline size_t clockWriteInt(uint8_t* out, uint64_t value, size_t size) {
+    for (size_t i = 0; i < size; ++i) out[i] = (uint8_t)(value >> (8 * (size - 1 - i)));
+    return size;
+}
+
+/**
+ * Encode a ping
+ * @param deviceId Device id
+ * @param sequence Ping sequence number
+ * @param t1 Device time (micros)
+ * @param out Output buffer of at least CLOCK_MAX_SIZE bytes
+ * @return Encoded size in bytes
+ */
+inline size_t clockPingEncode(uint8_t deviceId, uint16_t sequence, uint32_t t1, uint8_t* out) {
+    size_t i = clockWriteString(out, CLOCK_PING_ADDRESS);
+    i += clockWriteString(out + i, ",iii");
+    i += clockWriteInt(out + i, deviceId, 4);
+    i += clockWriteInt(out + i, sequence, 4);
+    i += clockWriteInt(out + i, t1, 4);
+    return i;
+}
+
+/**
+ * Encode a pong
+ * @param exchange Ping fields and host times t2, t3
+ * @param out Output buffer of at least CLOCK_MAX_SIZE bytes
+ * @return Encoded size in bytes
+ */
+inline size_t clockPongEncode(const ClockExchange& exchange, uint8_t* out) {
+    size_t i = clockWriteString(out, CLOCK_PONG_ADDRESS);
+    i += clockWriteString(out + i, ",iiihh");
+    i += clockWriteInt(out + i, exchange.deviceId, 4);
+    i += clockWriteInt(out + i, exchange.sequence, 4);
+    i += clockWriteInt(out + i, exchange.t1, 4);
+    i += clockWriteInt(out + i, (uint64_t)exchange.t2, 8);
+    i += clockWriteInt(out + i, (uint64_t)exchange.t3, 8);
+    return i;
+}
+
+/**
+ * Decode a ping
+ * @param data Datagram
+ * @param length Datagram length in bytes
+ * @param exchange Output with deviceId, sequence and t1 set
+ * @return true if the datagram is a well-formed ping
+ */
+inline bool clockPingDecode(const uint8_t* data, size_t length, ClockExchange* exchange) {
+    OscMessageView message;
+    if (!oscParseMessage(data, length, &message) || strcmp(message.address, CLOCK_PING_ADDRESS) != 0 ||
+        strcmp(message.typeTags, "iii") != 0) {
+        return false;
+    }
+
+    OscArgReader args(message);
+    int32_t      deviceId = 0, sequence = 0, t1 = 0;
+    args.readInt(&deviceId);
+    args.readInt(&sequence);
+    args.readInt(&t1);
+
+    *exchange = {(uint8_t)deviceId, (uint16_t)sequence, (uint32_t)t1, 0, 0};
+    return true;
+}
+
+/**
+ * Decode a pong
+ * @param data Datagram
+ * @param length Datagram length in bytes
+ * @param exchange Output exchange
+ * @return true if the datagram is a well-formed pong
+ */
+inline bool clockPongDecode(const uint8_t* data, size_t length, ClockExchange* exchange) {
+    OscMessageView message;
+    if (!oscParseMessage(data, length, &message) || strcmp(message.address, CLOCK_PONG_ADDRESS) != 0 ||
+        strcmp(message.typeTags, "iiihh") != 0) {
+        return false;
+    }
+
+    OscArgReader args(message);
+    int32_t      deviceId = 0, sequence = 0, t1 = 0;
+    int64_t      t2 = 0, t3 = 0;
+    args.readInt(&deviceId);
+    args.readInt(&sequence);
+    args.readInt(&t1);
+    args.readInt64(&t2);
+    args.readInt64(&t3);
+
+    *exchange = {(uint8_t)deviceId, (uint16_t)sequence, (uint32_t)t1, t2, t3};
+    return true;
+}
+
+/**
+ * Offset and drift estimator
+ * Device times are unwrapped to 64 bits internally, so the estimate survives the 71-minute micros() rollover.
+ * Each exchange gives an offset (host - device) and a round trip. Exchanges whose round trip is well above the
+ * window minimum were delayed on one leg, so they are down-weighted or rejected, and the drift is the weighted
+ * least-squares slope of the offsets over device time.
+ */
+class ClockEstimator {
+   public:
+    ClockEstimator()
+        : _samples{},
+          _count(0),
+          _head(0),
+          _lastDevice(0),
+          _started(false),
+          _synced(false),
+          _reference(0),
+          _offset(0),
+          _drift(0.0),
+          _minRtt(0) {}
+
+    /**
+     * Add a completed exchange
+     * @param exchange Ping/pong fields
+     * @param t4 Device time when the pong arrived (micros)
+     * @return true if the exchange was accepted into the estimate
+     */
+    bool addExchange(const ClockExchange& exchange, uint32_t t4) {
+        int64_t device4 = unwrap(t4);
+        int64_t device1 = device4 - (int64_t)(uint32_t)(t4 - exchange.t1);
+
+        int64_t rtt = (device4 - device1) - (exchange.t3 - exchange.t2);
+        if (rtt < 0 || exchange.t3 < exchange.t2) return false;
+
+        Sample& sample = _samples[_head];
+        sample.device  = device1 + (device4 - device1) / 2;
+        sample.offset  = ((exchange.t2 - device1) + (exchange.t3 - device4)) / 2;
+        sample.rtt     = rtt;
+        _head          = (_head + 1) % CLOCK_WINDOW;
+        if (_count < CLOCK_WINDOW) _count++;
+
+        return estimate(sample);
+    }
+
+    /**
+     * Check whether at least one exchange was accepted
+     */
+    bool synced() const { return _synced; }
+
+    /**
+     * Convert a device time to host time
+     * @param device Device micros, close to the last exchange (within about 35 minutes)
+     * @return Host time (Unix micros), or the unwrapped device time if not synced
+     */
+    int64_t toHost(uint32_t device) const {
+        int64_t unwrapped = _lastDevice + (int32_t)(device - (uint32_t)_lastDevice);
+        if (!_synced) return unwrapped;
+        return unwrapped + _offset + (int64_t)(_drift * (double)(unwrapped - _reference));
+    }
+
+    /**
+     * Current offset (host - device) at the last exchange in microseconds
+     */
+    int64_t offset() const { return _offset + (int64_t)(_drift * (double)(_lastDevice - _reference)); }
+
+    /**
+     * Current drift in parts per million (host clock rate relative to the device clock, minus one)
+     */
+    double driftPpm() const { return _drift * 1e6; }
+
+    /**
+     * Smallest round trip in the window in microseconds
+     */
+    int64_t minRtt() const { return _minRtt; }
+
+   private:
+    struct Sample {
+        int64_t device; /**< Device time at the middle of the exchange (unwrapped micros) */
+        int64_t offset; /**< Host - device offset (micros) */
+        int64_t rtt;    /**< Round trip minus host processing time (micros) */
+    };
+
+    /**
+     * Extend a device time to 64 bits relative to the previous one
+     */
+    int64_t unwrap(uint32_t device) {
+        if (!_started) {
+            _started    = true;
+            _lastDevice = device;
+        } else {
+            _lastDevice += (int32_t)(device - (uint32_t)_lastDevice);
+        }
+        return _lastDevice;
+    }
+
+    /**
+     * Recompute offset and drift with a weighted least-squares fit over the window
+     * Each exchange is weighted by how close its round trip is to the window minimum, so the queueing delay of a
+     * slow exchange barely moves the fit, and exchanges more than CLOCK_RTT_REJECT_US above the minimum are dropped.
+     * @param latest Sample just added
+     * @return true if the latest sample is within CLOCK_RTT_MARGIN_US of the minimum round trip
+     */
+    bool estimate(const Sample& latest) {
+        _minRtt = latest.rtt;
+        for (size_t i = 0; i < _count; ++i) {
+            if (_samples[i].rtt < _minRtt) _minRtt = _samples[i].rtt;
+        }
+
+        // Sums are taken relative to the latest sample to keep them small
+        double  n = 0.0, sw = 0.0, sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0;
+        int64_t first = latest.device, last = latest.device;
+        for (size_t i = 0; i < _count; ++i) {
+            const Sample& sample = _samples[i];
+            int64_t       excess = sample.rtt - _minRtt;
+            if (excess > CLOCK_RTT_REJECT_US) continue;
+
+            double scale = 1.0 + (double)excess / (double)CLOCK_RTT_MARGIN_US;
+            double w     = 1.0 / (scale * scale);
+            double x     = (double)(sample.device - latest.device);
+            double y     = (double)(sample.offset - latest.offset);
+
+            if (sample.device < first) first = sample.device;
+            if (sample.device > last) last = sample.device;
+            n += 1.0;
+            sw += w;
+            sx += w * x;
+            sy += w * y;
+            sxx += w * x * x;
+            sxy += w * x * y;
+        }
+
+        double slope = 0.0;
+        if (last - first >= CLOCK_MIN_SPAN_US && n >= 3.0) {
+            double denominator = sw * sxx - sx * sx;
+            if (denominator > 0.0) slope = (sw * sxy - sx * sy) / denominator;
+            if (slope > CLOCK_MAX_DRIFT) slope = CLOCK_MAX_DRIFT;
+            if (slope < -CLOCK_MAX_DRIFT) slope = -CLOCK_MAX_DRIFT;
+        }
+
+        // The weighted line passes through the weighted centroid
+        _reference = latest.device + (int64_t)(sx / sw);
+        _offset    = latest.offset + (int64_t)(sy / sw);
+        _drift     = slope;
+        _synced    = true;
+
+        return latest.rtt - _minRtt <= CLOCK_RTT_MARGIN_US;
+    }
+
+    Sample  _samples[CLOCK_WINDOW]; /**< Ring of recent exchanges */
+    size_t  _count;                 /**< Used entries in the ring */
+    size_t  _head;                  /**< Next slot to write */
+    int64_t _lastDevice;            /**< Last device time seen, unwrapped */
+    bool    _started;               /**< Whether _lastDevice is set */
+    bool    _synced;                /**< Whether an estimate is available */
+    int64_t _reference;             /**< Device time the offset refers to (unwrapped micros) */
+    int64_t _offset;                /**< Host - device offset at _reference (micros) */
+    double  _drift;                 /**< Offset change per device microsecond */
+    int64_t _minRtt;                /**< Smallest round trip in the window (micros) */
+};
+
+#endif  // WIICON_CLOCK_H
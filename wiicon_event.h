@@ -0,0 +1,376 @@
+/**
+ * @file        wiicon_event.h
+ * @brief       Reliable event channel protocol for the Wiicon Remote project
+ *
+ * @details     Discrete events (mode changes, future button or gesture events) are sent as
+ *              OSC messages carrying a session id and a sequence number. Receivers reply
+ *              with an acknowledgement and the sender retransmits unacknowledged events
+ *              with a bounded exponential backoff, plus a fast retransmit when a later event
+ *              is acknowledged first. Header-only and free of Arduino dependencies so the
+ *              firmware and host tools share the same encoder, decoder and queue.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+
+#ifndef WIICON_EVENT_H
+#define WIICON_EVENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Messages (plain OSC, all arguments int32):
+ *
+ *   /wiicon/event ,iiiii  device id, session, sequence, type, value    device -> host
+ *   /wiicon/ack   ,iii    device id, session, sequence                 host -> device
+ *
+ * Events go to the primary OSC destination. The ack is sent back to the source address and port of the event,
+ * which is the device's event port. The session is random per boot so receivers can tell a restarted device from
+ * a duplicate.
+ */
+const char EVENT_ADDRESS[]     = "/wiicon/event";
+const char EVENT_ACK_ADDRESS[] = "/wiicon/ack";
+
+const size_t   EVENT_QUEUE_SIZE   = 8;   /**< Events awaiting an acknowledgement */
+const size_t   EVENT_MAX_SIZE     = 48;  /**< Size of an encoded event message */
+const uint8_t  EVENT_MAX_ATTEMPTS = 6;   /**< Transmissions before an event is given up */
+const uint32_t EVENT_RTO_MS       = 20;  /**< First retransmission timeout */
+const uint32_t EVENT_RTO_MAX_MS   = 320; /**< Retransmission timeout cap */
+
+/**
+ * Event types
+ */
+enum EventType : uint8_t {
+    EVENT_MODE    = 1, /**< Data mode changed, value is the new DataMode */
+    EVENT_BUTTON  = 2, /**< Button gesture, value is the click count (0 = long press) */
+    EVENT_GESTURE = 3, /**< Motion gesture, value is the gesture id */
+};
+
+/**
+ * Decoded event contents
+ */
+struct WiiconEvent {
+    uint8_t  deviceId; /**< Sender id */
+    uint32_t session;  /**< Random id chosen at boot */
+    uint16_t sequence; /**< Event sequence number */
+    uint8_t  type;     /**< EventType */
+    int32_t  value;    /**< Event value */
+};
+
+/**
+ * Write an OSC string with padding
+ * @return Number of bytes written
+ */
+inline size_t eventWriteString(uint8_t* out, const char* str) {
+    size_t length = strlen(str) + 1;
+    memcpy(out, str, length);
+    while (length % 4 != 0) out[length++] = '\0';
+    return length;
+}
+
+/**
+ * Write a big-endian OSC int32
+ * @return Number of bytes written
+ */
+inline size_t eventWriteInt(uint8_t* out, int32_t value) {
+    uint32_t bits = (uint32_t)value;
+    out[0]        = (uint8_t)(bits >> 24);
+    out[1]        = (uint8_t)(bits >> 16);
+    out[2]        = (uint8_t)(bits >> 8);
+    out[3]        = (uint8_t)bits;
+    return 4;
+}
+
+/**
+ * Read a big-endian OSC int32
+ */
+inline int32_t eventReadInt(const uint8_t* in) {
+    return (int32_t)(((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16) | ((uint32_t)in[2] << 8) | in[3]);
+}
+
+/**
+ * Check an OSC message header and return the offset of its arguments
+ * @param data Datagram
+ * @param length Datagram length in bytes
+ * @param address Expected address (its padded size is a multiple of 4, so is the type tag string)
+ * @param typeTags Expected type tags
+ * @return Offset of the first argument, 0 if the header does not match
+ */
+inline size_t eventMatchHeader(const uint8_t* data, size_t length, const char* address, const char* typeTags) {
+    size_t addressSize = (strlen(address) + 4) & ~(size_t)3;
+    size_t tagsSize    = (strlen(typeTags) + 4) & ~(size_t)3;
+    if (length < addressSize + tagsSize) return 0;
+    if (memcmp(data, address, strlen(address) + 1) != 0) return 0;
+    if (memcmp(data + addressSize, typeTags, strlen(typeTags) + 1) != 0) return 0;
+    return addressSize + tagsSize;
+}
+
+/**
+ * Encode an event message
+ * @param event Event to encode
+ * @param out Output buffer of at least EVENT_MAX_SIZE bytes
+ * @return Encoded size in bytes
+ */
+inline size_t eventEncode(const WiiconEvent& event, uint8_t* out) {
+    size_t i = eventWriteString(out, EVENT_ADDRESS);
+    i += eventWriteString(out + i, ",iiiii");
+    i += eventWriteInt(out + i, event.deviceId);
+    i += eventWriteInt(out + i, (int32_t)event.session);
+    i += eventWriteInt(out + i, event.sequence);
+    i += eventWriteInt(out + i, event.type);
+    i += eventWriteInt(out + i, event.value);
+    return i;
+}
+
+/**
+ * Decode an event message
+ * @param data Datagram
+ * @param length Datagram length in bytes
+ * @param event Output event
+ * @return true if the datagram is a well-formed event
+ */
+inline bool eventDecode(const uint8_t* data, size_t length, WiiconEvent* event) {
+    size_t i = eventMatchHeader(data, length, EVENT_ADDRESS, ",iiiii");
+    if (i == 0 || length < i + 5 * 4) return false;
+
+    event->deviceId = (uint8_t)eventReadInt(data + i);
+    event->session  = (uint32_t)eventReadInt(data + i + 4);
+    event->sequence = (uint16_t)eventReadInt(data + i + 8);
+    event->type     = (uint8_t)eventReadInt(data + i + 12);
+    event->value    = eventReadInt(data + i + 16);
+    return true;
+}
+
+/**
+ * Encode an acknowledgement for an event
+ * @param event Event to acknowledge
+ * @param out Output buffer of at least EVENT_MAX_SIZE bytes
+ * @return Encoded size in bytes
+ */
+inline size_t eventAckEncode(const WiiconEvent& event, uint8_t* out) {
+    size_t i = eventWriteString(out, EVENT_ACK_ADDRESS);
+    i += eventWriteString(out + i, ",iii");
+    i += eventWriteInt(out + i, event.deviceId);
+    i += eventWriteInt(out + i, (int32_t)event.session);
+    i += eventWriteInt(out + i, event.sequence);
+    return i;
+}
+
+/**
+ * Decode an acknowledgement
+ * @param data Datagram
+ * @param length Datagram length in bytes
+ * @param ack Output event with deviceId, session and sequence set
+ * @return true if the datagram is a well-formed acknowledgement
+ */
+inline bool eventAckDecode(const uint8_t* data, size_t length, WiiconEvent* ack) {
+    size_t i = eventMatchHeader(data, length, EVENT_ACK_ADDRESS, ",iii");
+    if (i == 0 || length < i + 3 * 4) return false;
+
+    ack->deviceId = (uint8_t)eventReadInt(data + i);
+    ack->session  = (uint32_t)eventReadInt(data + i + 4);
+    ack->sequence = (uint16_t)eventReadInt(data + i + 8);
+    ack->type     = 0;
+    ack->value    = 0;
+    return true;
+}
+
+/**
+ * Sender side retransmission queue
+ * Time is passed in by the caller (milliseconds) so the queue runs unchanged on the device and on the host.
+ */
+class EventQueue {
+   public:
+    /**
+     * Statistics since construction
+     */
+    struct Stats {
+        uint32_t posted;          /**< Events accepted */
+        uint32_t acked;           /**< Events acknowledged */
+        uint32_t retransmits;     /**< Retransmissions after a timeout */
+        uint32_t fastRetransmits; /**< Retransmissions triggered by a later acknowledgement */
+        uint32_t expired;         /**< Events given up after EVENT_MAX_ATTEMPTS */
+        uint32_t overflows;       /**< Events rejected because the queue was full */
+    };
+
+    EventQueue() : _deviceId(0), _session(0), _sequence(0), _pending{}, _stats{} {}
+
+    /**
+     * Set the identity stamped on every event
+     * Events posted before are restamped, so call it before their first transmission: the host acknowledges with the
+     * identity it received.
+     * @param deviceId Sender id
+     * @param session Random id chosen at boot
+     */
+    void setIdentity(uint8_t deviceId, uint32_t session) {
+        _deviceId = deviceId;
+        _session  = session;
+
+        for (Pending& pending : _pending) {
+            pending.event.deviceId = deviceId;
+            pending.event.session  = session;
+        }
+    }
+
+    /**
+     * Queue an event for immediate transmission
+     * @param type EventType
+     * @param value Event value
+     * @param now Current time (ms)
+     * @return true if the event was queued, false if the queue is full
+     */
+    bool post(uint8_t type, int32_t value, uint32_t now) {
+        for (Pending& pending : _pending) {
+            if (pending.active) continue;
+
+            pending.active   = true;
+            pending.attempts = 0;
+            pending.nextSend = now;
+            pending.event    = {_deviceId, _session, ++_sequence, type, value};
+            _stats.posted++;
+            return true;
+        }
+
+        _stats.overflows++;
+        return false;
+    }
+
+    /**
+     * Transmit every event that is due, oldest first
+     * @param now Current time (ms)
+     * @param send Called as send(const WiiconEvent&) for each transmission
+     * @return Number of transmissions
+     */
+    template <typename Send>
+    size_t service(uint32_t now, Send&& send) {
+        size_t sent = 0;
+
+        while (Pending* pending = nextDue(now)) {
+            if (pending->attempts >= EVENT_MAX_ATTEMPTS) {
+                pending->active = false;
+                _stats.expired++;
+                continue;
+            }
+
+            if (pending->attempts > 0 && !pending->fast) _stats.retransmits++;
+
+            uint32_t rto      = EVENT_RTO_MS << pending->attempts;
+            pending->nextSend = now + (rto < EVENT_RTO_MAX_MS ? rto : EVENT_RTO_MAX_MS);
+            pending->fast     = false;
+            pending->attempts++;
+
+            send(pending->event);
+            sent++;
+        }
+
+        return sent;
+    }
+
+    /**
+     * Process an acknowledgement
+     * Events sent before the acknowledged one and still pending were most likely lost, so they are made due
+     * immediately instead of waiting for their timeout (at most once per transmission).
+     * @param ack Decoded acknowledgement
+     * @param now Current time (ms)
+     * @return true if the acknowledgement matched a pending event
+     */
+    bool acknowledge(const WiiconEvent& ack, uint32_t now) {
+        if (ack.deviceId != _deviceId || ack.session != _session) return false;
+
+        bool matched = false;
+        for (Pending& pending : _pending) {
+            if (!pending.active || pending.event.sequence != ack.sequence) continue;
+            pending.active = false;
+            matched        = true;
+            _stats.acked++;
+        }
+        if (!matched) return false;
+
+        for (Pending& pending : _pending) {
+            if (!pending.active || pending.fast || pending.attempts == 0) continue;
+            if ((int16_t)(pending.event.sequence - ack.sequence) >= 0) continue;
+
+            pending.fast     = true;
+            pending.nextSend = now;
+            _stats.fastRetransmits++;
+        }
+
+        return true;
+    }
+
+    /**
+     * Check whether events are waiting for an acknowledgement
+     * @return true if the queue is empty
+     */
+    bool idle() const {
+        for (const Pending& pending : _pending) {
+            if (pending.active) return false;
+        }
+        return true;
+    }
+
+    /**
+     * Get the statistics
+     * @return Statistics since construction
+     */
+    const Stats& stats() const { return _stats; }
+
+   private:
+    struct Pending {
+        bool        active;   /**< Slot holds an unacknowledged event */
+        bool        fast;     /**< Made due by a later acknowledgement */
+        uint8_t     attempts; /**< Transmissions so far */
+        uint32_t    nextSend; /**< Time of the next transmission (ms) */
+        WiiconEvent event;    /**< Event */
+    };
+
+    /**
+     * Find the oldest due event
+     * @param now Current time (ms)
+     * @return Pending event, nullptr if none is due
+     */
+    Pending* nextDue(uint32_t now) {
+        Pending* due = nullptr;
+        for (Pending& pending : _pending) {
+            if (!pending.active || (int32_t)(now - pending.nextSend) < 0) continue;
+            if (!due || (int16_t)(pending.event.sequence - due->event.sequence) < 0) due = &pending;
+        }
+        return due;
+    }
+
+    uint8_t  _deviceId;                  /**< Sender id */
+    uint32_t _session;                   /**< Random id chosen at boot */
+    uint16_t _sequence;                  /**< Last assigned sequence number */
+    Pending  _pending[EVENT_QUEUE_SIZE]; /**< Unacknowledged events */
+    Stats    _stats;                     /**< Statistics */
+};
+
+#endif  // WIICON_EVENT_H
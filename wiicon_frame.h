@@ -0,0 +1,330 @@
+/**
+ * @file        wiicon_frame.h
+ * @brief       Compact binary frame format for the Wiicon Remote project
+ *
+ * @details     Versioned binary alternative to OSC for dense deployments. A frame carries a
+ *              header (device id, sequence number, sensor timestamp) followed by raw int16
+ *              accelerometer/gyroscope samples and a "smallest-three" packed quaternion.
+ *              Header-only and free of Arduino dependencies so the firmware and host tools
+ *              share the exact same encoder and decoder.
+ *
+ * @author      See AUTHORS file for full list of contributors
+ * @date        2026
+ * @version     1.0.0
+ *
+ * ========================================================================================
+ *
+ * MIT License
+ * Copyright (c) 2026 Wiicon Remote Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ========================================================================================
+ */
+
+#ifndef WIICON_FRAME_H
+#define WIICON_FRAME_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Frame layout (version 1, all multi-byte fields little-endian):
+ *
+ *   offset  size  field
+ *   0       1     magic (0xC1, never '/' or '#', so frames and OSC packets can share a port)
+ *   1       1     version
+ *   2       1     flags (FRAME_HAS_*)
+ *   3       1     device id
+ *   4       2     sequence number (counts sensor samples)
+ *   6       4     sensor timestamp (device micros, or host Unix micros if FRAME_HOST_TIME)
+ *   10      6     accelerometer x, y, z (int16, FRAME_ACC_LSB_PER_G)     if FRAME_HAS_ACCEL
+ *   ..      6     gyroscope x, y, z (int16, FRAME_GYR_LSB_PER_DPS)       if FRAME_HAS_GYRO
+ *   ..      6     quaternion, smallest-three packed in 47 bits           if FRAME_HAS_QUAT
+ *
+ * Redundant bundle (forward redundancy, same version numbering):
+ *
+ *   offset  size  field
+ *   0       1     magic (0xC2)
+ *   1       1     version
+ *   2       1     frame count (1 + number of repeated previous frames)
+ *   3       ..    frames, newest first, each a complete frame as above
+ */
+const uint8_t FRAME_MAGIC        = 0xC1;
+const uint8_t FRAME_BUNDLE_MAGIC = 0xC2;
+const uint8_t FRAME_VERSION      = 1;
+
+const uint8_t FRAME_HAS_ACCEL = 1 << 0; /**< Frame carries accelerometer data */
+const uint8_t FRAME_HAS_GYRO  = 1 << 1; /**< Frame carries gyroscope data */
+const uint8_t FRAME_HAS_QUAT  = 1 << 2; /**< Frame carries the orientation quaternion */
+const uint8_t FRAME_HOST_TIME = 1 << 3; /**< Timestamp is host time (low 32 bits of Unix micros, wiicon_clock.h) */
+
+const size_t FRAME_HEADER_SIZE = 10;                        /**< Header size in bytes */
+const size_t FRAME_MAX_SIZE    = FRAME_HEADER_SIZE + 6 * 3; /**< Size of a frame with every field present */
+
+const size_t FRAME_BUNDLE_HEADER_SIZE = 3; /**< Bundle header size in bytes */
+const size_t FRAME_MAX_REDUNDANCY     = 4; /**< Maximum number of previous frames repeated in a bundle */
+
+const float FRAME_ACC_LSB_PER_G   = 16384.0f; /**< ±2g full scale */
+const float FRAME_GYR_LSB_PER_DPS = 16.4f;    /**< ±2000 dps full scale */
+
+/**
+ * Decoded frame contents
+ */
+struct WiiconFrame {
+    uint8_t  flags;     /**< FRAME_HAS_* bitmask */
+    uint8_t  deviceId;  /**< Sender id */
+    uint16_t sequence;  /**< Sample sequence number */
+    uint32_t timestamp; /**< Sensor timestamp (device micros, or host micros if FRAME_HOST_TIME) */
+    int16_t  accel[3];  /**< Accelerometer in FRAME_ACC_LSB_PER_G units */
+    int16_t  gyro[3];   /**< Gyroscope in FRAME_GYR_LSB_PER_DPS units */
+    float    quat[4];   /**< Orientation quaternion (w, x, y, z) */
+};
+
+/**
+ * Quantize a physical value to int16 with saturation
+ * @param value Value in physical units
+ * @param scale LSB per physical unit
+ * @return Quantized value
+ */
+inline int16_t frameQuantize(float value, float scale) {
+    float v = roundf(value * scale);
+    if (v > 32767.0f) return 32767;
+    if (v < -32768.0f) return -32768;
+    return (int16_t)v;
+}
+
+/**
+ * Pack a unit quaternion using the "smallest-three" scheme
+ * The largest component is dropped (its index is kept in 2 bits) and the other three, which lie in
+ * [-1/sqrt(2), 1/sqrt(2)], are stored with 15 bits each.
+ * @param q Quaternion (w, x, y, z)
+ * @return Packed value in the low 47 bits
+ */
+inline uint64_t framePackQuaternion(const float q[4]) {
+    const float range = 0.70710678f;
+    const float steps = 32767.0f;
+
+    int largest = 0;
+    for (int i = 1; i < 4; ++i) {
+        if (fabsf(q[i]) > fabsf(q[largest])) largest = i;
+    }
+
+    // q and -q are the same rotation, make the dropped component positive
+    float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+
+    uint64_t packed = (uint64_t)largest;
+    for (int i = 0; i < 4; ++i) {
+        if (i == largest) continue;
+        float c = sign * q[i] / range;
+        if (c > 1.0f) c = 1.0f;
+        if (c < -1.0f) c = -1.0f;
+        packed = (packed << 15) | (uint64_t)lroundf((c + 1.0f) * 0.5f * steps);
+    }
+
+    return packed;
+}
+
+/**
+ * Unpack a quaternion packed with framePackQuaternion()
+ * @param packed Packed value
+ * @param q Output quaternion (w, x, y, z)
+ */
+inline void frameUnpackQuaternion(uint64_t packed, float q[4]) {
+    const float range = 0.70710678f;
+    const float steps = 32767.0f;
+
+    int   largest = (int)((packed >> 45) & 0x3);
+    float sum     = 0.0f;
+
+    for (int i = 3, shift = 0; i >= 0; --i) {
+        if (i == largest) continue;
+        float c = ((float)((packed >> shift) & 0x7FFF) / steps * 2.0f - 1.0f) * range;
+        q[i]    = c;
+        sum += c * c;
+        shift += 15;
+    }
+
+    q[largest] = sum < 1.0f ? sqrtf(1.0f - sum) : 0.0f;
+}
+
+/**
+ * Get the encoded size of a frame
+ * @param flags FRAME_HAS_* bitmask
+ * @return Encoded size in bytes
+ */
+inline size_t frameEncodedSize(uint8_t flags) {
+    size_t size = FRAME_HEADER_SIZE;
+    if (flags & FRAME_HAS_ACCEL) size += 6;
+    if (flags & FRAME_HAS_GYRO) size += 6;
+    if (flags & FRAME_HAS_QUAT) size += 6;
+    return size;
+}
+
+/**
+ * Encode a frame
+ * @param frame Frame to encode
+ * @param out Output buffer
+ * @param capacity Output buffer capacity in bytes
+ * @return Encoded size in bytes, 0 if the buffer is too small
+ */
+inline size_t frameEncode(const WiiconFrame& frame, uint8_t* out, size_t capacity) {
+    if (frameEncodedSize(frame.flags) > capacity) return 0;
+
+    size_t i = 0;
+    out[i++] = FRAME_MAGIC;
+    out[i++] = FRAME_VERSION;
+    out[i++] = frame.flags;
+    out[i++] = frame.deviceId;
+    out[i++] = frame.sequence & 0xFF;
+    out[i++] = frame.sequence >> 8;
+    for (int b = 0; b < 4; ++b) out[i++] = (frame.timestamp >> (8 * b)) & 0xFF;
+
+    if (frame.flags & FRAME_HAS_ACCEL) {
+        for (int a = 0; a < 3; ++a) {
+            out[i++] = (uint16_t)frame.accel[a] & 0xFF;
+            out[i++] = (uint16_t)frame.accel[a] >> 8;
+        }
+    }
+
+    if (frame.flags & FRAME_HAS_GYRO) {
+        for (int a = 0; a < 3; ++a) {
+            out[i++] = (uint16_t)frame.gyro[a] & 0xFF;
+            out[i++] = (uint16_t)frame.gyro[a] >> 8;
+        }
+    }
+
+    if (frame.flags & FRAME_HAS_QUAT) {
+        uint64_t packed = framePackQuaternion(frame.quat);
+        for (int b = 0; b < 6; ++b) out[i++] = (packed >> (8 * b)) & 0xFF;
+    }
+
+    return i;
+}
+
+/**
+ * Check whether a datagram looks like a binary frame
+ * @param data Datagram
+ * @param length Datagram length in bytes
+ * @return true if the datagram starts with the frame magic
+ */
+inline bool frameIsFrame(const uint8_t* data, size_t length) { return length >= 1 && data[0] == FRAME_MAGIC; }
+
+/**
+ * Check whether a datagram looks like a redundant bundle
+ * @param data Datagram
+ * @param length Datagram length in bytes
+ * @return true if the datagram starts with the bundle magic
+ */
+inline bool frameIsBundle(const uint8_t* data, size_t length) { return length >= 1 && data[0] == FRAME_BUNDLE_MAGIC; }
+
+/**
+ * Encode a redundant bundle from already encoded frames
+ * @param frames Encoded frames, newest first
+ * @param lengths Length of each encoded frame
+ * @param count Number of frames
+ * @param out Output buffer
+ * @param capacity Output buffer capacity in bytes
+ * @return Encoded size in bytes, 0 if the buffer is too small
+ */
+inline size_t frameBundleEncode(const uint8_t* const* frames, const size_t* lengths, size_t count, uint8_t* out,
+                                size_t capacity) {
+    if (count == 0 || count > 1 + FRAME_MAX_REDUNDANCY || capacity < FRAME_BUNDLE_HEADER_SIZE) return 0;
+
+    size_t i = 0;
+    out[i++] = FRAME_BUNDLE_MAGIC;
+    out[i++] = FRAME_VERSION;
+    out[i++] = (uint8_t)count;
+
+    for (size_t f = 0; f < count; ++f) {
+        if (i + lengths[f] > capacity) return 0;
+        for (size_t b = 0; b < lengths[f]; ++b) out[i++] = frames[f][b];
+    }
+
+    return i;
+}
+
+/**
+ * Decode a frame
+ * Fields absent from the frame are zeroed (the quaternion is set to identity).
+ * @param data Datagram
+ * @param length Datagram length in bytes
+ * @param frame Output frame
+ * @return true if the datagram is a complete frame of a supported version
+ */
+inline bool frameDecode(const uint8_t* data, size_t length, WiiconFrame* frame) {
+    if (length < FRAME_HEADER_SIZE || data[0] != FRAME_MAGIC || data[1] != FRAME_VERSION) return false;
+
+    *frame          = WiiconFrame();
+    frame->quat[0]  = 1.0f;
+    frame->flags    = data[2];
+    frame->deviceId = data[3];
+    frame->sequence = (uint16_t)(data[4] | (data[5] << 8));
+    for (int b = 0; b < 4; ++b) frame->timestamp |= (uint32_t)data[6 + b] << (8 * b);
+
+    size_t i = FRAME_HEADER_SIZE;
+
+    if (frame->flags & FRAME_HAS_ACCEL) {
+        if (i + 6 > length) return false;
+        for (int a = 0; a < 3; ++a, i += 2) frame->accel[a] = (int16_t)(data[i] | (data[i + 1] << 8));
+    }
+
+    if (frame->flags & FRAME_HAS_GYRO) {
+        if (i + 6 > length) return false;
+        for (int a = 0; a < 3; ++a, i += 2) frame->gyro[a] = (int16_t)(data[i] | (data[i + 1] << 8));
+    }
+
+    if (frame->flags & FRAME_HAS_QUAT) {
+        if (i + 6 > length) return false;
+        uint64_t packed = 0;
+        for (int b = 0; b < 6; ++b) packed |= (uint64_t)data[i + b] << (8 * b);
+        frameUnpackQuaternion(packed, frame->quat);
+    }
+
+    return true;
+}
+
+/**
+ * Decode a redundant bundle
+ * @param data Datagram
+ * @param length Datagram length in bytes
+ * @param frames Output frames, newest first
+ * @param maxFrames Capacity of the output array
+ * @return Number of decoded frames, 0 if the bundle is malformed
+ */
+inline size_t frameBundleDecode(const uint8_t* data, size_t length, WiiconFrame* frames, size_t maxFrames) {
+    if (length < FRAME_BUNDLE_HEADER_SIZE || data[0] != FRAME_BUNDLE_MAGIC || data[1] != FRAME_VERSION) return 0;
+
+    size_t count = data[2];
+    if (count == 0 || count > maxFrames) return 0;
+
+    size_t i = FRAME_BUNDLE_HEADER_SIZE;
+    for (size_t f = 0; f < count; ++f) {
+        if (i + FRAME_HEADER_SIZE > length) return 0;
+
+        size_t size = frameEncodedSize(data[i + 2]);
+        if (i + size > length || !frameDecode(data + i, size, &frames[f])) return 0;
+        i += size;
+    }
+
+    return count;
+}
+
+#endif  // WIICON_FRAME_H